@@ -29,9 +29,11 @@ private:
     sd::GameController* m_controller = nullptr;
 
     sd::AssetManager<sd::audio::Sound> m_sounds{ };
+    sd::AssetManager<sd::audio::Sound>::Handle m_blipSound;
     
     sd::ParticleSystem m_particles;
     sd::f32 m_clickParticleDelay = 0.01f;
+    sd::f32 m_assetReloadDelay = 1.0f;
 
 public:
     TestScene(sd::Application& application, const sd::String& name)
@@ -51,7 +53,7 @@ public:
         for (const auto& texture : textures)
         {
             const sd::String textureName = sd::fs::GetStem(texture);
-            m_textures.Add(textureName, texture);
+            m_textures.AddFromFile(textureName, texture);
 
             if (!m_textures[textureName].IsValid())
             {
@@ -90,9 +92,9 @@ public:
             return sd::Status::Fail;
         }
 
-        m_sounds.Add("blip", "assets/sounds/blip.wav");
+        m_blipSound = m_sounds.AddFromFile("blip", "assets/sounds/blip.wav");
 
-        if (!m_sounds["blip"].IsValid())
+        if (!m_sounds[m_blipSound].IsValid())
         {
             return sd::Status::Fail;
         }
@@ -162,7 +164,7 @@ public:
 
             if (inputManager.IsButtonDown("play_sound", { m_controller }))
             {
-                GetSoundSystem().PlaySound(m_sounds["blip"]);
+                GetSoundSystem().PlaySound(m_sounds[m_blipSound]);
             }
 
             if (inputManager.IsButtonPressed("particle", { m_controller }) && m_clickParticleDelay < 0.0f)
@@ -209,6 +211,16 @@ public:
 
         m_clickParticleDelay -= deltaTime;
         m_particles.Update(deltaTime);
+
+        m_assetReloadDelay -= deltaTime;
+
+        if (m_assetReloadDelay < 0.0f)
+        {
+            m_assetReloadDelay = 1.0f;
+
+            m_textures.ReloadChangedAssets();
+            m_sounds.ReloadChangedAssets();
+        }
     }
 
     virtual void PostUpdate(const sd::f32 deltaTime) override { }
@@ -1,11 +1,25 @@
 #include <cstdlib>
+#include <string_view>
 
 #include <stardust/Stardust.h>
 
 #include "TestScene.h"
 
-auto main([[maybe_unused]] const sd::i32 argc, char* argv[]) -> sd::i32
+auto main(const sd::i32 argc, char* argv[]) -> sd::i32
 {
+    const auto getArgumentValue = [argc, argv](const std::string_view option) -> sd::String
+    {
+        for (sd::i32 i = 1; i < argc - 1; ++i)
+        {
+            if (argv[i] == option)
+            {
+                return argv[i + 1];
+            }
+        }
+
+        return "";
+    };
+
     sd::Application application(
         sd::Application::CreateInfo{
             .applicationInfo = sd::Application::CreateInfo::ApplicationInfo{
@@ -50,6 +64,24 @@ auto main([[maybe_unused]] const sd::i32 argc, char* argv[]) -> sd::i32
                 .velocityIterations = 8u,
             },
 
+            .assetInfo = sd::Application::CreateInfo::AssetInfo{
+                .loaderThreadCount = 0u,
+                .uploadBudgetPerFrame = 0.004f,
+            },
+
+            .scriptInfo = sd::Application::CreateInfo::ScriptInfo{
+                .bytecodeCacheRelativeDirectory = "script_cache",
+                .workerStateCount = 0u,
+                .garbageCollectionMode = sd::ScriptEngine::GarbageCollectionMode::Generational,
+                .targetFrameTime = 1.0 / 60.0,
+            },
+
+            .inputRecordingInfo = sd::Application::CreateInfo::InputRecordingInfo{
+                .recordingFilepath = getArgumentValue("--record-input"),
+                .replayFilepath = getArgumentValue("--replay-input"),
+                .frameTimesFilepath = getArgumentValue("--frame-times"),
+            },
+
             .argv0 = argv[0],
 
             .initialiseCallback = sd::Application::InitialiseCallback(
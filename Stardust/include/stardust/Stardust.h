@@ -15,14 +15,19 @@
 #include "stardust/application/events/GlobalEventHandler.h"
 #include "stardust/application/Application.h"
 
+#include "stardust/assets/AssetHandle.h"
+#include "stardust/assets/AssetLoader.h"
 #include "stardust/assets/AssetManager.h"
 
 #include "stardust/audio/listener/Listener.h"
 #include "stardust/audio/mixing/MixingBus.h"
+#include "stardust/audio/sounds/SampleCache.h"
 #include "stardust/audio/sounds/SoundBase.h"
 #include "stardust/audio/sounds/Sounds.h"
+#include "stardust/audio/sounds/VirtualSoundFile.h"
 #include "stardust/audio/source/PositionalSoundSource.h"
 #include "stardust/audio/source/SoundSource.h"
+#include "stardust/audio/voices/VoiceManager.h"
 #include "stardust/audio/volume/VolumeManager.h"
 #include "stardust/audio/Audio.h"
 #include "stardust/audio/SoundCuePlayer.h"
@@ -36,12 +41,17 @@
 
 #include "stardust/ecs/bundle/EntityBundle.h"
 #include "stardust/ecs/components/Components.h"
+#include "stardust/ecs/culling/SpriteCuller.h"
 #include "stardust/ecs/entity/Entity.h"
 #include "stardust/ecs/entity/EntityHandle.h"
 #include "stardust/ecs/registry/EntityRegistry.h"
+#include "stardust/ecs/spatial_hash/SpatialHash.h"
 
+#include "stardust/filesystem/vfs/PackArchive.h"
+#include "stardust/filesystem/vfs/ReadArena.h"
 #include "stardust/filesystem/vfs/VirtualFilesystem.h"
 #include "stardust/filesystem/Filesystem.h"
+#include "stardust/filesystem/MemoryMappedFile.h"
 
 #include "stardust/geometry/Shapes.h"
 
@@ -97,6 +107,7 @@
 #include "stardust/input/keyboard/VirtualKeyCodes.h"
 #include "stardust/input/mouse/MouseCodes.h"
 #include "stardust/input/mouse/MouseState.h"
+#include "stardust/input/recording/InputRecording.h"
 #include "stardust/input/touch/TouchDevice.h"
 #include "stardust/input/InputController.h"
 #include "stardust/input/InputManager.h"
@@ -120,7 +131,9 @@
 #include "stardust/physics/geometry/Rectangle.h"
 #include "stardust/physics/world/World.h"
 #include "stardust/physics/AABB.h"
+#include "stardust/physics/ContactEvent.h"
 #include "stardust/physics/Physics.h"
+#include "stardust/physics/Queries.h"
 #include "stardust/physics/RaycastHit.h"
 
 #include "stardust/preferences/ControlPrefs.h"
@@ -129,10 +142,14 @@
 #include "stardust/scene/layer/Layer.h"
 #include "stardust/scene/layer/LayerStack.h"
 #include "stardust/scene/resources/GlobalResources.h"
+#include "stardust/scene/resources/ResourceKey.h"
 #include "stardust/scene/Scene.h"
 #include "stardust/scene/SceneManager.h"
 
 #include "stardust/scripting/ScriptEngine.h"
+#include "stardust/scripting/ScriptFloatArray.h"
+#include "stardust/scripting/ScriptStatePool.h"
+#include "stardust/scripting/ScriptTransformView.h"
 
 #include "stardust/task/AsyncTask.h"
 
@@ -162,11 +179,14 @@
 #include "stardust/types/Primitives.h"
 
 #include "stardust/ui/Canvas.h"
+#include "stardust/ui/HitTestTree.h"
+#include "stardust/ui/Style.h"
 #include "stardust/ui/UI.h"
 #include "stardust/ui/UIComponent.h"
 
 #include "stardust/utility/error_handling/Status.h"
 #include "stardust/utility/error_handling/Result.h"
+#include "stardust/utility/hash/Hash.h"
 #include "stardust/utility/interfaces/INoncopyable.h"
 #include "stardust/utility/interfaces/INonmovable.h"
 #include "stardust/utility/message_box/MessageBox.h"
@@ -16,6 +16,7 @@
 
 #include "stardust/application/events/Events.h"
 #include "stardust/application/events/GlobalEventHandler.h"
+#include "stardust/assets/AssetLoader.h"
 #include "stardust/audio/SoundSystem.h"
 #include "stardust/audio/volume/VolumeManager.h"
 #include "stardust/camera/Camera2D.h"
@@ -28,6 +29,7 @@
 #include "stardust/preferences/ControlPrefs.h"
 #include "stardust/preferences/UserPrefs.h"
 #include "stardust/scripting/ScriptEngine.h"
+#include "stardust/scripting/ScriptStatePool.h"
 #include "stardust/scene/resources/GlobalResources.h"
 #include "stardust/scene/SceneManager.h"
 #include "stardust/time/timestep/TimestepController.h"
@@ -101,6 +103,30 @@ namespace stardust
                 u32 velocityIterations;
             } physicsInfo;
 
+            struct AssetInfo final
+            {
+                u32 loaderThreadCount;
+                f32 uploadBudgetPerFrame;
+            } assetInfo;
+
+            struct ScriptInfo final
+            {
+                String bytecodeCacheRelativeDirectory;
+                bool isPrecompiledScriptLoadingEnabled;
+                u32 workerStateCount;
+
+                ScriptEngine::GarbageCollectionMode garbageCollectionMode;
+                f64 targetFrameTime;
+            } scriptInfo;
+
+            struct InputRecordingInfo final
+            {
+                String recordingFilepath;
+                String replayFilepath;
+
+                String frameTimesFilepath;
+            } inputRecordingInfo;
+
             const char* argv0;
 
             Optional<InitialiseCallback> initialiseCallback;
@@ -108,6 +134,14 @@ namespace stardust
         };
 
     private:
+        struct FrameSample final
+        {
+            f64 frameTime;
+
+            f64 scriptGarbageCollectionTime;
+            usize scriptHeapSize;
+        };
+
         bool m_didInitialiseSuccessfully = false;
 
         UserPrefs m_userPrefs;
@@ -125,6 +159,8 @@ namespace stardust
         audio::SoundSystem m_soundSystem;
         audio::VolumeManager m_volumeManager;
 
+        AssetLoader m_assetLoader;
+
         std::atomic_bool m_isRunning = true;
         Queue<events::UserEvent> m_userEvents{ };
 
@@ -134,10 +170,16 @@ namespace stardust
         InputController m_inputController;
         InputManager m_inputManager;
 
+        String m_inputRecordingFilepath{ };
+        String m_frameTimesFilepath{ };
+        List<FrameSample> m_replayFrameSamples{ };
+
         SceneManager m_sceneManager;
         EntityRegistry m_entityRegistry;
         GlobalResources m_globalSceneResources{ };
         ScriptEngine m_scriptEngine;
+        ScriptStatePool m_scriptStatePool;
+        f64 m_scriptTargetFrameTime = 0.0;
 
         Optional<InitialiseCallback> m_onInitialise = None;
         Optional<ExitCallback> m_onExit = None;
@@ -184,6 +226,9 @@ namespace stardust
         [[nodiscard]] inline auto GetVolumeManager() noexcept -> audio::VolumeManager& { return m_volumeManager; }
         [[nodiscard]] inline auto GetVolumeManager() const noexcept -> const audio::VolumeManager& { return m_volumeManager; }
 
+        [[nodiscard]] inline auto GetAssetLoader() noexcept -> AssetLoader& { return m_assetLoader; }
+        [[nodiscard]] inline auto GetAssetLoader() const noexcept -> const AssetLoader& { return m_assetLoader; }
+
         [[nodiscard]] inline auto GetInputController() const noexcept -> const InputController& { return m_inputController; }
         [[nodiscard]] inline auto GetInputManager() noexcept -> InputManager& { return m_inputManager; }
         [[nodiscard]] inline auto GetInputManager() const noexcept -> const InputManager& { return m_inputManager; }
@@ -196,6 +241,8 @@ namespace stardust
         [[nodiscard]] inline auto GetGlobalSceneResources() const noexcept -> const GlobalResources& { return m_globalSceneResources; }
         [[nodiscard]] inline auto GetScriptEngine() noexcept -> ScriptEngine& { return m_scriptEngine; }
         [[nodiscard]] inline auto GetScriptEngine() const noexcept -> const ScriptEngine& { return m_scriptEngine; }
+        [[nodiscard]] inline auto GetScriptStatePool() noexcept -> ScriptStatePool& { return m_scriptStatePool; }
+        [[nodiscard]] inline auto GetScriptStatePool() const noexcept -> const ScriptStatePool& { return m_scriptStatePool; }
 
         [[nodiscard]] inline auto GetTimestepController() noexcept -> TimestepController& { return m_timestepController; }
         [[nodiscard]] inline auto GetTimestepController() const noexcept -> const TimestepController& { return m_timestepController; }
@@ -213,6 +260,7 @@ namespace stardust
         [[nodiscard]] auto InitialiseGraphics(const CreateInfo&) -> Status;
         [[nodiscard]] auto InitialiseRenderer(const CreateInfo& createInfo) -> Status;
         [[nodiscard]] auto InitialiseAudio(const CreateInfo&) -> Status;
+        [[nodiscard]] auto InitialiseAssetLoader(const CreateInfo& createInfo) -> Status;
         [[nodiscard]] auto InitialiseScriptEngine(const CreateInfo&) -> Status;
         [[nodiscard]] auto InitialisePhysics(const CreateInfo& createInfo) -> Status;
         [[nodiscard]] auto InitialiseInput(const CreateInfo& createInfo) -> Status;
@@ -224,8 +272,12 @@ namespace stardust
         auto Update() -> void;
         auto PostUpdate() -> void;
         auto Render() -> void;
+        auto CollectScriptGarbage(const f64 frameTime) -> void;
+
+        auto FinishInputRecording() -> void;
 
         auto PollEvents(SDL_Event& event) -> void;
+        auto ProcessEvent(const SDL_Event& event) -> void;
         auto ProcessWindowEvent(const SDL_WindowEvent& windowEvent) -> void;
 
         auto UpdateSceneQueue() -> void;
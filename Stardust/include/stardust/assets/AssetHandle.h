@@ -0,0 +1,54 @@
+#pragma once
+#ifndef STARDUST_ASSET_HANDLE_H
+#define STARDUST_ASSET_HANDLE_H
+
+#include <functional>
+#include <limits>
+
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    template <typename T>
+    class AssetHandle final
+    {
+    public:
+        using Index = u32;
+        using Generation = u32;
+
+        static constexpr Index InvalidIndex = std::numeric_limits<Index>::max();
+
+    private:
+        Index m_index = InvalidIndex;
+        Generation m_generation = 0u;
+
+    public:
+        constexpr AssetHandle() noexcept = default;
+
+        constexpr AssetHandle(const Index index, const Generation generation) noexcept
+            : m_index(index), m_generation(generation)
+        { }
+
+        [[nodiscard]] constexpr auto IsValid() const noexcept -> bool { return m_index != InvalidIndex; }
+
+        [[nodiscard]] constexpr auto GetIndex() const noexcept -> Index { return m_index; }
+        [[nodiscard]] constexpr auto GetGeneration() const noexcept -> Generation { return m_generation; }
+
+        [[nodiscard]] constexpr auto operator ==(const AssetHandle&) const noexcept -> bool = default;
+        [[nodiscard]] constexpr auto operator !=(const AssetHandle&) const noexcept -> bool = default;
+    };
+}
+
+namespace std
+{
+    template <typename T>
+    struct hash<stardust::AssetHandle<T>> final
+    {
+        [[nodiscard]] auto operator ()(const stardust::AssetHandle<T>& handle) const noexcept -> stardust::usize
+        {
+            return std::hash<stardust::u64>()((static_cast<stardust::u64>(handle.GetGeneration()) << 32u) | static_cast<stardust::u64>(handle.GetIndex()));
+        }
+    };
+}
+
+#endif
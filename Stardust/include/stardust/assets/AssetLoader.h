@@ -0,0 +1,121 @@
+#pragma once
+#ifndef STARDUST_ASSET_LOADER_H
+#define STARDUST_ASSET_LOADER_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+#include "stardust/utility/interfaces/INonmovable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    enum class AssetLoadState
+        : u8
+    {
+        Pending,
+        Loaded,
+        Failed,
+    };
+
+    class AssetRequest final
+    {
+    private:
+        String m_name;
+        SharedPointer<std::atomic<AssetLoadState>> m_state = nullptr;
+
+    public:
+        AssetRequest() = default;
+        AssetRequest(const String& name, const SharedPointer<std::atomic<AssetLoadState>>& state);
+        ~AssetRequest() noexcept = default;
+
+        [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_state != nullptr; }
+
+        [[nodiscard]] auto GetState() const noexcept -> AssetLoadState;
+        [[nodiscard]] inline auto IsPending() const noexcept -> bool { return GetState() == AssetLoadState::Pending; }
+        [[nodiscard]] inline auto IsLoaded() const noexcept -> bool { return GetState() == AssetLoadState::Loaded; }
+        [[nodiscard]] inline auto HasFailed() const noexcept -> bool { return GetState() == AssetLoadState::Failed; }
+
+        [[nodiscard]] inline auto GetName() const noexcept -> const String& { return m_name; }
+    };
+
+    class AssetLoader final
+        : private INoncopyable, private INonmovable
+    {
+    public:
+        using Task = std::function<auto() -> void>;
+
+        static constexpr f32 DefaultUploadBudgetPerFrame = 0.004f;
+
+    private:
+        struct QueuedTask final
+        {
+            Task task;
+            Task onCancel;
+        };
+
+        List<std::jthread> m_workerThreads{ };
+
+        std::mutex m_backgroundTaskMutex;
+        std::condition_variable_any m_backgroundTaskCondition;
+        Queue<QueuedTask> m_backgroundTasks{ };
+
+        std::mutex m_mainThreadTaskMutex;
+        std::condition_variable_any m_mainThreadTaskCondition;
+        Queue<QueuedTask> m_mainThreadTasks{ };
+
+        std::atomic<u32> m_requestedAssetCount = 0u;
+        std::atomic<u32> m_finishedAssetCount = 0u;
+
+        f32 m_uploadBudgetPerFrame = DefaultUploadBudgetPerFrame;
+
+    public:
+        [[nodiscard]] static auto GetDefaultWorkerCount() noexcept -> u32;
+
+        AssetLoader() = default;
+        explicit AssetLoader(const u32 workerCount);
+        ~AssetLoader() noexcept;
+
+        auto Initialise(const u32 workerCount) -> void;
+        auto Shutdown() -> void;
+
+        [[nodiscard]] inline auto IsValid() const noexcept -> bool { return !m_workerThreads.empty(); }
+        [[nodiscard]] inline auto GetWorkerCount() const noexcept -> u32 { return static_cast<u32>(m_workerThreads.size()); }
+
+        auto SubmitBackgroundTask(Task&& task, Task&& onCancel = nullptr) -> void;
+        auto SubmitMainThreadTask(Task&& task, Task&& onCancel = nullptr) -> void;
+
+        auto Update() -> u32;
+        auto Update(const f32 uploadBudget) -> u32;
+        auto Flush() -> void;
+
+        auto BeginRequest() noexcept -> void;
+        auto FinishRequest() -> void;
+
+        [[nodiscard]] inline auto GetRequestedAssetCount() const noexcept -> u32 { return m_requestedAssetCount.load(std::memory_order::acquire); }
+        [[nodiscard]] inline auto GetFinishedAssetCount() const noexcept -> u32 { return m_finishedAssetCount.load(std::memory_order::acquire); }
+        [[nodiscard]] inline auto GetPendingAssetCount() const noexcept -> u32 { return GetRequestedAssetCount() - GetFinishedAssetCount(); }
+        [[nodiscard]] inline auto IsIdle() const noexcept -> bool { return GetPendingAssetCount() == 0u; }
+
+        [[nodiscard]] auto GetProgress() const noexcept -> f32;
+        auto ResetProgress() noexcept -> void;
+
+        [[nodiscard]] inline auto GetUploadBudgetPerFrame() const noexcept -> f32 { return m_uploadBudgetPerFrame; }
+        inline auto SetUploadBudgetPerFrame(const f32 uploadBudget) noexcept -> void { m_uploadBudgetPerFrame = uploadBudget; }
+
+    private:
+        auto RunWorkerThread(const std::stop_token stopToken) -> void;
+        static auto RunTask(QueuedTask& queuedTask) -> void;
+        static auto CancelTasks(Queue<QueuedTask>& tasks) -> void;
+    };
+}
+
+#endif
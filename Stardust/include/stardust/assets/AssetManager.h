@@ -2,38 +2,364 @@
 #ifndef STARDUST_ASSET_MANAGER_H
 #define STARDUST_ASSET_MANAGER_H
 
+#include <atomic>
+#include <concepts>
+#include <functional>
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "stardust/assets/AssetHandle.h"
+#include "stardust/assets/AssetLoader.h"
+#include "stardust/filesystem/vfs/VirtualFilesystem.h"
 #include "stardust/types/Containers.h"
 #include "stardust/types/Pointers.h"
 #include "stardust/types/Primitives.h"
+#include "stardust/utility/error_handling/Status.h"
 
 namespace stardust
 {
     template <typename T>
     class AssetManager final
     {
+    public:
+        using Handle = AssetHandle<T>;
+        using Reloader = std::function<auto() -> UniquePointer<T>>;
+
     private:
+        struct AssetSlot final
+        {
+            ObserverPointer<T> asset = nullptr;
+            String name;
+            typename Handle::Generation generation = 0u;
+
+            u32 referenceCount = 0u;
+
+            String watchedFilepath;
+            Optional<i64> lastModifiedTime = None;
+            Reloader reloader = nullptr;
+        };
+
         HashMap<String, UniquePointer<T>> m_assets{ };
         Optional<UniquePointer<T>> m_defaultAsset = None;
 
+        HashMap<String, typename Handle::Index> m_slotIndices{ };
+        List<AssetSlot> m_slots{ };
+        List<typename Handle::Index> m_freeSlotIndices{ };
+
+        SharedPointer<ObserverPointer<AssetManager>> m_loadTarget = nullptr;
+
     public:
+        AssetManager() = default;
+
+        AssetManager(AssetManager&& other) noexcept
+            : m_assets(std::move(other.m_assets)), m_defaultAsset(std::move(other.m_defaultAsset)),
+              m_slotIndices(std::move(other.m_slotIndices)), m_slots(std::move(other.m_slots)), m_freeSlotIndices(std::move(other.m_freeSlotIndices)),
+              m_loadTarget(std::move(other.m_loadTarget))
+        {
+            if (m_loadTarget != nullptr)
+            {
+                *m_loadTarget = this;
+            }
+        }
+
+        auto operator =(AssetManager&& other) noexcept -> AssetManager&
+        {
+            DetachLoadTarget();
+
+            m_assets = std::move(other.m_assets);
+            m_defaultAsset = std::move(other.m_defaultAsset);
+            m_slotIndices = std::move(other.m_slotIndices);
+            m_slots = std::move(other.m_slots);
+            m_freeSlotIndices = std::move(other.m_freeSlotIndices);
+            m_loadTarget = std::move(other.m_loadTarget);
+
+            if (m_loadTarget != nullptr)
+            {
+                *m_loadTarget = this;
+            }
+
+            return *this;
+        }
+
+        ~AssetManager() noexcept
+        {
+            DetachLoadTarget();
+        }
+
         template <typename... Args>
             requires std::is_constructible_v<T, Args...>
-        inline auto Add(const String& name, Args&&... args) -> void
+        inline auto Add(const String& name, Args&&... args) -> Handle
+        {
+            return Insert(name, std::make_unique<T>(std::forward<Args>(args)...));
+        }
+
+        template <typename... Args>
+            requires std::is_constructible_v<T, const String&, const Args&...> && std::is_move_assignable_v<T>
+        auto AddFromFile(const String& name, const String& filepath, const Args&... args) -> Handle
         {
-            m_assets[name] = std::make_unique<T>(std::forward<Args>(args)...);
+            const Handle handle = Insert(name, std::make_unique<T>(filepath, args...));
+
+            Watch(
+                handle,
+                filepath,
+                [filepath, args...]() -> UniquePointer<T>
+                {
+                    return std::make_unique<T>(filepath, args...);
+                }
+            );
+
+            return handle;
+        }
+
+        template <std::invocable Decoder, typename... Args>
+        auto LoadAsync(AssetLoader& loader, const String& name, Decoder&& decoder, Args&&... args) -> AssetRequest
+        {
+            if (m_loadTarget == nullptr)
+            {
+                m_loadTarget = std::make_shared<ObserverPointer<AssetManager>>(this);
+            }
+
+            auto loadState = std::make_shared<std::atomic<AssetLoadState>>(AssetLoadState::Pending);
+            loader.BeginRequest();
+
+            loader.SubmitBackgroundTask(
+                [&loader, name, loadState, loadTarget = WeakPointer<ObserverPointer<AssetManager>>(m_loadTarget), decoder = std::forward<Decoder>(decoder), constructorArguments = std::make_tuple(std::forward<Args>(args)...)]() mutable
+                {
+                    auto decodedData = UnwrapDecodedData(std::invoke(decoder));
+
+                    if (decodedData == nullptr)
+                    {
+                        FailRequest(loader, *loadState);
+
+                        return;
+                    }
+
+                    loader.SubmitMainThreadTask(
+                        [&loader, name = std::move(name), loadState, loadTarget, decodedData = std::move(decodedData), constructorArguments = std::move(constructorArguments)]
+                        {
+                            const auto targetManager = loadTarget.lock();
+                            bool didLoad = false;
+
+                            if (targetManager != nullptr && *targetManager != nullptr)
+                            {
+                                auto asset = std::apply(
+                                    [&decodedData](const auto&... arguments) { return std::make_unique<T>(std::move(*decodedData), arguments...); },
+                                    constructorArguments
+                                );
+
+                                if constexpr (requires { { asset->IsValid() } -> std::convertible_to<bool>; })
+                                {
+                                    didLoad = asset->IsValid();
+                                }
+                                else
+                                {
+                                    didLoad = true;
+                                }
+
+                                if (didLoad)
+                                {
+                                    [[maybe_unused]] const Handle handle = (*targetManager)->Insert(name, std::move(asset));
+                                }
+                            }
+
+                            loadState->store(didLoad ? AssetLoadState::Loaded : AssetLoadState::Failed, std::memory_order::release);
+                            loader.FinishRequest();
+                        },
+                        [&loader, loadState] { FailRequest(loader, *loadState); }
+                    );
+                },
+                [&loader, loadState] { FailRequest(loader, *loadState); }
+            );
+
+            return AssetRequest(name, loadState);
         }
 
         [[nodiscard]] inline auto Has(const String& name) -> bool { return m_assets.contains(name); }
+        [[nodiscard]] inline auto Has(const Handle handle) const noexcept -> bool { return IsHandleValid(handle); }
+
+        auto Remove(const String& name) -> void
+        {
+            if (const auto slotIndexLocation = m_slotIndices.find(name);
+                slotIndexLocation != std::cend(m_slotIndices))
+            {
+                FreeSlot(slotIndexLocation->second);
+                m_slotIndices.erase(slotIndexLocation);
+            }
+
+            m_assets.erase(name);
+        }
+
+        auto Remove(const Handle handle) -> void
+        {
+            if (IsHandleValid(handle))
+            {
+                const String name = m_slots[handle.GetIndex()].name;
+                Remove(name);
+            }
+        }
+
+        auto Clear() -> void
+        {
+            for (typename Handle::Index slotIndex = 0u; slotIndex < static_cast<typename Handle::Index>(m_slots.size()); ++slotIndex)
+            {
+                if (m_slots[slotIndex].asset != nullptr)
+                {
+                    FreeSlot(slotIndex);
+                }
+            }
 
-        inline auto Remove(const String& name) -> void { m_assets.erase(name); }
-        inline auto Clear() -> void { m_assets.clear(); }
+            m_slotIndices.clear();
+            m_assets.clear();
+        }
 
         [[nodiscard]] inline auto GetAssetCount() const noexcept -> u32 { return static_cast<u32>(m_assets.size()); }
 
+        [[nodiscard]] auto GetHandle(const String& name) const -> Handle
+        {
+            const auto slotIndexLocation = m_slotIndices.find(name);
+
+            if (slotIndexLocation == std::cend(m_slotIndices))
+            {
+                return Handle{ };
+            }
+
+            return Handle(slotIndexLocation->second, m_slots[slotIndexLocation->second].generation);
+        }
+
+        [[nodiscard]] auto GetName(const Handle handle) const -> Optional<String>
+        {
+            if (!IsHandleValid(handle))
+            {
+                return None;
+            }
+
+            return m_slots[handle.GetIndex()].name;
+        }
+
+        [[nodiscard]] auto Acquire(const String& name) -> Handle
+        {
+            const Handle handle = GetHandle(name);
+            AddReference(handle);
+
+            return handle;
+        }
+
+        auto AddReference(const Handle handle) noexcept -> void
+        {
+            if (IsHandleValid(handle))
+            {
+                ++m_slots[handle.GetIndex()].referenceCount;
+            }
+        }
+
+        auto Release(const Handle handle) noexcept -> void
+        {
+            if (IsHandleValid(handle) && m_slots[handle.GetIndex()].referenceCount > 0u)
+            {
+                --m_slots[handle.GetIndex()].referenceCount;
+            }
+        }
+
+        [[nodiscard]] auto GetReferenceCount(const Handle handle) const noexcept -> u32
+        {
+            return IsHandleValid(handle)
+                ? m_slots[handle.GetIndex()].referenceCount
+                : 0u;
+        }
+
+        auto RemoveUnreferenced() -> u32
+        {
+            List<String> unreferencedAssetNames{ };
+
+            for (const AssetSlot& slot : m_slots)
+            {
+                if (slot.asset != nullptr && slot.referenceCount == 0u)
+                {
+                    unreferencedAssetNames.push_back(slot.name);
+                }
+            }
+
+            for (const String& name : unreferencedAssetNames)
+            {
+                Remove(name);
+            }
+
+            return static_cast<u32>(unreferencedAssetNames.size());
+        }
+
+        auto Watch(const Handle handle, const String& filepath, const Reloader& reloader) -> void
+            requires std::is_move_assignable_v<T>
+        {
+            if (!IsHandleValid(handle))
+            {
+                return;
+            }
+
+            AssetSlot& slot = m_slots[handle.GetIndex()];
+
+            slot.watchedFilepath = filepath;
+            slot.lastModifiedTime = vfs::GetLastModifiedTime(filepath);
+            slot.reloader = reloader;
+        }
+
+        auto Unwatch(const Handle handle) -> void
+        {
+            if (IsHandleValid(handle))
+            {
+                AssetSlot& slot = m_slots[handle.GetIndex()];
+
+                slot.watchedFilepath.clear();
+                slot.lastModifiedTime = None;
+                slot.reloader = nullptr;
+            }
+        }
+
+        [[nodiscard]] auto IsWatched(const Handle handle) const noexcept -> bool
+        {
+            return IsHandleValid(handle) && m_slots[handle.GetIndex()].reloader != nullptr;
+        }
+
+        [[nodiscard]] auto Reload(const Handle handle) -> Status
+        {
+            if (!IsWatched(handle))
+            {
+                return Status::Fail;
+            }
+
+            return ReloadSlot(m_slots[handle.GetIndex()]);
+        }
+
+        auto ReloadChangedAssets() -> u32
+        {
+            u32 reloadedAssetCount = 0u;
+
+            for (AssetSlot& slot : m_slots)
+            {
+                if (slot.asset == nullptr || slot.reloader == nullptr)
+                {
+                    continue;
+                }
+
+                const Optional<i64> lastModifiedTime = vfs::GetLastModifiedTime(slot.watchedFilepath);
+
+                if (!lastModifiedTime.has_value() || lastModifiedTime == slot.lastModifiedTime)
+                {
+                    continue;
+                }
+
+                slot.lastModifiedTime = lastModifiedTime;
+
+                if (ReloadSlot(slot) == Status::Success)
+                {
+                    ++reloadedAssetCount;
+                }
+            }
+
+            return reloadedAssetCount;
+        }
+
         [[nodiscard]] auto Get(const String& name) -> T&
         {
             const auto assetLocation = m_assets.find(name);
@@ -58,8 +384,38 @@ namespace stardust
             return *assetLocation->second;
         }
 
+        [[nodiscard]] inline auto Get(const Handle handle) -> T&
+        {
+            return IsHandleValid(handle)
+                ? *m_slots[handle.GetIndex()].asset
+                : *m_defaultAsset.value();
+        }
+
+        [[nodiscard]] inline auto Get(const Handle handle) const -> const T&
+        {
+            return IsHandleValid(handle)
+                ? *m_slots[handle.GetIndex()].asset
+                : *m_defaultAsset.value();
+        }
+
+        [[nodiscard]] inline auto TryGet(const Handle handle) noexcept -> ObserverPointer<T>
+        {
+            return IsHandleValid(handle)
+                ? m_slots[handle.GetIndex()].asset
+                : nullptr;
+        }
+
+        [[nodiscard]] inline auto TryGet(const Handle handle) const noexcept -> ObserverPointer<const T>
+        {
+            return IsHandleValid(handle)
+                ? m_slots[handle.GetIndex()].asset
+                : nullptr;
+        }
+
         [[nodiscard]] inline auto operator [](const String& name) -> T& { return Get(name); }
         [[nodiscard]] inline auto operator [](const String& name) const -> const T& { return Get(name); }
+        [[nodiscard]] inline auto operator [](const Handle handle) -> T& { return Get(handle); }
+        [[nodiscard]] inline auto operator [](const Handle handle) const -> const T& { return Get(handle); }
 
         [[nodiscard]] inline auto HasDefault() const noexcept -> bool { return m_defaultAsset.has_value(); }
         [[nodiscard]] inline auto GetDefault() -> Optional<UniquePointer<T>>& { return m_defaultAsset; }
@@ -88,6 +444,158 @@ namespace stardust
                 co_yield *asset;
             }
         }
+
+    private:
+        [[nodiscard]] inline auto IsHandleValid(const Handle handle) const noexcept -> bool
+        {
+            return handle.GetIndex() < m_slots.size()
+                && m_slots[handle.GetIndex()].generation == handle.GetGeneration()
+                && m_slots[handle.GetIndex()].asset != nullptr;
+        }
+
+        auto Insert(const String& name, UniquePointer<T>&& asset) -> Handle
+        {
+            if (const auto slotIndexLocation = m_slotIndices.find(name);
+                slotIndexLocation != std::cend(m_slotIndices))
+            {
+                AssetSlot& slot = m_slots[slotIndexLocation->second];
+                ReplaceAsset(slot, std::move(asset));
+
+                return Handle(slotIndexLocation->second, slot.generation);
+            }
+
+            typename Handle::Index slotIndex = 0u;
+
+            if (!m_freeSlotIndices.empty())
+            {
+                slotIndex = m_freeSlotIndices.back();
+                m_freeSlotIndices.pop_back();
+            }
+            else
+            {
+                slotIndex = static_cast<typename Handle::Index>(m_slots.size());
+                m_slots.emplace_back();
+            }
+
+            AssetSlot& slot = m_slots[slotIndex];
+            slot.asset = asset.get();
+            slot.name = name;
+
+            m_assets[name] = std::move(asset);
+            m_slotIndices[name] = slotIndex;
+
+            return Handle(slotIndex, slot.generation);
+        }
+
+        auto ReplaceAsset(AssetSlot& slot, UniquePointer<T>&& asset) -> void
+        {
+            UniquePointer<T>& currentAsset = m_assets[slot.name];
+
+            if constexpr (requires { currentAsset->StopAll(); })
+            {
+                if (currentAsset != nullptr)
+                {
+                    currentAsset->StopAll();
+                }
+            }
+
+            if constexpr (std::is_move_assignable_v<T>)
+            {
+                if (currentAsset != nullptr)
+                {
+                    *currentAsset = std::move(*asset);
+                    slot.asset = currentAsset.get();
+
+                    return;
+                }
+            }
+
+            slot.asset = asset.get();
+            currentAsset = std::move(asset);
+        }
+
+        [[nodiscard]] auto ReloadSlot(AssetSlot& slot) -> Status
+        {
+            UniquePointer<T> reloadedAsset = slot.reloader();
+
+            if (reloadedAsset == nullptr)
+            {
+                return Status::Fail;
+            }
+
+            if constexpr (requires { { reloadedAsset->IsValid() } -> std::convertible_to<bool>; })
+            {
+                if (!reloadedAsset->IsValid())
+                {
+                    return Status::Fail;
+                }
+            }
+
+            ReplaceAsset(slot, std::move(reloadedAsset));
+
+            return Status::Success;
+        }
+
+        auto FreeSlot(const typename Handle::Index slotIndex) -> void
+        {
+            AssetSlot& slot = m_slots[slotIndex];
+
+            slot.asset = nullptr;
+            slot.name.clear();
+            ++slot.generation;
+
+            slot.referenceCount = 0u;
+
+            slot.watchedFilepath.clear();
+            slot.lastModifiedTime = None;
+            slot.reloader = nullptr;
+
+            m_freeSlotIndices.push_back(slotIndex);
+        }
+
+        template <typename DecodeResult>
+        [[nodiscard]] static auto UnwrapDecodedData(DecodeResult&& decodeResult)
+        {
+            if constexpr (requires { decodeResult.has_value(); decodeResult.value(); })
+            {
+                using DecodedData = std::remove_cvref_t<decltype(decodeResult.value())>;
+
+                return decodeResult.has_value()
+                    ? std::make_shared<DecodedData>(std::move(decodeResult).value())
+                    : nullptr;
+            }
+            else if constexpr (requires { decodeResult.is_ok(); std::move(decodeResult).unwrap(); })
+            {
+                using DecodedData = std::remove_cvref_t<decltype(std::move(decodeResult).unwrap())>;
+
+                return decodeResult.is_ok()
+                    ? std::make_shared<DecodedData>(std::move(decodeResult).unwrap())
+                    : nullptr;
+            }
+            else
+            {
+                using DecodedData = std::remove_cvref_t<DecodeResult>;
+
+                return static_cast<bool>(decodeResult)
+                    ? std::make_shared<DecodedData>(std::forward<DecodeResult>(decodeResult))
+                    : nullptr;
+            }
+        }
+
+        static auto FailRequest(AssetLoader& loader, std::atomic<AssetLoadState>& loadState) -> void
+        {
+            loadState.store(AssetLoadState::Failed, std::memory_order::release);
+            loader.FinishRequest();
+        }
+
+        auto DetachLoadTarget() noexcept -> void
+        {
+            if (m_loadTarget != nullptr)
+            {
+                *m_loadTarget = nullptr;
+                m_loadTarget = nullptr;
+            }
+        }
     };
 }
 
@@ -21,6 +21,10 @@ namespace stardust
 
         constexpr VoiceHandle InvalidVoiceHandle = std::numeric_limits<VoiceHandle>::max();
 
+        using VoiceGroup = u64;
+
+        constexpr VoiceGroup NoVoiceGroup = 0u;
+
         enum class AttenuationModel
             : std::underlying_type_t<SoLoud::AudioSource::ATTENUATION_MODELS>
         {
@@ -56,6 +60,9 @@ namespace stardust
             bool startPaused = false;
 
             bool protect = false;
+
+            i32 priority = 0;
+            VoiceGroup voiceGroup = NoVoiceGroup;
         };
 
         struct PositionalSoundPlayData final
@@ -73,6 +80,9 @@ namespace stardust
             bool startPaused = false;
 
             bool protect = false;
+
+            i32 priority = 0;
+            VoiceGroup voiceGroup = NoVoiceGroup;
         };
 
         constexpr f32 DefaultVolume = -1.0f;
@@ -26,6 +26,8 @@ namespace stardust
             HashMap<String, List<Variant<ObserverPointer<Sound>, ObserverPointer<SoundStream>>>> m_soundCues{ };
 
         public:
+            [[nodiscard]] static auto GetCueVoiceGroup(const String& cueName) -> VoiceGroup;
+
             auto Initialise(SoundSystem& soundSystem, const VolumeManager& volumeManager) -> void;
 
             auto PlayCue(const String& cueName, const SoundPlayData soundPlayData = SoundPlayData{ }, const ObserverPointer<MixingBus> mixingBus = nullptr) const -> SoundSource;
@@ -44,6 +46,9 @@ namespace stardust
             [[nodiscard]] inline auto DoesCueExist(const String& cueName) const -> bool { return m_soundCues.contains(cueName); }
             inline auto RemoveCue(const String& cueName) -> void { m_soundCues.erase(cueName); }
 
+            [[nodiscard]] auto GetCueVoiceLimit(const String& cueName) const -> u32;
+            auto SetCueVoiceLimit(const String& cueName, const u32 voiceLimit) -> void;
+
             [[nodiscard]] inline auto GetAllCues() const noexcept -> const decltype(m_soundCues)& { return m_soundCues; }
             [[nodiscard]] inline auto GetSoundsInCue(const String& cueName) const -> const List<Variant<ObserverPointer<Sound>, ObserverPointer<SoundStream>>>& { return m_soundCues.at(cueName); }
 
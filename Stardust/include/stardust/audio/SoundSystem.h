@@ -4,6 +4,7 @@
 
 #include "stardust/utility/interfaces/INoncopyable.h"
 
+#include <concepts>
 #include <type_traits>
 
 #include <soloud/soloud.h>
@@ -14,7 +15,9 @@
 #include "stardust/audio/sounds/Sounds.h"
 #include "stardust/audio/source/PositionalSoundSource.h"
 #include "stardust/audio/source/SoundSource.h"
+#include "stardust/audio/voices/VoiceManager.h"
 #include "stardust/audio/Audio.h"
+#include "stardust/ecs/registry/EntityRegistry.h"
 #include "stardust/types/Containers.h"
 #include "stardust/types/Pointers.h"
 #include "stardust/types/Primitives.h"
@@ -29,6 +32,7 @@ namespace stardust
         private:
             UniquePointer<SoLoud::Soloud> m_soLoudHandle = nullptr;
             Listener m_listener;
+            VoiceManager m_voiceManager;
 
             bool m_didInitialiseSuccessfully = false;
             String m_errorString{ };
@@ -46,7 +50,8 @@ namespace stardust
 
             [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_soLoudHandle != nullptr && m_didInitialiseSuccessfully; }
 
-            auto Update() const -> void;
+            auto Update() -> void;
+            auto UpdatePositionalSounds(EntityRegistry& entityRegistry, const f32 deltaTime) -> void;
 
             auto PlaySound(Sound& sound, const SoundPlayData& soundPlayData = SoundPlayData{ }) -> SoundSource;
             auto PlaySound(SoundStream& soundStream, const SoundPlayData& soundPlayData = SoundPlayData{ }) -> SoundSource;
@@ -82,14 +87,37 @@ namespace stardust
             [[nodiscard]] inline auto GetListener() noexcept -> Listener& { return m_listener; }
             [[nodiscard]] inline auto GetListener() const noexcept -> const Listener& { return m_listener; }
 
+            [[nodiscard]] inline auto GetVoiceManager() noexcept -> VoiceManager& { return m_voiceManager; }
+            [[nodiscard]] inline auto GetVoiceManager() const noexcept -> const VoiceManager& { return m_voiceManager; }
+
             [[nodiscard]] auto GetRawHandle() noexcept -> SoLoud::Soloud& { return *m_soLoudHandle.get(); }
             [[nodiscard]] auto GetRawHandle() const noexcept -> const SoLoud::Soloud& { return *m_soLoudHandle.get(); }
 
             [[nodiscard]] auto GetErrorString() const noexcept -> const String& { return m_errorString; }
 
         private:
+            [[nodiscard]] auto RequestVoice(const SoundPlayData& soundPlayData, const ObserverPointer<const MixingBus> mixingBus) -> Optional<VoiceRequest>;
+            [[nodiscard]] auto RequestVoice(const PositionalSoundPlayData& soundPlayData, const ObserverPointer<const MixingBus> mixingBus) -> Optional<VoiceRequest>;
+
             auto SetVoiceHandleParameters(const VoiceHandle voiceHandle, const SoundPlayData& soundPlayData) const -> void;
             auto SetVoiceHandleParameters(const VoiceHandle voiceHandle, const PositionalSoundPlayData& soundPlayData) const -> void;
+
+            template <typename PlayData, std::invocable Func>
+            [[nodiscard]] auto PlayVoice(const PlayData& soundPlayData, const ObserverPointer<const MixingBus> mixingBus, const Func& playVoice) -> VoiceHandle
+            {
+                const Optional<VoiceRequest> voiceRequest = RequestVoice(soundPlayData, mixingBus);
+
+                if (!voiceRequest.has_value())
+                {
+                    return InvalidVoiceHandle;
+                }
+
+                const VoiceHandle voiceHandle = playVoice();
+                SetVoiceHandleParameters(voiceHandle, soundPlayData);
+                m_voiceManager.RegisterVoice(voiceHandle, voiceRequest.value());
+
+                return voiceHandle;
+            }
         };
     }
 }
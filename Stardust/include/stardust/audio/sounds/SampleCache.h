@@ -0,0 +1,46 @@
+#pragma once
+#ifndef STARDUST_SAMPLE_CACHE_H
+#define STARDUST_SAMPLE_CACHE_H
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace audio
+    {
+        struct DecodedSamples final
+        {
+            List<f32> samples{ };
+            u32 channelCount = 1u;
+            f32 sampleRate = 44'100.0f;
+
+            u64 contentHash = 0u;
+        };
+
+        enum class SampleCacheFormat
+            : u8
+        {
+            Float32,
+            Int16,
+        };
+
+        namespace sample_cache
+        {
+            extern auto SetDiskCacheDirectory(const StringView directory) -> void;
+            [[nodiscard]] extern auto GetDiskCacheDirectory() -> String;
+            extern auto SetDiskCacheFormat(const SampleCacheFormat format) -> void;
+            [[nodiscard]] extern auto GetDiskCacheFormat() -> SampleCacheFormat;
+
+            [[nodiscard]] extern auto Acquire(const StringView filepath) -> SharedPointer<const DecodedSamples>;
+            extern auto PurgeExpired() -> void;
+            extern auto Clear() -> void;
+
+            [[nodiscard]] extern auto GetCachedSoundCount() -> usize;
+            [[nodiscard]] extern auto GetCachedSampleMemory() -> usize;
+        }
+    }
+}
+
+#endif
@@ -10,12 +10,17 @@
 
 #include <soloud/soloud.h>
 #include <soloud/soloud_audiosource.h>
+#include <soloud/soloud_wav.h>
+#include <soloud/soloud_wavstream.h>
 #undef min
 #undef max
 
+#include "stardust/audio/sounds/SampleCache.h"
+#include "stardust/audio/sounds/VirtualSoundFile.h"
 #include "stardust/audio/Audio.h"
 #include "stardust/filesystem/vfs/VirtualFilesystem.h"
 #include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
 #include "stardust/types/Primitives.h"
 
 namespace stardust
@@ -27,7 +32,11 @@ namespace stardust
             : private INoncopyable
         {
         private:
-            Source m_handle;
+            UniquePointer<VirtualSoundFile> m_streamFile = nullptr;
+            SharedPointer<const DecodedSamples> m_sharedSamples = nullptr;
+            bool m_isUsingSharedSamples = false;
+
+            UniquePointer<Source> m_handle = std::make_unique<Source>();
             bool m_isValid = false;
 
             f64 m_length = 0.0f;
@@ -41,33 +50,132 @@ namespace stardust
                 Initialise(filepath);
             }
 
-            SoundBase(SoundBase&&) noexcept = default;
-            auto operator =(SoundBase&&) noexcept -> SoundBase& = default;
+            explicit SoundBase(SharedPointer<const DecodedSamples> decodedSamples)
+                requires std::is_same_v<Source, SoLoud::Wav>
+            {
+                Initialise(std::move(decodedSamples));
+            }
+
+            SoundBase(SoundBase&& other) noexcept
+                : m_streamFile(std::move(other.m_streamFile)),
+                  m_sharedSamples(std::move(other.m_sharedSamples)),
+                  m_isUsingSharedSamples(std::exchange(other.m_isUsingSharedSamples, false)),
+                  m_handle(std::move(other.m_handle)),
+                  m_isValid(std::exchange(other.m_isValid, false)),
+                  m_length(std::exchange(other.m_length, 0.0)),
+                  m_isSingleInstance(std::exchange(other.m_isSingleInstance, false))
+            { }
+
+            auto operator =(SoundBase&& other) noexcept -> SoundBase&
+            {
+                if (this != &other)
+                {
+                    StopAll();
+                    ReleaseSharedSamples();
+
+                    m_handle = std::move(other.m_handle);
+                    m_streamFile = std::move(other.m_streamFile);
+                    m_sharedSamples = std::move(other.m_sharedSamples);
+                    m_isUsingSharedSamples = std::exchange(other.m_isUsingSharedSamples, false);
+                    m_isValid = std::exchange(other.m_isValid, false);
+                    m_length = std::exchange(other.m_length, 0.0);
+                    m_isSingleInstance = std::exchange(other.m_isSingleInstance, false);
+                }
+
+                return *this;
+            }
 
-            virtual ~SoundBase() noexcept = default;
+            virtual ~SoundBase() noexcept
+            {
+                ReleaseSharedSamples();
+            }
 
             auto Initialise(const StringView filepath) -> void
             {
-                auto rawSoundDataResult = vfs::ReadFileBytes(filepath);
+                if (m_handle == nullptr)
+                {
+                    m_handle = std::make_unique<Source>();
+                }
+
+                if constexpr (std::is_same_v<Source, SoLoud::WavStream>)
+                {
+                    auto streamFile = std::make_unique<VirtualSoundFile>();
 
-                if (rawSoundDataResult.is_err())
+                    if (streamFile->Open(filepath) != Status::Success)
+                    {
+                        return;
+                    }
+
+                    const SoLoud::result loadStatus = m_handle->loadFile(streamFile.get());
+                    m_isValid = loadStatus == 0u;
+
+                    if (m_isValid)
+                    {
+                        m_streamFile = std::move(streamFile);
+                    }
+                }
+                else if constexpr (std::is_same_v<Source, SoLoud::Wav>)
                 {
+                    Initialise(sample_cache::Acquire(filepath));
+
                     return;
                 }
+                else
+                {
+                    auto rawSoundDataResult = vfs::ReadFileBytes(filepath);
+
+                    if (rawSoundDataResult.is_err())
+                    {
+                        return;
+                    }
+
+                    const List<ubyte> rawSoundData = std::move(rawSoundDataResult).unwrap();
+
+                    const SoLoud::result loadStatus = m_handle->loadMem(
+                        reinterpret_cast<const ubyte*>(rawSoundData.data()),
+                        static_cast<u32>(rawSoundData.size()),
+                        true,
+                        false
+                    );
+                    m_isValid = loadStatus == 0u;
+                }
 
-                const List<ubyte> rawSoundData = std::move(rawSoundDataResult).unwrap();
+                if (m_isValid)
+                {
+                    m_length = m_handle->getLength();
+                }
+            }
+
+            auto Initialise(SharedPointer<const DecodedSamples> decodedSamples) -> void
+                requires std::is_same_v<Source, SoLoud::Wav>
+            {
+                if (m_handle == nullptr)
+                {
+                    m_handle = std::make_unique<Source>();
+                }
+
+                if (decodedSamples == nullptr)
+                {
+                    return;
+                }
 
-                const SoLoud::result loadStatus = m_handle.loadMem(
-                    reinterpret_cast<const ubyte*>(rawSoundData.data()),
-                    static_cast<u32>(rawSoundData.size()),
-                    true,
-                    false
+                ReleaseSharedSamples();
+
+                const SoLoud::result loadStatus = m_handle->loadRawWave(
+                    const_cast<f32*>(decodedSamples->samples.data()),
+                    static_cast<u32>(decodedSamples->samples.size()),
+                    decodedSamples->sampleRate,
+                    decodedSamples->channelCount,
+                    false,
+                    true
                 );
                 m_isValid = loadStatus == 0u;
 
                 if (m_isValid)
                 {
-                    m_length = m_handle.getLength();
+                    m_sharedSamples = std::move(decodedSamples);
+                    m_isUsingSharedSamples = true;
+                    m_length = m_handle->getLength();
                 }
             }
 
@@ -75,7 +183,10 @@ namespace stardust
 
             auto StopAll() noexcept -> void
             {
-                m_handle.stop();
+                if (m_handle != nullptr)
+                {
+                    m_handle->stop();
+                }
             }
 
             [[nodiscard]] inline auto GetLength() const noexcept -> f64 { return m_length; }
@@ -84,12 +195,36 @@ namespace stardust
 
             auto SetSingleInstance(const bool isSingleInstance) -> void
             {
-                m_handle.setSingleInstance(isSingleInstance);
+                if (m_handle != nullptr)
+                {
+                    m_handle->setSingleInstance(isSingleInstance);
+                }
+
                 m_isSingleInstance = isSingleInstance;
             }
 
-            [[nodiscard]] inline auto GetRawHandle() noexcept -> Source& { return m_handle; }
-            [[nodiscard]] inline auto GetRawHandle() const noexcept -> const Source& { return m_handle; }
+            [[nodiscard]] inline auto GetSharedSamples() const noexcept -> const SharedPointer<const DecodedSamples>& { return m_sharedSamples; }
+
+            [[nodiscard]] inline auto GetRawHandle() noexcept -> Source& { return *m_handle; }
+            [[nodiscard]] inline auto GetRawHandle() const noexcept -> const Source& { return *m_handle; }
+
+        private:
+            auto ReleaseSharedSamples() noexcept -> void
+            {
+                if constexpr (std::is_same_v<Source, SoLoud::Wav>)
+                {
+                    if (m_isUsingSharedSamples && m_handle != nullptr)
+                    {
+                        m_handle->stop();
+                        m_handle->mData = nullptr;
+                        m_handle->mSampleCount = 0u;
+
+                        m_isUsingSharedSamples = false;
+                    }
+                }
+
+                m_sharedSamples = nullptr;
+            }
         };
     }
 }
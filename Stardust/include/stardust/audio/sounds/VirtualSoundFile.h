@@ -0,0 +1,48 @@
+#pragma once
+#ifndef STARDUST_VIRTUAL_SOUND_FILE_H
+#define STARDUST_VIRTUAL_SOUND_FILE_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+#include "stardust/utility/interfaces/INonmovable.h"
+
+#include <soloud/soloud_file.h>
+#undef min
+#undef max
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/Primitives.h"
+#include "stardust/utility/error_handling/Status.h"
+
+struct PHYSFS_File;
+
+namespace stardust
+{
+    namespace audio
+    {
+        class VirtualSoundFile final
+            : public SoLoud::File, private INoncopyable, private INonmovable
+        {
+        private:
+            PHYSFS_File* m_handle = nullptr;
+            u32 m_length = 0u;
+
+        public:
+            VirtualSoundFile() = default;
+            explicit VirtualSoundFile(const StringView filepath);
+            virtual ~VirtualSoundFile() noexcept override;
+
+            [[nodiscard]] auto Open(const StringView filepath) -> Status;
+            auto Close() noexcept -> void;
+
+            [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_handle != nullptr; }
+
+            [[nodiscard]] virtual auto eof() -> i32 override;
+            [[nodiscard]] virtual auto read(ubyte* destination, const u32 byteCount) -> u32 override;
+            [[nodiscard]] virtual auto length() -> u32 override;
+            virtual auto seek(const i32 offset) -> void override;
+            [[nodiscard]] virtual auto pos() -> u32 override;
+        };
+    }
+}
+
+#endif
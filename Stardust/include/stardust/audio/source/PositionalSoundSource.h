@@ -35,6 +35,8 @@ namespace stardust
             PositionalSoundSource(const VoiceHandle handle, class SoundSystem& soundSystem, const ObserverPointer<class MixingBus> mixingBus = nullptr, const Vector2 position = Vector2Zero, const Vector2 velocity = Vector2Zero);
             ~PositionalSoundSource() noexcept = default;
 
+            [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_soundSystem != nullptr && m_handle != InvalidVoiceHandle; }
+
             auto Pause() const -> void;
             auto Resume() const -> void;
             auto Stop() const noexcept -> void;
@@ -79,6 +81,7 @@ namespace stardust
             auto SetPosition(const Vector2 position) -> void;
             [[nodiscard]] inline auto GetVelocity() const noexcept -> Vector2 { return m_velocity; }
             auto SetVelocity(const Vector2 velocity) -> void;
+            auto SetPositionAndVelocity(const Vector2 position, const Vector2 velocity) -> void;
 
             [[nodiscard]] inline auto GetAttenuationModel() const noexcept -> AttenuationModel { return m_attenuationInfo.model; }
             auto SetAttenuationModel(const AttenuationModel attenuationModel) -> void;
@@ -0,0 +1,116 @@
+#pragma once
+#ifndef STARDUST_VOICE_MANAGER_H
+#define STARDUST_VOICE_MANAGER_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+
+#include <soloud/soloud.h>
+#undef min
+#undef max
+
+#include "stardust/audio/Audio.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/MathTypes.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace audio
+    {
+        struct VoiceRequest final
+        {
+            ObserverPointer<const class MixingBus> mixingBus = nullptr;
+            VoiceGroup voiceGroup = NoVoiceGroup;
+
+            i32 priority = 0;
+            f32 audibility = 1.0f;
+
+            bool isProtected = false;
+        };
+
+        struct VoiceStats final
+        {
+            u64 requestedCount = 0u;
+            u64 startedCount = 0u;
+            u64 culledCount = 0u;
+            u64 stolenCount = 0u;
+        };
+
+        class VoiceManager final
+            : private INoncopyable
+        {
+        public:
+            static constexpr u32 Unlimited = 0u;
+
+        private:
+            struct ActiveVoice final
+            {
+                VoiceHandle handle;
+
+                ObserverPointer<const class MixingBus> mixingBus;
+                VoiceGroup voiceGroup;
+
+                i32 priority;
+                bool isProtected;
+            };
+
+            struct SaturatedScopes final
+            {
+                bool isGlobal = false;
+                bool isMixingBus = false;
+                bool isVoiceGroup = false;
+
+                [[nodiscard]] inline auto IsAny() const noexcept -> bool { return isGlobal || isMixingBus || isVoiceGroup; }
+            };
+
+            List<ActiveVoice> m_activeVoices{ };
+
+            u32 m_maxVoices = Unlimited;
+            HashMap<ObserverPointer<const class MixingBus>, u32> m_mixingBusLimits{ };
+            HashMap<VoiceGroup, u32> m_voiceGroupLimits{ };
+
+            f32 m_minimumAudibility = 0.0f;
+
+            VoiceStats m_stats{ };
+
+        public:
+            [[nodiscard]] static auto EstimateAudibility(const SoundPlayData& soundPlayData) noexcept -> f32;
+            [[nodiscard]] static auto EstimateAudibility(const PositionalSoundPlayData& soundPlayData, const Vector2 listenerPosition) -> f32;
+
+            VoiceManager() = default;
+            VoiceManager(VoiceManager&&) noexcept = default;
+            auto operator =(VoiceManager&&) noexcept -> VoiceManager& = default;
+            ~VoiceManager() noexcept = default;
+
+            [[nodiscard]] auto RequestVoice(SoLoud::Soloud& soLoudHandle, const VoiceRequest& voiceRequest) -> bool;
+            auto RegisterVoice(const VoiceHandle voiceHandle, const VoiceRequest& voiceRequest) -> void;
+
+            auto Update(SoLoud::Soloud& soLoudHandle) -> void;
+            auto Clear() -> void;
+
+            [[nodiscard]] inline auto GetMaxVoices() const noexcept -> u32 { return m_maxVoices; }
+            inline auto SetMaxVoices(const u32 maxVoices) noexcept -> void { m_maxVoices = maxVoices; }
+
+            [[nodiscard]] auto GetMixingBusLimit(const class MixingBus& mixingBus) const -> u32;
+            auto SetMixingBusLimit(const class MixingBus& mixingBus, const u32 voiceLimit) -> void;
+
+            [[nodiscard]] auto GetVoiceGroupLimit(const VoiceGroup voiceGroup) const -> u32;
+            auto SetVoiceGroupLimit(const VoiceGroup voiceGroup, const u32 voiceLimit) -> void;
+
+            [[nodiscard]] inline auto GetMinimumAudibility() const noexcept -> f32 { return m_minimumAudibility; }
+            inline auto SetMinimumAudibility(const f32 minimumAudibility) noexcept -> void { m_minimumAudibility = minimumAudibility; }
+
+            [[nodiscard]] inline auto GetActiveVoiceCount() const noexcept -> usize { return m_activeVoices.size(); }
+
+            [[nodiscard]] inline auto GetStats() const noexcept -> const VoiceStats& { return m_stats; }
+            inline auto ResetStats() noexcept -> void { m_stats = VoiceStats{ }; }
+
+        private:
+            [[nodiscard]] auto FindSaturatedScopes(const VoiceRequest& voiceRequest) const -> SaturatedScopes;
+            [[nodiscard]] auto StealVoice(SoLoud::Soloud& soLoudHandle, const VoiceRequest& voiceRequest, const SaturatedScopes& saturatedScopes) -> bool;
+        };
+    }
+}
+
+#endif
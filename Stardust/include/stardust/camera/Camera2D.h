@@ -3,6 +3,7 @@
 #define STARDUST_CAMERA_2D_H
 
 #include "stardust/math/Math.h"
+#include "stardust/types/Containers.h"
 #include "stardust/types/MathTypes.h"
 #include "stardust/types/Primitives.h"
 
@@ -63,6 +64,7 @@ namespace stardust
         [[nodiscard]] inline auto GetVirtualScreenSize() const noexcept -> const UVector2 { return m_virtualScreenSize; }
 
         [[nodiscard]] auto GetViewMatrix() const noexcept -> Matrix4;
+        [[nodiscard]] auto GetViewBounds() const noexcept -> Pair<Vector2, Vector2>;
         [[nodiscard]] inline auto GetProjectionMatrix() const noexcept -> const Matrix4& { return m_projectionMatrix; }
         [[nodiscard]] inline auto GetScreenProjectionMatrix() const noexcept -> const Matrix4& { return m_screenProjectionMatrix; }
 
@@ -11,6 +11,7 @@ namespace stardust
         struct PositionalSound final
         {
             audio::PositionalSoundSource source;
+            bool followsTransform = true;
         };
     }
 }
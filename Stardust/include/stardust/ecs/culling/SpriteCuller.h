@@ -0,0 +1,65 @@
+#pragma once
+#ifndef STARDUST_SPRITE_CULLER_H
+#define STARDUST_SPRITE_CULLER_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+
+#include "stardust/camera/Camera2D.h"
+#include "stardust/ecs/components/TransformComponent.h"
+#include "stardust/ecs/entity/EntityHandle.h"
+#include "stardust/ecs/registry/EntityRegistry.h"
+#include "stardust/graphics/renderer/Renderer.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/MathTypes.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    class SpriteCuller final
+        : private INoncopyable
+    {
+    public:
+        struct Statistics final
+        {
+            u32 visibleCount = 0u;
+            u32 culledCount = 0u;
+        };
+
+    private:
+        ObserverPointer<EntityRegistry> m_registry = nullptr;
+
+        List<EntityHandle> m_candidateEntities{ };
+        List<f32> m_lowerXBounds{ };
+        List<f32> m_lowerYBounds{ };
+        List<f32> m_upperXBounds{ };
+        List<f32> m_upperYBounds{ };
+        List<u8> m_visibilityFlags{ };
+
+        List<EntityHandle> m_visibleEntities{ };
+        Statistics m_statistics{ };
+
+    public:
+        [[nodiscard]] static auto GetTransformBounds(const components::Transform& transform) noexcept -> Pair<Vector2, Vector2>;
+
+        SpriteCuller() = default;
+        explicit SpriteCuller(EntityRegistry& registry);
+        ~SpriteCuller() noexcept = default;
+
+        inline auto Initialise(EntityRegistry& registry) noexcept -> void { m_registry = &registry; }
+
+        auto Cull(const Camera2D& camera) -> void;
+        auto BatchVisibleSprites(graphics::Renderer& renderer) const -> void;
+
+        [[nodiscard]] inline auto GetVisibleEntities() const noexcept -> const List<EntityHandle>& { return m_visibleEntities; }
+        [[nodiscard]] inline auto GetStatistics() const noexcept -> const Statistics& { return m_statistics; }
+
+        [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_registry != nullptr; }
+
+    private:
+        auto GatherBounds() -> void;
+        auto TestBounds(const Pair<Vector2, Vector2>& viewBounds) -> void;
+    };
+}
+
+#endif
@@ -0,0 +1,124 @@
+#pragma once
+#ifndef STARDUST_SPATIAL_HASH_H
+#define STARDUST_SPATIAL_HASH_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+#include "stardust/utility/interfaces/INonmovable.h"
+
+#include <limits>
+
+#include <entt/entt.hpp>
+
+#include "stardust/ecs/entity/EntityHandle.h"
+#include "stardust/ecs/registry/EntityRegistry.h"
+#include "stardust/physics/AABB.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/MathTypes.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    class SpatialHash final
+        : private INoncopyable, private INonmovable
+    {
+    private:
+        using CellKey = u64;
+
+        struct CellEntry final
+        {
+            EntityHandle entityHandle;
+            Vector2 position;
+        };
+
+        struct EntityLocation final
+        {
+            CellKey cellKey;
+            usize cellIndex;
+
+            Vector2 position;
+        };
+
+        ObserverPointer<EntityRegistry> m_registry = nullptr;
+
+        f32 m_cellSize = 1.0f;
+
+        HashMap<CellKey, List<CellEntry>> m_cells{ };
+        HashMap<EntityHandle, EntityLocation> m_entityLocations{ };
+
+    public:
+        SpatialHash() = default;
+        SpatialHash(EntityRegistry& registry, const f32 cellSize);
+        ~SpatialHash() noexcept;
+
+        auto Initialise(EntityRegistry& registry, const f32 cellSize) -> void;
+
+        auto Update() -> void;
+        auto Rebuild() -> void;
+        auto Clear() -> void;
+
+        auto Refresh(const EntityHandle entityHandle) -> void;
+        auto Remove(const EntityHandle entityHandle) -> void;
+
+        [[nodiscard]] auto QueryRadius(const Vector2 centre, const f32 radius) const -> List<EntityHandle>;
+        auto QueryRadius(const Vector2 centre, const f32 radius, List<EntityHandle>& results) const -> void;
+        [[nodiscard]] auto QueryAABB(const physics::AABB& box) const -> List<EntityHandle>;
+        auto QueryAABB(const physics::AABB& box, List<EntityHandle>& results) const -> void;
+        [[nodiscard]] auto QueryNearest(const Vector2 position, const usize count, const f32 maxDistance = std::numeric_limits<f32>::max()) const -> List<EntityHandle>;
+        auto QueryNearest(const Vector2 position, const usize count, List<EntityHandle>& results, const f32 maxDistance = std::numeric_limits<f32>::max()) const -> void;
+
+        [[nodiscard]] inline auto Contains(const EntityHandle entityHandle) const -> bool { return m_entityLocations.contains(entityHandle); }
+        [[nodiscard]] inline auto GetEntityCount() const noexcept -> usize { return m_entityLocations.size(); }
+        [[nodiscard]] inline auto GetCellCount() const noexcept -> usize { return m_cells.size(); }
+        [[nodiscard]] inline auto GetCellSize() const noexcept -> f32 { return m_cellSize; }
+
+        [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_registry != nullptr; }
+
+    private:
+        [[nodiscard]] auto GetCellCoordinates(const Vector2 position) const -> IVector2;
+        [[nodiscard]] static auto GetCellKey(const IVector2 cellCoordinates) noexcept -> CellKey;
+
+        auto Insert(const EntityHandle entityHandle, const Vector2 position) -> void;
+
+        template <typename Func>
+        auto ForEachCellEntry(const Vector2 lowerBound, const Vector2 upperBound, const Func& func) const -> void
+        {
+            const IVector2 lowerCell = GetCellCoordinates(lowerBound);
+            const IVector2 upperCell = GetCellCoordinates(upperBound);
+
+            const u64 cellRangeCount = static_cast<u64>(upperCell.x - lowerCell.x + 1) * static_cast<u64>(upperCell.y - lowerCell.y + 1);
+
+            if (cellRangeCount > static_cast<u64>(m_cells.size()))
+            {
+                for (const auto& [cellKey, cellEntries] : m_cells)
+                {
+                    for (const auto& cellEntry : cellEntries)
+                    {
+                        func(cellEntry);
+                    }
+                }
+
+                return;
+            }
+
+            for (i32 y = lowerCell.y; y <= upperCell.y; ++y)
+            {
+                for (i32 x = lowerCell.x; x <= upperCell.x; ++x)
+                {
+                    if (const auto cellLocation = m_cells.find(GetCellKey(IVector2{ x, y }));
+                        cellLocation != std::cend(m_cells))
+                    {
+                        for (const auto& cellEntry : cellLocation->second)
+                        {
+                            func(cellEntry);
+                        }
+                    }
+                }
+            }
+        }
+
+        auto OnTransformDestroyed(entt::registry& registry, const EntityHandle entityHandle) -> void;
+    };
+}
+
+#endif
@@ -45,6 +45,7 @@ namespace stardust
         [[nodiscard]] extern auto GetExtension(const StringView filename) -> String;
 
         [[nodiscard]] extern auto CreateDirectory(const StringView path) -> Status;
+        [[nodiscard]] extern auto RemoveFile(const StringView filepath) -> Status;
         [[nodiscard]] extern auto GetDirectorySeparator() -> String;
 
         [[nodiscard]] extern auto ReadFile(const StringView filepath) -> Result<String, FileError>;
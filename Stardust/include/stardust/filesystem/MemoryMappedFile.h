@@ -0,0 +1,44 @@
+#pragma once
+#ifndef STARDUST_MEMORY_MAPPED_FILE_H
+#define STARDUST_MEMORY_MAPPED_FILE_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/Primitives.h"
+#include "stardust/utility/error_handling/Status.h"
+
+namespace stardust
+{
+    namespace filesystem
+    {
+        class MemoryMappedFile final
+            : private INoncopyable
+        {
+        private:
+            const ubyte* m_data = nullptr;
+            usize m_size = 0u;
+
+            void* m_fileHandle = nullptr;
+            void* m_mappingHandle = nullptr;
+
+        public:
+            MemoryMappedFile() = default;
+            explicit MemoryMappedFile(const StringView filepath);
+            MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+            auto operator =(MemoryMappedFile&& other) noexcept -> MemoryMappedFile&;
+            ~MemoryMappedFile() noexcept;
+
+            [[nodiscard]] auto Open(const StringView filepath) -> Status;
+            auto Close() noexcept -> void;
+
+            [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_data != nullptr; }
+
+            [[nodiscard]] inline auto GetData() const noexcept -> const ubyte* { return m_data; }
+            [[nodiscard]] inline auto GetSize() const noexcept -> usize { return m_size; }
+            [[nodiscard]] inline auto GetBytes() const noexcept -> Slice<const ubyte> { return Slice<const ubyte>(m_data, m_size); }
+        };
+    }
+}
+
+#endif
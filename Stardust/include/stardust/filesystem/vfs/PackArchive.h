@@ -0,0 +1,110 @@
+#pragma once
+#ifndef STARDUST_PACK_ARCHIVE_H
+#define STARDUST_PACK_ARCHIVE_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+#include "stardust/utility/interfaces/INonmovable.h"
+
+#include "stardust/filesystem/MemoryMappedFile.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+#include "stardust/utility/error_handling/Status.h"
+
+namespace stardust
+{
+    namespace vfs
+    {
+        enum class PackCompression
+            : u32
+        {
+            None = 0u,
+            LZ4 = 1u,
+            Zstd = 2u,
+        };
+
+        struct PackHeader final
+        {
+            u32 magic;
+            u32 version;
+            u32 entryCount;
+            u32 bucketCount;
+
+            u64 entryTableOffset;
+            u64 bucketTableOffset;
+            u64 stringTableOffset;
+            u64 stringTableSize;
+        };
+
+        struct PackEntry final
+        {
+            u64 pathHash;
+
+            u64 offset;
+            u64 storedSize;
+            u64 size;
+
+            u32 pathOffset;
+            u32 pathLength;
+
+            PackCompression compression;
+            u32 alignment;
+        };
+
+        static_assert(sizeof(PackHeader) == 48u);
+        static_assert(sizeof(PackEntry) == 48u);
+
+        class PackArchive final
+            : private INoncopyable, private INonmovable
+        {
+        public:
+            static constexpr u32 Magic = 0x4B'50'44'53u;
+            static constexpr u32 Version = 1u;
+            static constexpr u32 EmptyBucket = 0xFF'FF'FF'FFu;
+
+        private:
+            filesystem::MemoryMappedFile m_mappedFile;
+            List<ubyte> m_ownedBytes{ };
+            Slice<const ubyte> m_bytes{ };
+
+            List<PackEntry> m_entries{ };
+            List<u32> m_buckets{ };
+            StringView m_stringTable{ };
+
+            HashMap<String, List<String>> m_directories{ };
+
+        public:
+            [[nodiscard]] static auto HashPath(const StringView path) noexcept -> u64;
+            [[nodiscard]] static auto IsPackArchive(const Slice<const ubyte> headerBytes) noexcept -> bool;
+
+            PackArchive() = default;
+            ~PackArchive() noexcept = default;
+
+            [[nodiscard]] auto Open(const StringView filepath) -> Status;
+            [[nodiscard]] auto Open(List<ubyte>&& archiveBytes) -> Status;
+
+            [[nodiscard]] inline auto IsValid() const noexcept -> bool { return !m_bytes.empty(); }
+            [[nodiscard]] inline auto IsMemoryMapped() const noexcept -> bool { return m_mappedFile.IsValid(); }
+
+            [[nodiscard]] auto FindEntry(const StringView path) const -> ObserverPointer<const PackEntry>;
+            [[nodiscard]] auto GetEntryPath(const PackEntry& entry) const -> StringView;
+
+            [[nodiscard]] auto GetEntryView(const PackEntry& entry) const -> Optional<Slice<const ubyte>>;
+            [[nodiscard]] auto ReadEntry(const PackEntry& entry, const Slice<ubyte> destination) const -> Status;
+
+            [[nodiscard]] auto IsDirectory(const StringView path) const -> bool;
+            [[nodiscard]] auto GetDirectoryChildren(const StringView path) const -> ObserverPointer<const List<String>>;
+
+            [[nodiscard]] inline auto GetEntries() const noexcept -> const List<PackEntry>& { return m_entries; }
+            [[nodiscard]] inline auto GetEntryCount() const noexcept -> usize { return m_entries.size(); }
+
+        private:
+            [[nodiscard]] auto Initialise() -> Status;
+        };
+
+        [[nodiscard]] extern auto RegisterPackArchiver() -> Status;
+        [[nodiscard]] extern auto FindMountedPackArchive(const StringView archiveName) -> ObserverPointer<const PackArchive>;
+    }
+}
+
+#endif
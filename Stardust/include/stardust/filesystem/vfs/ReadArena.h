@@ -0,0 +1,57 @@
+#pragma once
+#ifndef STARDUST_READ_ARENA_H
+#define STARDUST_READ_ARENA_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace vfs
+    {
+        class ReadArena final
+            : private INoncopyable
+        {
+        public:
+            static constexpr usize DefaultBlockSize = 1'048'576u;
+            static constexpr usize DefaultAlignment = alignof(std::max_align_t);
+
+        private:
+            struct Block final
+            {
+                UniquePointer<ubyte[]> data = nullptr;
+                usize capacity = 0u;
+                usize usedSize = 0u;
+            };
+
+            List<Block> m_blocks{ };
+            usize m_currentBlockIndex = 0u;
+
+            usize m_blockSize = DefaultBlockSize;
+
+        public:
+            ReadArena() = default;
+            explicit ReadArena(const usize blockSize);
+            ReadArena(ReadArena&& other) noexcept = default;
+            auto operator =(ReadArena&& other) noexcept -> ReadArena& = default;
+            ~ReadArena() noexcept = default;
+
+            [[nodiscard]] auto Allocate(const usize size, const usize alignment = DefaultAlignment) -> Slice<ubyte>;
+
+            auto Reset() noexcept -> void;
+            auto Release() noexcept -> void;
+
+            [[nodiscard]] inline auto GetBlockSize() const noexcept -> usize { return m_blockSize; }
+            [[nodiscard]] inline auto GetBlockCount() const noexcept -> usize { return m_blocks.size(); }
+            [[nodiscard]] auto GetCapacity() const noexcept -> usize;
+            [[nodiscard]] auto GetUsedSize() const noexcept -> usize;
+        };
+    }
+}
+
+#endif
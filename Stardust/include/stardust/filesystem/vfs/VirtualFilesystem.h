@@ -2,6 +2,7 @@
 #ifndef STARDUST_VIRTUAL_FILESYSTEM_H
 #define STARDUST_VIRTUAL_FILESYSTEM_H
 
+#include "stardust/filesystem/vfs/ReadArena.h"
 #include "stardust/types/Containers.h"
 #include "stardust/types/Primitives.h"
 #include "stardust/utility/error_handling/Status.h"
@@ -16,6 +17,7 @@ namespace stardust
             CannotOpenFile,
             CannotReadFile,
             InvalidData,
+            BufferTooSmall,
         };
 
         [[nodiscard]] extern auto Initialise(const char* argv0) -> Status;
@@ -35,15 +37,26 @@ namespace stardust
 
         [[nodiscard]] extern auto DoesPathExist(const StringView filepath) -> bool;
         [[nodiscard]] extern auto IsDirectory(const StringView filepath) -> bool;
+        [[nodiscard]] extern auto IsInPackArchive(const StringView filepath) -> bool;
 
+        [[nodiscard]] extern auto GetFileView(const StringView filepath) -> Optional<Slice<const ubyte>>;
         [[nodiscard]] extern auto ReadFileBytes(const StringView filepath) -> Result<List<ubyte>, VirtualFileError>;
+        [[nodiscard]] extern auto ReadFileBytes(const StringView filepath, List<ubyte>& buffer) -> Result<Slice<const ubyte>, VirtualFileError>;
+        [[nodiscard]] extern auto ReadFileBytes(const StringView filepath, ReadArena& arena) -> Result<Slice<const ubyte>, VirtualFileError>;
+        [[nodiscard]] extern auto ReadFileBytesInto(const StringView filepath, const Slice<ubyte> destination) -> Result<usize, VirtualFileError>;
         [[nodiscard]] extern auto ReadFileString(const StringView filepath) -> Result<String, VirtualFileError>;
         [[nodiscard]] extern auto ReadJSON(const StringView filepath) -> Result<JSON, VirtualFileError>;
         [[nodiscard]] extern auto ReadMessagePack(const StringView filepath) -> Result<JSON, VirtualFileError>;
         [[nodiscard]] extern auto ReadTOML(const StringView filepath) -> Result<TOML, VirtualFileError>;
         [[nodiscard]] extern auto ReadXML(const StringView filepath) -> Result<XML, VirtualFileError>;
 
+        [[nodiscard]] extern auto ParseJSON(const Slice<const ubyte> bytes) -> Result<JSON, VirtualFileError>;
+        [[nodiscard]] extern auto ParseMessagePack(const Slice<const ubyte> bytes) -> Result<JSON, VirtualFileError>;
+        [[nodiscard]] extern auto ParseTOML(const Slice<const ubyte> bytes) -> Result<TOML, VirtualFileError>;
+        [[nodiscard]] extern auto ParseXML(const Slice<const ubyte> bytes) -> Result<XML, VirtualFileError>;
+
         [[nodiscard]] extern auto GetFileSize(const StringView filepath) -> usize;
+        [[nodiscard]] extern auto GetLastModifiedTime(const StringView filepath) -> Optional<i64>;
     }
 }
 
@@ -35,6 +35,13 @@ namespace stardust
             auto ShiftUpperRight(const class Texture& texture, const f32 uTexelCount, const f32 vTexelCount) -> void;
         };
 
+        struct DecodedImage final
+        {
+            List<ubyte> pixels;
+            UVector2 extent;
+            u32 channelCount;
+        };
+
         class Texture final
             : private INoncopyable
         {
@@ -81,9 +88,11 @@ namespace stardust
             [[nodiscard]] static constexpr auto InvalidID() noexcept -> ID { return s_InvalidID; }
 
             static auto ResetActiveTexture() -> void;
+            [[nodiscard]] static auto DecodeImageFile(const StringView filepath) -> Optional<DecodedImage>;
 
             Texture() = default;
             explicit Texture(const StringView filepath, const Sampler& sampler = DefaultSampler);
+            explicit Texture(const DecodedImage& decodedImage, const Sampler& sampler = DefaultSampler);
             Texture(const UVector2 extent, const u32 channelCount, const Sampler& sampler = DefaultSampler);
             Texture(const List<ubyte>& data, const UVector2 extent, const u32 channelCount, const Sampler& sampler = DefaultSampler);
             Texture(const ubyte* const data, const UVector2 extent, const u32 channelCount, const Sampler& sampler = DefaultSampler);
@@ -94,6 +103,7 @@ namespace stardust
             ~Texture() noexcept;
 
             auto Initialise(const StringView filepath, const Sampler& sampler = DefaultSampler) -> void;
+            auto Initialise(const DecodedImage& decodedImage, const Sampler& sampler = DefaultSampler) -> void;
             auto Initialise(const UVector2 extent, const u32 channelCount, const Sampler& sampler = DefaultSampler) -> void;
             auto Initialise(const List<ubyte>& data, const UVector2 extent, const u32 channelCount, const Sampler& sampler = DefaultSampler) -> void;
             auto Initialise(const ubyte* const data, const UVector2 extent, const u32 channelCount, const Sampler& sampler = DefaultSampler) -> void;
@@ -2,12 +2,17 @@
 #ifndef STARDUST_INPUT_CONTROLLER_H
 #define STARDUST_INPUT_CONTROLLER_H
 
+#include <SDL2/SDL.h>
+
+#include "stardust/input/controller/GameController.h"
 #include "stardust/input/controller/GameControllerLobby.h"
 #include "stardust/input/joystick/JoystickLobby.h"
 #include "stardust/input/keyboard/KeyboardState.h"
 #include "stardust/input/mouse/MouseState.h"
+#include "stardust/input/recording/InputRecording.h"
 #include "stardust/math/Math.h"
 #include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
 #include "stardust/types/Primitives.h"
 #include "stardust/utility/error_handling/Status.h"
 
@@ -24,13 +29,41 @@ namespace stardust
         f32 m_gameControllerDeadzone = 0.0f;
         f32 m_joystickDeadzone = 0.0f;
 
+        bool m_isRecording = false;
+        InputRecording m_recording{ };
+        InputRecording::Frame m_recordingFrame{ };
+        List<u8> m_recordedKeyStates{ List<u8>(SDL_NUM_SCANCODES, SDL_FALSE) };
+        HashMap<GameController::InstanceID, InputRecording::ControllerIndex> m_recordedGameControllerIndices{ };
+
+        bool m_isReplaying = false;
+        InputRecording m_replay{ };
+        usize m_replayFrameIndex = 0u;
+        List<u8> m_replayKeyStates{ List<u8>(SDL_NUM_SCANCODES, SDL_FALSE) };
+        List<ObserverPointer<SDL_Joystick>> m_virtualGameControllers{ };
+
     public:
         [[nodiscard]] static auto LoadGameControllerDatabase(const StringView gameControllerDatabasePath) -> Status;
 
         [[nodiscard]] static auto GenerateTouchEventsFromMouseEvents(const bool generateTouchEvents) -> void;
         [[nodiscard]] static auto GenerateMouseEventsFromTouchEvents(const bool generateMouseEvents) -> void;
 
+        ~InputController() noexcept;
+
         auto Update() -> void;
+        auto EndFrame(const f64 deltaTime) -> void;
+
+        auto StartRecording() -> void;
+        [[nodiscard]] auto StopRecording() -> InputRecording;
+        auto RecordEvent(const SDL_Event& event) -> void;
+        [[nodiscard]] inline auto IsRecording() const noexcept -> bool { return m_isRecording; }
+
+        [[nodiscard]] auto StartReplay(InputRecording&& recording) -> Status;
+        auto StopReplay() -> void;
+        [[nodiscard]] auto GetReplayEvents() const -> const List<SDL_Event>&;
+        [[nodiscard]] auto GetReplayDeltaTime() const -> Optional<f64>;
+        [[nodiscard]] inline auto IsReplaying() const noexcept -> bool { return m_isReplaying; }
+        [[nodiscard]] inline auto HasReplayFinished() const noexcept -> bool { return m_replayFrameIndex >= m_replay.GetFrameCount(); }
+        [[nodiscard]] inline auto GetReplayFrameIndex() const noexcept -> usize { return m_replayFrameIndex; }
 
         [[nodiscard]] inline auto GetKeyboardState() -> KeyboardState& { return m_keyboardState; }
         [[nodiscard]] inline auto GetKeyboardState() const -> const KeyboardState& { return m_keyboardState; }
@@ -46,6 +79,13 @@ namespace stardust
 
         [[nodiscard]] inline auto GetJoystickDeadzone() const noexcept -> f32 { return m_joystickDeadzone; }
         inline auto SetJoystickDeadzone(const f32 joystickDeadzone) noexcept -> void { m_joystickDeadzone = glm::clamp(joystickDeadzone, 0.0f, 1.0f); }
+
+    private:
+        auto CaptureRecordingFrame() -> void;
+        auto ApplyReplayFrame() -> void;
+
+        [[nodiscard]] auto AttachVirtualGameControllers() -> Status;
+        auto DetachVirtualGameControllers() -> void;
     };
 }
 
@@ -2,6 +2,8 @@
 #ifndef STARDUST_INPUT_MANAGER_H
 #define STARDUST_INPUT_MANAGER_H
 
+#include <limits>
+
 #include "stardust/input/controller/GameController.h"
 #include "stardust/input/controller/GameControllerCodes.h"
 #include "stardust/input/joystick/Joystick.h"
@@ -9,6 +11,7 @@
 #include "stardust/input/keyboard/KeyCodes.h"
 #include "stardust/input/mouse/MouseCodes.h"
 #include "stardust/input/InputController.h"
+#include "stardust/math/Math.h"
 #include "stardust/preferences/ControlPrefs.h"
 #include "stardust/types/Containers.h"
 #include "stardust/types/Pointers.h"
@@ -18,6 +21,11 @@ namespace stardust
 {
     class InputManager final
     {
+    public:
+        using ActionID = u32;
+
+        static constexpr ActionID InvalidActionID = std::numeric_limits<ActionID>::max();
+
     private:
         enum class JoystickAxisSign
             : i32
@@ -71,9 +79,30 @@ namespace stardust
             HashSet<Joystick::TrackballID> joystickYTrackballs{ };
         };
 
+        template <typename T>
+        struct Action final
+        {
+            String name;
+            ObserverPointer<const T> input = nullptr;
+        };
+
         HashMap<String, ButtonInput> m_buttons{ };
         HashMap<String, AxisInput> m_axes{ };
 
+        HashMap<String, ActionID> m_buttonIDs{ };
+        List<Action<ButtonInput>> m_buttonActions{ };
+        HashMap<String, ActionID> m_axisIDs{ };
+        List<Action<AxisInput>> m_axisActions{ };
+        bool m_isActionMapDirty = false;
+
+        List<bool> m_buttonDownStates{ };
+        List<bool> m_buttonPressedStates{ };
+        List<bool> m_buttonUpStates{ };
+        List<f32> m_axisValues{ };
+
+        List<ObserverPointer<const GameController>> m_connectedGameControllers{ };
+        List<ObserverPointer<const Joystick>> m_connectedJoysticks{ };
+
         ObserverPointer<const InputController> m_inputController = nullptr;
 
     public:
@@ -82,6 +111,11 @@ namespace stardust
 
         auto Initialise(const InputController& inputController) -> void;
 
+        auto Update() -> void;
+
+        [[nodiscard]] auto GetButtonID(const String& buttonName) -> ActionID;
+        [[nodiscard]] auto GetAxisID(const String& axisName) -> ActionID;
+
         auto AddKeyToButton(const String& buttonName, const KeyCode key) -> void;
         auto AddMouseButtonToButton(const String& buttonName, const MouseButton button) -> void;
         auto AddGameControllerButtonToButton(const String& buttonName, const GameControllerButton button) -> void;
@@ -108,6 +142,10 @@ namespace stardust
         [[nodiscard]] auto IsButtonPressed(const String& buttonName, const List<ObserverPointer<const GameController>>& gameControllers = { }, const List<ObserverPointer<const Joystick>>& joysticks = { }) const -> bool;
         [[nodiscard]] auto IsButtonUp(const String& buttonName, const List<ObserverPointer<const GameController>>& gameControllers = { }, const List<ObserverPointer<const Joystick>>& joysticks = { }) const -> bool;
 
+        [[nodiscard]] inline auto IsButtonDown(const ActionID buttonID) const noexcept -> bool { return buttonID < m_buttonDownStates.size() && m_buttonDownStates[buttonID]; }
+        [[nodiscard]] inline auto IsButtonPressed(const ActionID buttonID) const noexcept -> bool { return buttonID < m_buttonPressedStates.size() && m_buttonPressedStates[buttonID]; }
+        [[nodiscard]] inline auto IsButtonUp(const ActionID buttonID) const noexcept -> bool { return buttonID < m_buttonUpStates.size() && m_buttonUpStates[buttonID]; }
+
         auto AddKeyToPositiveAxis(const String& axisName, const KeyCode key) -> void;
         auto AddKeyToNegativeAxis(const String& axisName, const KeyCode key) -> void;
 
@@ -166,9 +204,20 @@ namespace stardust
         [[nodiscard]] auto GetAxisRaw(const String& axisName, const List<ObserverPointer<const GameController>>& gameControllers = { }, const List<ObserverPointer<const Joystick>>& joysticks = { }) const -> f32;
         [[nodiscard]] auto GetClampedAxisRaw(const String& axisName, const List<ObserverPointer<const GameController>>& gameControllers = { }, const List<ObserverPointer<const Joystick>>& joysticks = { }) const -> f32;
 
+        [[nodiscard]] inline auto GetAxis(const ActionID axisID) const noexcept -> i32 { return static_cast<i32>(glm::sign(GetAxisRaw(axisID))); }
+        [[nodiscard]] inline auto GetAxisRaw(const ActionID axisID) const noexcept -> f32 { return axisID < m_axisValues.size() ? m_axisValues[axisID] : 0.0f; }
+        [[nodiscard]] inline auto GetClampedAxisRaw(const ActionID axisID) const noexcept -> f32 { return glm::clamp(GetAxisRaw(axisID), -1.0f, 1.0f); }
+
         auto LoadFromControlPrefs(const ControlPrefs& controlPrefs) -> void;
 
     private:
+        auto RebindActions() -> void;
+
+        [[nodiscard]] auto IsButtonInputDown(const ButtonInput& buttons, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool;
+        [[nodiscard]] auto IsButtonInputPressed(const ButtonInput& buttons, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool;
+        [[nodiscard]] auto IsButtonInputUp(const ButtonInput& buttons, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool;
+        [[nodiscard]] auto GetAxisInputValue(const AxisInput& axisData, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> f32;
+
         [[nodiscard]] auto GetAxisValueFromKeyboard(const AxisInput& axisData) const -> f32;
         [[nodiscard]] auto GetAxisValueFromMouse(const AxisInput& axisData) const -> f32;
         [[nodiscard]] auto GetAxisValueFromGameControllers(const AxisInput& axisData, const List<ObserverPointer<const GameController>>& gameControllers) const -> f32;
@@ -18,6 +18,9 @@ namespace stardust
 
     public:
         auto Update() -> void;
+        auto Update(const List<u8>& keyStates) -> void;
+
+        [[nodiscard]] inline auto GetKeyStates() const noexcept -> const List<u8>& { return m_currentKeyStates; }
 
         [[nodiscard]] auto IsKeyDown(const KeyCode key) const -> bool;
         [[nodiscard]] auto IsKeyPressed(const KeyCode key) const -> bool;
@@ -26,6 +26,7 @@ namespace stardust
 
     public:
         auto Update() -> void;
+        auto Update(const u32 buttonState, const IVector2 coordinates) noexcept -> void;
         auto ResetScrollState() noexcept -> void;
         auto UpdateScrollState(const i32 scrollAmount, const f32 preciseScrollAmount) noexcept -> void;
 
@@ -38,6 +39,8 @@ namespace stardust
         [[nodiscard]] inline auto GetRelativeCoordinates() const noexcept -> IVector2 { return m_currentScreenCoordinates - m_previousScreenCoordinates; }
         [[nodiscard]] auto GetRelativeVirtualCoordinates(const Window& window, const Camera2D& camera) const noexcept -> IVector2;
 
+        [[nodiscard]] inline auto GetButtonState() const noexcept -> u32 { return m_currentButtonState; }
+
         [[nodiscard]] inline auto HasMoved() const noexcept -> bool { return GetRelativeCoordinates() != IVector2Zero; }
 
         [[nodiscard]] auto IsButtonDown(const MouseButton button) const -> bool;
@@ -0,0 +1,61 @@
+#pragma once
+#ifndef STARDUST_INPUT_RECORDING_H
+#define STARDUST_INPUT_RECORDING_H
+
+#include <SDL2/SDL.h>
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/MathTypes.h"
+#include "stardust/types/Primitives.h"
+#include "stardust/utility/error_handling/Status.h"
+
+namespace stardust
+{
+    class InputRecording final
+    {
+    public:
+        using ControllerIndex = u8;
+
+        struct GameControllerFrame final
+        {
+            ControllerIndex controllerIndex;
+
+            u32 buttonState;
+            Array<i16, SDL_CONTROLLER_AXIS_MAX> axisValues;
+        };
+
+        struct Frame final
+        {
+            f64 deltaTime = 0.0;
+
+            List<u16> toggledKeys{ };
+
+            u32 mouseButtonState = 0u;
+            IVector2 mouseCoordinates{ 0, 0 };
+
+            List<GameControllerFrame> gameControllers{ };
+            List<SDL_Event> events{ };
+        };
+
+    private:
+        List<Frame> m_frames{ };
+        u32 m_gameControllerCount = 0u;
+
+    public:
+        [[nodiscard]] static auto IsRecordableEvent(const SDL_Event& event) noexcept -> bool;
+
+        [[nodiscard]] auto Save(const StringView filepath) const -> Status;
+        [[nodiscard]] auto Load(const StringView filepath) -> Status;
+
+        auto AddFrame(Frame&& frame) -> void;
+        auto Clear() -> void;
+
+        [[nodiscard]] inline auto GetFrames() const noexcept -> const List<Frame>& { return m_frames; }
+        [[nodiscard]] inline auto GetFrameCount() const noexcept -> usize { return m_frames.size(); }
+        [[nodiscard]] inline auto GetGameControllerCount() const noexcept -> u32 { return m_gameControllerCount; }
+
+        [[nodiscard]] inline auto IsEmpty() const noexcept -> bool { return m_frames.empty(); }
+    };
+}
+
+#endif
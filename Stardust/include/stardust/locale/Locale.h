@@ -5,47 +5,118 @@
 #include <limits>
 
 #include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
 #include "stardust/types/Primitives.h"
 #include "stardust/utility/error_handling/Status.h"
+#include "stardust/utility/hash/Hash.h"
 
 namespace stardust
 {
     class Locale final
     {
     public:
+        using Key = u64;
+
         static constexpr i32 ChangeEventCode = 0;
 
+        static constexpr Key EmptyKey = hash::FNV1aOffsetBasis;
+        static constexpr char KeySeparator = '.';
+
+        class Path final
+        {
+        private:
+            ObserverPointer<const Locale> m_locale = nullptr;
+            Key m_key = EmptyKey;
+
+        public:
+            Path(const Locale& locale, const Key key) noexcept;
+
+            [[nodiscard]] auto operator [](const StringView localeEntryName) const noexcept -> Path;
+
+            [[nodiscard]] inline auto GetKey() const noexcept -> Key { return m_key; }
+            [[nodiscard]] auto Get() const noexcept -> const String&;
+            [[nodiscard]] auto Get(const HashMap<String, String>& replacementMap) const -> String;
+
+            [[nodiscard]] inline auto operator ()(const HashMap<String, String>& replacementMap) const -> String { return Get(replacementMap); }
+
+            [[nodiscard]] inline operator const String&() const noexcept { return Get(); }
+            [[nodiscard]] inline operator StringView() const noexcept { return Get(); }
+        };
+
     private:
+        struct Segment final
+        {
+            u32 offset;
+            u32 length;
+            bool isPlaceholder;
+        };
+
+        struct Entry final
+        {
+            String text;
+            List<Segment> segments;
+            bool hasPlaceholders;
+        };
+
         inline static u32 s_localeChangeEventID = std::numeric_limits<u32>::max();
+        inline static const String s_missingEntry{ };
 
         String m_baseLocaleDirectory;
 
-        JSON m_currentLocaleEntries;
+        HashMap<Key, u32> m_entryIndices{ };
+        List<Entry> m_entries{ };
         String m_currentLocaleName;
 
     public:
         static auto SetLocaleChangeEventID(const u32 eventID) noexcept -> void;
 
+        [[nodiscard]] static constexpr auto AppendToKey(const Key key, const StringView localeEntryName) noexcept -> Key
+        {
+            const Key separatedKey = key != EmptyKey
+                ? hash::FNV1a(StringView(&KeySeparator, 1u), key)
+                : key;
+
+            return hash::FNV1a(localeEntryName, separatedKey);
+        }
+
+        [[nodiscard]] static constexpr auto MakeKey(const StringView dottedLocaleEntryName) noexcept -> Key
+        {
+            return AppendToKey(EmptyKey, dottedLocaleEntryName);
+        }
+
+        [[nodiscard]] static auto MakeKey(const List<String>& localeEntryNames) noexcept -> Key;
+
         auto Initialise(const StringView baseLocaleDirectory) -> void;
         [[nodiscard]] auto SetLocale(const String& localeName, const bool triggerEvent = true) -> Status;
 
         [[nodiscard]] auto GetCurrentLocaleName() const noexcept -> const String& { return m_currentLocaleName; }
+        [[nodiscard]] inline auto GetEntryCount() const noexcept -> usize { return m_entries.size(); }
+
+        [[nodiscard]] inline auto Has(const Key key) const -> bool { return m_entryIndices.contains(key); }
+        [[nodiscard]] inline auto Has(const StringView dottedLocaleEntryName) const -> bool { return Has(MakeKey(dottedLocaleEntryName)); }
 
-        [[nodiscard]] inline auto Get(const StringView localeEntryName) const -> JSON { return m_currentLocaleEntries[localeEntryName.data()]; }
-        [[nodiscard]] auto Get(const StringView localeEntryName, const HashMap<String, String>& replacementMap) const -> String;
-        [[nodiscard]] auto Get(const List<String>& localeEntryNames) const -> String;
-        [[nodiscard]] auto Get(const List<String>& localeEntryNames, const HashMap<String, String>& replacementMap) const -> String;
+        [[nodiscard]] auto Get(const Key key) const noexcept -> const String&;
+        [[nodiscard]] auto Get(const Key key, const HashMap<String, String>& replacementMap) const -> String;
+        [[nodiscard]] inline auto Get(const StringView dottedLocaleEntryName) const noexcept -> const String& { return Get(MakeKey(dottedLocaleEntryName)); }
+        [[nodiscard]] inline auto Get(const StringView dottedLocaleEntryName, const HashMap<String, String>& replacementMap) const -> String { return Get(MakeKey(dottedLocaleEntryName), replacementMap); }
+        [[nodiscard]] inline auto Get(const List<String>& localeEntryNames) const noexcept -> const String& { return Get(MakeKey(localeEntryNames)); }
+        [[nodiscard]] inline auto Get(const List<String>& localeEntryNames, const HashMap<String, String>& replacementMap) const -> String { return Get(MakeKey(localeEntryNames), replacementMap); }
 
-        [[nodiscard]] inline auto operator [](const StringView localeEntryName) const -> JSON { return Get(localeEntryName); }
-        [[nodiscard]] inline auto operator ()(const StringView localeEntryName) const -> JSON { return Get(localeEntryName); }
-        [[nodiscard]] inline auto operator ()(const StringView localeEntryName, const HashMap<String, String>& replacementMap) const -> String { return Get(localeEntryName, replacementMap); }
-        [[nodiscard]] inline auto operator [](const List<String>& localeEntryNames) const -> String { return Get(localeEntryNames); }
-        [[nodiscard]] inline auto operator ()(const List<String>& localeEntryNames) const -> String { return Get(localeEntryNames); }
+        [[nodiscard]] inline auto operator [](const StringView localeEntryName) const noexcept -> Path { return Path(*this, MakeKey(localeEntryName)); }
+        [[nodiscard]] inline auto operator ()(const StringView dottedLocaleEntryName) const noexcept -> const String& { return Get(dottedLocaleEntryName); }
+        [[nodiscard]] inline auto operator ()(const StringView dottedLocaleEntryName, const HashMap<String, String>& replacementMap) const -> String { return Get(dottedLocaleEntryName, replacementMap); }
+        [[nodiscard]] inline auto operator [](const List<String>& localeEntryNames) const noexcept -> const String& { return Get(localeEntryNames); }
+        [[nodiscard]] inline auto operator ()(const List<String>& localeEntryNames) const noexcept -> const String& { return Get(localeEntryNames); }
         [[nodiscard]] inline auto operator ()(const List<String>& localeEntryNames, const HashMap<String, String>& replacementMap) const -> String { return Get(localeEntryNames, replacementMap); }
 
     private:
         [[nodiscard]] auto LoadLocaleFile(const String& filepath) const -> Optional<JSON>;
 
+        auto FlattenEntries(const JSON& localeNode, const Key key, HashMap<Key, u32>& entryIndices, List<Entry>& entries) const -> void;
+        [[nodiscard]] static auto ParseSegments(const String& text) -> List<Segment>;
+
+        [[nodiscard]] auto FindEntry(const Key key) const noexcept -> ObserverPointer<const Entry>;
+
         auto PushLocaleChangeEvent() -> void;
     };
 }
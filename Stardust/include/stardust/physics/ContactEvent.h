@@ -0,0 +1,43 @@
+#pragma once
+#ifndef STARDUST_CONTACT_EVENT_H
+#define STARDUST_CONTACT_EVENT_H
+
+#include <box2d/box2d.h>
+
+#include "stardust/ecs/entity/EntityHandle.h"
+#include "stardust/physics/Physics.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace physics
+    {
+        struct ContactEvent final
+        {
+            enum class Type
+                : u8
+            {
+                Begin,
+                End,
+            };
+
+            Type type;
+            bool isSensorContact;
+
+            ObserverPointer<b2Fixture> firstFixture;
+            ObserverPointer<b2Fixture> secondFixture;
+
+            CollisionLayer firstLayers;
+            CollisionLayer secondLayers;
+
+            EntityHandle firstEntityHandle;
+            EntityHandle secondEntityHandle;
+
+            [[nodiscard]] inline auto Involves(const CollisionLayer layerMask) const noexcept -> bool { return ((firstLayers | secondLayers) & layerMask) != NoLayers; }
+            [[nodiscard]] inline auto Involves(const EntityHandle entityHandle) const noexcept -> bool { return firstEntityHandle == entityHandle || secondEntityHandle == entityHandle; }
+        };
+    }
+}
+
+#endif
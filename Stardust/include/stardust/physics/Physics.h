@@ -33,6 +33,12 @@ namespace stardust
             Vector2 centre;
             f32 momentOfInertia;
         };
+
+        struct BodyTransform final
+        {
+            Vector2 position;
+            f32 rotation;
+        };
     }
 
     namespace phys = physics;
@@ -0,0 +1,32 @@
+#pragma once
+#ifndef STARDUST_QUERIES_H
+#define STARDUST_QUERIES_H
+
+#include "stardust/physics/AABB.h"
+#include "stardust/physics/Physics.h"
+#include "stardust/types/MathTypes.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace physics
+    {
+        struct RaycastQuery final
+        {
+            Vector2 origin;
+            Vector2 direction;
+            f32 distance;
+
+            CollisionLayer layerMask = AllLayers;
+        };
+
+        struct BoxQuery final
+        {
+            AABB box;
+
+            CollisionLayer layerMask = AllLayers;
+        };
+    }
+}
+
+#endif
@@ -24,6 +24,8 @@ namespace stardust
         class Body final
             : private INoncopyable
         {
+            friend class World;
+
         public:
             enum class Type
                 : std::underlying_type_t<b2BodyType>
@@ -61,15 +63,17 @@ namespace stardust
 
         private:
             ObserverPointer<b2Body> m_handle = nullptr;
-            ObserverPointer<const class World> m_owningWorld = nullptr;
+            ObserverPointer<class World> m_owningWorld = nullptr;
 
             HashSet<Collider> m_colliders{ };
 
             EntityHandle m_associatedEntityHandle = NullEntityHandle;
 
+            Array<BodyTransform, 2u> m_transformSnapshots{ };
+
         public:
             Body() = default;
-            Body(const class World& world, const CreateInfo& createInfo, const EntityHandle associatedEntityHandle);
+            Body(class World& world, const CreateInfo& createInfo, const EntityHandle associatedEntityHandle);
             Body(Body&& other) noexcept;
             auto operator =(Body&& other) noexcept -> Body&;
             ~Body() noexcept = default;
@@ -149,7 +153,9 @@ namespace stardust
             [[nodiscard]] inline auto GetOwningWorld() const noexcept -> ObserverPointer<const class World> { return m_owningWorld; }
 
         private:
-            auto Initialise(const class World& world, const CreateInfo& createInfo, const EntityHandle associatedEntityHandle) -> void;
+            [[nodiscard]] auto GetSynchronisedHandle() const -> ObserverPointer<b2Body>;
+
+            auto Initialise(class World& world, const CreateInfo& createInfo, const EntityHandle associatedEntityHandle) -> void;
         };
     }
 }
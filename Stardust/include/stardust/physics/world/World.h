@@ -2,7 +2,14 @@
 #ifndef STARDUST_WORLD_H
 #define STARDUST_WORLD_H
 
+#include "stardust/utility/interfaces/INoncopyable.h"
+#include "stardust/utility/interfaces/INonmovable.h"
+
+#include <condition_variable>
 #include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
 
 #include <box2d/box2d.h>
 
@@ -12,6 +19,8 @@
 #include "stardust/physics/collider/Collider.h"
 #include "stardust/physics/RaycastHit.h"
 #include "stardust/physics/AABB.h"
+#include "stardust/physics/ContactEvent.h"
+#include "stardust/physics/Queries.h"
 #include "stardust/physics/Physics.h"
 #include "stardust/scene/Scene.h"
 #include "stardust/types/Containers.h"
@@ -26,16 +35,19 @@ namespace stardust
         using CollisionCallback = std::function<void(const Collider& other)>;
 
         class World final
+            : private INoncopyable, private INonmovable
         {
+            friend class Body;
+
         private:
             class CollisionListener final
                 : public b2ContactListener
             {
             private:
-                const World& m_world;
+                World& m_world;
 
             public:
-                explicit CollisionListener(const World& world);
+                explicit CollisionListener(World& world);
                 virtual ~CollisionListener() noexcept = default;
 
                 virtual void BeginContact(b2Contact* const contact) override;
@@ -48,7 +60,8 @@ namespace stardust
             UniquePointer<b2World> m_handle = nullptr;
             ObserverPointer<Scene> m_scene = nullptr;
 
-            HashMap<const b2Body*, Body> m_bodies{ };
+            Deque<Body> m_bodies{ };
+            List<usize> m_freeBodySlots{ };
 
             CollisionListener m_collisionListener{ *this };
             HashMap<const b2Body*, CollisionCallback> m_collisionEnterCallbacks{ };
@@ -56,6 +69,24 @@ namespace stardust
             HashMap<const b2Body*, CollisionCallback> m_sensorEnterCallbacks{ };
             HashMap<const b2Body*, CollisionCallback> m_sensorExitCallbacks{ };
 
+            usize m_currentTransformSnapshotIndex = 0u;
+
+            bool m_isThreadedSteppingEnabled = false;
+            bool m_isStepInFlight = false;
+
+            List<ContactEvent> m_pendingContactEvents{ };
+            List<ContactEvent> m_contactEvents{ };
+
+            bool m_isDispatchingContactEvents = false;
+            List<ObserverPointer<const b2Fixture>> m_destroyedFixtures{ };
+
+            mutable std::mutex m_stepMutex;
+            mutable std::condition_variable_any m_stepCondition;
+            bool m_isStepPending = false;
+            f32 m_pendingTimestep = 0.0f;
+
+            std::jthread m_stepThread;
+
         public:
             [[nodiscard]] inline static auto GetVelocityIterations() noexcept -> u32 { return s_velocityIterations; }
             inline static auto SetVelocityIterations(const u32 iterations) noexcept -> void { s_velocityIterations = iterations; }
@@ -63,22 +94,39 @@ namespace stardust
             inline static auto SetPositionIterations(const u32 iterations) noexcept -> void { s_positionIterations = iterations; }
 
             World() = default;
+            explicit World(const Vector2 gravity);
             World(Scene& scene, const Vector2 gravity = Vector2Zero);
             ~World() noexcept = default;
 
+            auto Initialise(const Vector2 gravity) -> void;
             auto Initialise(Scene& scene, const Vector2 gravity = Vector2Zero) -> void;
 
-            auto Step(const f64 timestep) const -> void;
+            auto Step(const f64 timestep) -> void;
+            auto Synchronise() -> void;
+            auto WaitForStep() const -> void;
+
+            [[nodiscard]] inline auto IsThreadedSteppingEnabled() const noexcept -> bool { return m_isThreadedSteppingEnabled; }
+            auto EnableThreadedStepping() -> void;
+            auto DisableThreadedStepping() -> void;
+            [[nodiscard]] inline auto IsStepInFlight() const noexcept -> bool { return m_isStepInFlight; }
+
+            [[nodiscard]] auto GetInterpolatedTransform(const Body& body, const f32 interpolation) const -> BodyTransform;
+            auto SyncTransforms() -> void;
+            auto SyncTransforms(const f32 interpolation) -> void;
 
             auto CreateBody(const Body::CreateInfo& createInfo, const ObserverPointer<EntityBundle> entityBundle = nullptr) -> ObserverPointer<Body>;
             auto DestroyBody(const ObserverPointer<const Body> body) noexcept -> void;
             [[nodiscard]] auto LookupBody(const ObserverPointer<const b2Body> bodyHandle) -> ObserverPointer<Body>;
             [[nodiscard]] auto LookupBody(const ObserverPointer<const b2Body> bodyHandle) const -> ObserverPointer<const Body>;
 
-            inline auto SetCollisionEnterCallback(const Body& body, const CollisionCallback& callback) -> void { m_collisionEnterCallbacks[body.GetRawHandle()] = callback; }
-            inline auto SetCollisionExitCallback(const Body& body, const CollisionCallback& callback) -> void { m_collisionExitCallbacks[body.GetRawHandle()] = callback; }
-            inline auto SetSensorEnterCallback(const Body& body, const CollisionCallback& callback) -> void { m_sensorEnterCallbacks[body.GetRawHandle()] = callback; }
-            inline auto SetSensorExitCallback(const Body& body, const CollisionCallback& callback) -> void { m_sensorExitCallbacks[body.GetRawHandle()] = callback; }
+            auto SetCollisionEnterCallback(const Body& body, const CollisionCallback& callback) -> void;
+            auto SetCollisionExitCallback(const Body& body, const CollisionCallback& callback) -> void;
+            auto SetSensorEnterCallback(const Body& body, const CollisionCallback& callback) -> void;
+            auto SetSensorExitCallback(const Body& body, const CollisionCallback& callback) -> void;
+
+            [[nodiscard]] inline auto GetContactEvents() const noexcept -> const List<ContactEvent>& { return m_contactEvents; }
+            [[nodiscard]] auto IterateContactEvents(const CollisionLayer layerMask) const -> Generator<const ContactEvent&>;
+            [[nodiscard]] auto IterateContactEvents(const EntityHandle entityHandle) const -> Generator<const ContactEvent&>;
 
             [[nodiscard]] auto Raycast(const Vector2 origin, const Vector2 direction, const f32 distance, const CollisionLayer layerMask = AllLayers) const -> Optional<RaycastHit>;
             [[nodiscard]] auto RaycastAll(const Vector2 origin, const Vector2 direction, const f32 distance, const CollisionLayer layerMask = AllLayers) const -> List<RaycastHit>;
@@ -93,6 +141,10 @@ namespace stardust
             [[nodiscard]] auto QueryBoxAll(const AABB& box, const CollisionLayer layerMask = AllLayers) const -> List<Collider>;
             [[nodiscard]] auto QueryBoxAll(const Vector2 centre, const Vector2 halfSize, const CollisionLayer layerMask = AllLayers) const -> List<Collider>;
 
+            auto RaycastBatch(const Slice<const RaycastQuery> queries, const Slice<Optional<RaycastHit>> results, const u32 threadCount = 1u) const -> usize;
+            auto RaycastAnyBatch(const Slice<const RaycastQuery> queries, const Slice<bool> results, const u32 threadCount = 1u) const -> usize;
+            auto QueryBoxBatch(const Slice<const BoxQuery> queries, const Slice<Optional<Collider>> results, const u32 threadCount = 1u) const -> usize;
+
             [[nodiscard]] auto GetGravity() const -> Vector2;
             auto SetGravity(const Vector2 gravity) const -> void;
 
@@ -101,6 +153,22 @@ namespace stardust
 
             [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_handle != nullptr; }
             [[nodiscard]] inline auto GetRawHandle() const noexcept -> b2World* { return m_handle.get(); }
+
+        private:
+            [[nodiscard]] auto FindRaycastHit(const Vector2 origin, const Vector2 direction, const f32 distance, const CollisionLayer layerMask) const -> Optional<RaycastHit>;
+            [[nodiscard]] auto FindOverlappingCollider(const AABB& box, const CollisionLayer layerMask) const -> Optional<Collider>;
+
+            auto EmplaceBody(Body&& body) -> ObserverPointer<Body>;
+
+            auto RunStepThread(const std::stop_token stopToken) -> void;
+
+            auto CaptureTransformSnapshots() -> void;
+            auto RecordContactEvent(const ObserverPointer<b2Contact> contact, const ContactEvent::Type type) -> void;
+            auto FlushContactEvents() -> void;
+            auto ResolveEntityHandles(ContactEvent& contactEvent) const -> void;
+            auto InvokeContactCallback(const ContactEvent& contactEvent) -> void;
+            auto DiscardContactEvents(const ObserverPointer<const b2Fixture> fixture) -> void;
+            [[nodiscard]] auto WasDestroyedDuringDispatch(const ContactEvent& contactEvent) const -> bool;
         };
     }
 }
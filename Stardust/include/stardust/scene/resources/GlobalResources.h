@@ -2,60 +2,249 @@
 #ifndef STARDUST_GLOBAL_RESOURCES_H
 #define STARDUST_GLOBAL_RESOURCES_H
 
-#include <any>
+#include <concepts>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
+#include "stardust/debug/assert/Assert.h"
+#include "stardust/scene/resources/ResourceKey.h"
 #include "stardust/types/Containers.h"
 #include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
 
 namespace stardust
 {
     class GlobalResources final
     {
     private:
-        HashMap<String, Any> m_data{ };
+        using TypeTag = const void*;
+        using Deleter = auto(*)(void* const) -> void;
+
+        struct ResourceSlot final
+        {
+            UniquePointer<void, Deleter> data{ nullptr, nullptr };
+            TypeTag typeTag = nullptr;
+        };
+
+        template <typename T>
+        inline static const u8 s_typeTagAnchor = 0u;
+
+        HashMap<String, u32> m_keyIndices{ };
+        List<ResourceSlot> m_slots{ };
 
     public:
+        template <typename T>
+        [[nodiscard]] auto RegisterKey(const StringView name) -> ResourceKey<T>
+        {
+            return ResourceKey<T>(InternKey(name));
+        }
+
+        template <typename T>
+        [[nodiscard]] inline auto Has(const ResourceKey<T> key) const noexcept -> bool
+        {
+            return key.GetIndex() < m_slots.size() && m_slots[key.GetIndex()].data != nullptr;
+        }
+
+        template <typename T>
+        [[nodiscard]] inline auto Get(const ResourceKey<T> key) -> T&
+        {
+            const ObserverPointer<T> data = GetPointer(key);
+
+            if (data == nullptr)
+            {
+                throw std::out_of_range("Global resource does not exist.");
+            }
+
+            return *data;
+        }
+
+        template <typename T>
+        [[nodiscard]] inline auto Get(const ResourceKey<T> key) const -> const T&
+        {
+            const ObserverPointer<const T> data = GetPointer(key);
+
+            if (data == nullptr)
+            {
+                throw std::out_of_range("Global resource does not exist.");
+            }
+
+            return *data;
+        }
+
+        template <typename T>
+        [[nodiscard]] inline auto GetPointer(const ResourceKey<T> key) noexcept -> ObserverPointer<T>
+        {
+            return static_cast<T*>(GetSlotData<T>(key.GetIndex()));
+        }
+
+        template <typename T>
+        [[nodiscard]] inline auto GetPointer(const ResourceKey<T> key) const noexcept -> ObserverPointer<const T>
+        {
+            return static_cast<const T*>(GetSlotData<T>(key.GetIndex()));
+        }
+
+        template <typename T, typename... Args>
+            requires std::is_constructible_v<T, Args...>
+        auto Emplace(const ResourceKey<T> key, Args&&... args) -> T&
+        {
+            if (key.GetIndex() >= m_slots.size())
+            {
+                throw std::out_of_range("Resource key was not registered with these global resources.");
+            }
+
+            ResourceSlot& slot = m_slots[key.GetIndex()];
+
+            slot.data = UniquePointer<void, Deleter>(
+                new T(std::forward<Args>(args)...),
+                [](void* const data) { delete static_cast<T*>(data); }
+            );
+            slot.typeTag = GetTypeTag<T>();
+
+            return *static_cast<T*>(slot.data.get());
+        }
+
+        template <typename T, typename U>
+            requires std::is_constructible_v<T, U&&> && std::is_assignable_v<T&, U&&>
+        auto Set(const ResourceKey<T> key, U&& data) -> void
+        {
+            if (const ObserverPointer<T> currentData = GetPointer(key);
+                currentData != nullptr)
+            {
+                *currentData = std::forward<U>(data);
+            }
+            else
+            {
+                Emplace(key, std::forward<U>(data));
+            }
+        }
+
+        template <typename T>
+        auto Remove(const ResourceKey<T> key) -> void
+        {
+            if (key.GetIndex() < m_slots.size())
+            {
+                ResetSlot(m_slots[key.GetIndex()]);
+            }
+        }
+
         template <typename T>
         [[nodiscard]] inline auto Get(const StringView key) const -> T
         {
-            return std::any_cast<T>(m_data.at(key.data()));
+            return GetConstReference<T>(key);
         }
 
         template <typename T>
-        [[nodiscard]] inline auto GetReference(const StringView key) -> T&
+        [[nodiscard]] auto GetReference(const StringView key) -> T&
         {
-            return std::any_cast<T&>(m_data[key.data()]);
+            const ObserverPointer<T> data = GetPointer<T>(key);
+
+            if (data == nullptr)
+            {
+                throw std::out_of_range("Global resource does not exist or holds a different type.");
+            }
+
+            return *data;
         }
 
         template <typename T>
-        [[nodiscard]] inline auto GetConstReference(const StringView key) const -> const T&
+        [[nodiscard]] auto GetConstReference(const StringView key) const -> const T&
         {
-            return std::any_cast<const T&>(m_data.at(key.data()));
+            const ObserverPointer<const T> data = GetConstPointer<T>(key);
+
+            if (data == nullptr)
+            {
+                throw std::out_of_range("Global resource does not exist or holds a different type.");
+            }
+
+            return *data;
         }
 
         template <typename T>
         [[nodiscard]] inline auto GetPointer(const StringView key) -> ObserverPointer<T>
         {
-            return std::any_cast<T>(&m_data[key.data()]);
+            const auto keyIndexLocation = m_keyIndices.find(String(key));
+
+            if (keyIndexLocation == std::cend(m_keyIndices))
+            {
+                return nullptr;
+            }
+
+            return GetCheckedPointer(ResourceKey<T>(keyIndexLocation->second));
         }
 
         template <typename T>
         [[nodiscard]] inline auto GetConstPointer(const StringView key) const -> ObserverPointer<const T>
         {
-            return std::any_cast<const T>(&m_data.at(key.data()));
+            const auto keyIndexLocation = m_keyIndices.find(String(key));
+
+            if (keyIndexLocation == std::cend(m_keyIndices))
+            {
+                return nullptr;
+            }
+
+            return GetCheckedPointer(ResourceKey<T>(keyIndexLocation->second));
         }
 
         template <typename T>
         inline auto Set(const StringView key, const T& data) -> void
         {
-            m_data[key.data()] = data;
+            const ResourceKey<T> resourceKey = RegisterKey<T>(key);
+
+            if (m_slots[resourceKey.GetIndex()].typeTag == GetTypeTag<T>())
+            {
+                *GetPointer(resourceKey) = data;
+            }
+            else
+            {
+                Emplace(resourceKey, data);
+            }
         }
 
         [[nodiscard]] auto HasKey(const StringView key) -> bool;
         
         auto Remove(const StringView key) -> void;
         auto Clear() -> void;
+
+    private:
+        template <typename T>
+        [[nodiscard]] static inline auto GetTypeTag() noexcept -> TypeTag
+        {
+            return &s_typeTagAnchor<std::remove_cvref_t<T>>;
+        }
+
+        [[nodiscard]] auto InternKey(const StringView name) -> u32;
+        static auto ResetSlot(ResourceSlot& slot) noexcept -> void;
+
+        template <typename T>
+        [[nodiscard]] inline auto GetSlotData(const u32 slotIndex) const noexcept -> void*
+        {
+            if (slotIndex >= m_slots.size())
+            {
+                return nullptr;
+            }
+
+            const ResourceSlot& slot = m_slots[slotIndex];
+
+        #ifndef NDEBUG
+            STARDUST_ASSERT(slot.data == nullptr || slot.typeTag == GetTypeTag<T>());
+        #endif
+
+            return slot.data.get();
+        }
+
+        template <typename T>
+        [[nodiscard]] inline auto GetCheckedPointer(const ResourceKey<T> key) const noexcept -> ObserverPointer<T>
+        {
+            if (key.GetIndex() >= m_slots.size() || m_slots[key.GetIndex()].typeTag != GetTypeTag<T>())
+            {
+                return nullptr;
+            }
+
+            return static_cast<T*>(m_slots[key.GetIndex()].data.get());
+        }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
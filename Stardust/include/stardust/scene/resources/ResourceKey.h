@@ -0,0 +1,37 @@
+#pragma once
+#ifndef STARDUST_RESOURCE_KEY_H
+#define STARDUST_RESOURCE_KEY_H
+
+#include <limits>
+
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    template <typename T>
+    class ResourceKey final
+    {
+    public:
+        using Index = u32;
+
+        static constexpr Index InvalidIndex = std::numeric_limits<Index>::max();
+
+    private:
+        Index m_index = InvalidIndex;
+
+    public:
+        constexpr ResourceKey() noexcept = default;
+
+        explicit constexpr ResourceKey(const Index index) noexcept
+            : m_index(index)
+        { }
+
+        [[nodiscard]] constexpr auto IsValid() const noexcept -> bool { return m_index != InvalidIndex; }
+        [[nodiscard]] constexpr auto GetIndex() const noexcept -> Index { return m_index; }
+
+        [[nodiscard]] constexpr auto operator ==(const ResourceKey&) const noexcept -> bool = default;
+        [[nodiscard]] constexpr auto operator !=(const ResourceKey&) const noexcept -> bool = default;
+    };
+}
+
+#endif
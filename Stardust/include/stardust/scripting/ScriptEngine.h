@@ -9,7 +9,9 @@
 
 #include <sol/sol.hpp>
 
+#include "stardust/scripting/ScriptTransformView.h"
 #include "stardust/types/Containers.h"
+#include "stardust/types/Primitives.h"
 #include "stardust/utility/error_handling/Status.h"
 
 namespace stardust
@@ -22,14 +24,65 @@ namespace stardust
 
     class ScriptEngine final
     {
+    public:
+        enum class GarbageCollectionMode
+            : u8
+        {
+            Automatic,
+            Incremental,
+            Generational,
+        };
+
+        struct GarbageCollectionStats final
+        {
+            f64 collectionTime = 0.0;
+            usize heapSize = 0u;
+
+            u32 stepCount = 0u;
+            u32 completedCycleCount = 0u;
+        };
+
+        static constexpr f64 IncrementalCollectionPause = 2.0;
+        static constexpr f64 GenerationalCollectionPause = 1.2;
+        static constexpr f64 MaxCollectionDebt = 2.0;
+
     private:
         sol::state m_luaState{ };
+        ScriptTransformView m_transformView{ };
+
+        String m_bytecodeCacheDirectory;
+        bool m_isBytecodeCacheReadOnly = false;
+        bool m_isPrecompiledScriptLoadingEnabled = false;
+
+        GarbageCollectionMode m_garbageCollectionMode = GarbageCollectionMode::Automatic;
+        GarbageCollectionStats m_garbageCollectionStats{ };
+        usize m_previousHeapSize = 0u;
+        usize m_heapSizeAfterCollection = 0u;
+        bool m_isCollectionCycleActive = false;
 
     public:
+        [[nodiscard]] static auto IsPrecompiledChunk(const Slice<const ubyte> scriptData) noexcept -> bool;
+
         auto Initialise(class Application& application) -> void;
+        auto InitialiseWorker() -> void;
 
         auto LoadScript(const StringView script) -> Status;
         [[nodiscard]] auto LoadScriptFile(const StringView scriptFilepath) -> Status;
+        [[nodiscard]] auto CompileScript(const StringView script, const StringView chunkName, List<ubyte>& bytecode) -> Status;
+
+        inline auto SetBytecodeCacheDirectory(const StringView bytecodeCacheDirectory) -> void { m_bytecodeCacheDirectory = bytecodeCacheDirectory; }
+        [[nodiscard]] inline auto GetBytecodeCacheDirectory() const noexcept -> const String& { return m_bytecodeCacheDirectory; }
+        inline auto SetBytecodeCacheReadOnly(const bool isBytecodeCacheReadOnly) noexcept -> void { m_isBytecodeCacheReadOnly = isBytecodeCacheReadOnly; }
+        [[nodiscard]] inline auto IsBytecodeCacheReadOnly() const noexcept -> bool { return m_isBytecodeCacheReadOnly; }
+        inline auto SetPrecompiledScriptLoadingEnabled(const bool isPrecompiledScriptLoadingEnabled) noexcept -> void { m_isPrecompiledScriptLoadingEnabled = isPrecompiledScriptLoadingEnabled; }
+        [[nodiscard]] inline auto IsPrecompiledScriptLoadingEnabled() const noexcept -> bool { return m_isPrecompiledScriptLoadingEnabled; }
+
+        auto SetGarbageCollectionMode(const GarbageCollectionMode garbageCollectionMode) -> void;
+        [[nodiscard]] inline auto GetGarbageCollectionMode() const noexcept -> GarbageCollectionMode { return m_garbageCollectionMode; }
+
+        auto CollectGarbage(const f64 timeBudget) -> void;
+        [[nodiscard]] inline auto GetGarbageCollectionStats() const noexcept -> const GarbageCollectionStats& { return m_garbageCollectionStats; }
+        [[nodiscard]] auto GetHeapSize() const -> usize;
 
         [[nodiscard]] inline auto Get(const StringView variableName) const -> decltype(auto) { return m_luaState[variableName]; }
 
@@ -159,11 +212,18 @@ namespace stardust
         [[nodiscard]] inline auto GetState() const noexcept -> const sol::state& { return m_luaState; }
 
     private:
+        [[nodiscard]] auto RunScript(const StringView script, const String& chunkName, const sol::load_mode loadMode) -> Status;
+        [[nodiscard]] auto RunChunk(const sol::protected_function& chunk) -> Status;
+
+        auto LoadCoreFunctions() -> void;
+
         auto LoadApplicationFunctions(class Application& application) -> void;
+        auto LoadLoggingFunctions() -> void;
         auto LoadMathFunctions() -> void;
         auto LoadGraphicsFunctions(class Application& application) -> void;
         auto LoadAnimationFunctions() -> void;
         auto LoadUIFunctions() -> void;
+        auto LoadECSFunctions(class Application& application) -> void;
     };
 }
 
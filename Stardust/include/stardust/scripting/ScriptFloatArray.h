@@ -0,0 +1,54 @@
+#pragma once
+#ifndef STARDUST_SCRIPT_FLOAT_ARRAY_H
+#define STARDUST_SCRIPT_FLOAT_ARRAY_H
+
+#include <sol/sol.hpp>
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    class ScriptFloatArray final
+    {
+    public:
+        static constexpr const char* MetatableName = "stardust.float_array";
+
+        struct Header final
+        {
+            u32 size;
+            u32 capacity;
+        };
+
+    private:
+        sol::userdata m_userdata{ };
+
+        Header* m_header = nullptr;
+        f32* m_data = nullptr;
+
+    public:
+        ScriptFloatArray() = default;
+        ScriptFloatArray(lua_State* const luaState, const u32 capacity);
+        ~ScriptFloatArray() noexcept = default;
+
+        auto Initialise(lua_State* const luaState, const u32 capacity) -> void;
+        auto Reserve(lua_State* const luaState, const u32 capacity) -> void;
+
+        inline auto Resize(const u32 size) noexcept -> void { m_header->size = size; }
+
+        [[nodiscard]] inline auto operator [](const u32 index) noexcept -> f32& { return m_data[index]; }
+        [[nodiscard]] inline auto operator [](const u32 index) const noexcept -> f32 { return m_data[index]; }
+
+        [[nodiscard]] inline auto GetData() noexcept -> Slice<f32> { return Slice<f32>(m_data, GetSize()); }
+        [[nodiscard]] inline auto GetData() const noexcept -> Slice<const f32> { return Slice<const f32>(m_data, GetSize()); }
+
+        [[nodiscard]] inline auto GetSize() const noexcept -> u32 { return m_header != nullptr ? m_header->size : 0u; }
+        [[nodiscard]] inline auto GetCapacity() const noexcept -> u32 { return m_header != nullptr ? m_header->capacity : 0u; }
+
+        [[nodiscard]] inline auto GetUserdata() const noexcept -> const sol::userdata& { return m_userdata; }
+
+        [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_header != nullptr; }
+    };
+}
+
+#endif
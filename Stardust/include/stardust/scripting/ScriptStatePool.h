@@ -0,0 +1,92 @@
+#pragma once
+#ifndef STARDUST_SCRIPT_STATE_POOL_H
+#define STARDUST_SCRIPT_STATE_POOL_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+#include "stardust/utility/interfaces/INonmovable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "stardust/scripting/ScriptEngine.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    class ScriptStatePool final
+        : private INoncopyable, private INonmovable
+    {
+    public:
+        using Value = Variant<bool, f64, String>;
+
+        struct Message final
+        {
+            String channel;
+            List<Value> values;
+
+            u32 stateIndex = 0u;
+        };
+
+        using Task = std::function<auto(ScriptEngine&) -> void>;
+
+    private:
+        struct Worker final
+        {
+            ScriptEngine scriptEngine{ };
+
+            std::mutex taskMutex;
+            std::condition_variable_any taskCondition;
+            Queue<Task> tasks{ };
+
+            std::jthread thread;
+        };
+
+        List<UniquePointer<Worker>> m_workers{ };
+
+        std::mutex m_messageMutex;
+        List<Message> m_messages{ };
+
+        std::atomic<u32> m_pendingTaskCount = 0u;
+
+    public:
+        [[nodiscard]] static auto GetDefaultStateCount() noexcept -> u32;
+
+        ScriptStatePool() = default;
+        ScriptStatePool(class Application& application, const u32 stateCount);
+        ~ScriptStatePool() noexcept;
+
+        auto Initialise(class Application& application, const u32 stateCount) -> void;
+        auto Shutdown() -> void;
+
+        [[nodiscard]] inline auto IsValid() const noexcept -> bool { return !m_workers.empty(); }
+        [[nodiscard]] inline auto GetStateCount() const noexcept -> u32 { return static_cast<u32>(m_workers.size()); }
+
+        auto LoadScript(const StringView script) -> void;
+        auto LoadScriptFile(const StringView scriptFilepath) -> void;
+
+        auto Submit(const u32 stateIndex, Task&& task) -> void;
+        auto Send(const u32 stateIndex, Message message) -> void;
+        auto Broadcast(const Message& message) -> void;
+
+        auto PushMessage(Message&& message) -> void;
+        [[nodiscard]] auto ReceiveMessages() -> List<Message>;
+
+        auto Flush() -> void;
+
+        [[nodiscard]] inline auto GetPendingTaskCount() const noexcept -> u32 { return m_pendingTaskCount.load(std::memory_order::acquire); }
+        [[nodiscard]] inline auto IsIdle() const noexcept -> bool { return GetPendingTaskCount() == 0u; }
+
+    private:
+        auto LoadPoolFunctions(ScriptEngine& scriptEngine, const u32 stateIndex) -> void;
+
+        auto RunWorkerThread(Worker& worker, const std::stop_token stopToken) -> void;
+    };
+}
+
+#endif
@@ -0,0 +1,80 @@
+#pragma once
+#ifndef STARDUST_SCRIPT_TRANSFORM_VIEW_H
+#define STARDUST_SCRIPT_TRANSFORM_VIEW_H
+
+#include "stardust/utility/interfaces/INoncopyable.h"
+
+#include <sol/sol.hpp>
+
+#include "stardust/ecs/entity/EntityHandle.h"
+#include "stardust/ecs/registry/EntityRegistry.h"
+#include "stardust/scripting/ScriptFloatArray.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/Primitives.h"
+#include "stardust/utility/error_handling/Status.h"
+
+namespace stardust
+{
+    class ScriptTransformView final
+        : private INoncopyable
+    {
+    public:
+        static constexpr u32 DefaultChunkSize = 256u;
+
+        enum class Field
+            : usize
+        {
+            TranslationX,
+            TranslationY,
+            ScaleX,
+            ScaleY,
+            Rotation,
+        };
+
+        static constexpr usize FieldCount = 5u;
+
+        using ScriptArrays = Tuple<u32, sol::userdata, sol::userdata, sol::userdata, sol::userdata, sol::userdata>;
+
+    private:
+        lua_State* m_luaState = nullptr;
+
+        Array<ScriptFloatArray, FieldCount> m_fieldArrays{ };
+        List<EntityHandle> m_entities{ };
+
+        bool m_isIterating = false;
+
+    public:
+        ScriptTransformView() = default;
+        explicit ScriptTransformView(lua_State* const luaState);
+        ~ScriptTransformView() noexcept = default;
+
+        auto Initialise(lua_State* const luaState) -> void;
+
+        auto Gather(const EntityRegistry& registry) -> u32;
+        auto Scatter(EntityRegistry& registry) const -> void;
+
+        [[nodiscard]] auto ForEach(EntityRegistry& registry, const sol::protected_function& function, const u32 chunkSize = DefaultChunkSize) -> Status;
+        [[nodiscard]] inline auto IsIterating() const noexcept -> bool { return m_isIterating; }
+
+        [[nodiscard]] auto GetScriptArrays() const -> ScriptArrays;
+
+        [[nodiscard]] inline auto GetFieldArray(const Field field) noexcept -> ScriptFloatArray& { return m_fieldArrays[static_cast<usize>(field)]; }
+        [[nodiscard]] inline auto GetFieldArray(const Field field) const noexcept -> const ScriptFloatArray& { return m_fieldArrays[static_cast<usize>(field)]; }
+
+        [[nodiscard]] inline auto GetEntities() const noexcept -> const List<EntityHandle>& { return m_entities; }
+        [[nodiscard]] inline auto GetEntityCount() const noexcept -> u32 { return static_cast<u32>(m_entities.size()); }
+
+        [[nodiscard]] inline auto IsValid() const noexcept -> bool { return m_luaState != nullptr; }
+
+    private:
+        auto ReserveArrays(const u32 capacity) -> void;
+        auto ResizeArrays(const u32 size) -> void;
+
+        [[nodiscard]] auto IterateChunks(EntityRegistry& registry, const sol::protected_function& function, const u32 chunkSize) -> Status;
+
+        auto ReadTransforms(const EntityRegistry& registry, const usize firstEntityIndex, const u32 entityCount) -> void;
+        auto WriteTransforms(EntityRegistry& registry, const usize firstEntityIndex, const u32 entityCount) const -> void;
+    };
+}
+
+#endif
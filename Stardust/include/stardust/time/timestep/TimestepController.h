@@ -44,6 +44,9 @@ namespace stardust
         u32 m_frameSkipCounter = 0u;
         bool m_skipNextFrame = false;
 
+        bool m_isFixedFrameStepEnabled = false;
+        f64 m_fixedFrameStep = 0.0;
+
     public:
         auto Start() -> void;
         auto Update(f64& elapsedTime) -> void;
@@ -70,6 +73,11 @@ namespace stardust
         [[nodiscard]] auto GetFrameSkipType() const noexcept -> FrameSkipType { return m_frameSkipType; }
         auto SetFrameSkipType(const FrameSkipType frameSkipType) noexcept -> void { m_frameSkipType = frameSkipType; }
         [[nodiscard]] inline auto SkipNextFrame() const noexcept -> bool { return m_skipNextFrame; }
+
+        [[nodiscard]] inline auto IsFixedFrameStepEnabled() const noexcept -> bool { return m_isFixedFrameStepEnabled; }
+        auto EnableFixedFrameStep(const f64 frameStep) noexcept -> void;
+        auto DisableFixedFrameStep() noexcept -> void;
+        [[nodiscard]] inline auto GetFixedFrameStep() const noexcept -> f64 { return m_fixedFrameStep; }
     };
 }
 
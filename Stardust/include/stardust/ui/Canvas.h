@@ -8,12 +8,15 @@
 
 #include "stardust/ecs/bundle/EntityBundle.h"
 #include "stardust/ecs/entity/Entity.h"
+#include "stardust/geometry/Shapes.h"
 #include "stardust/graphics/renderer/Renderer.h"
 #include "stardust/scene/Scene.h"
 #include "stardust/scripting/ScriptEngine.h"
 #include "stardust/types/Containers.h"
+#include "stardust/types/MathTypes.h"
 #include "stardust/types/Pointers.h"
 #include "stardust/types/Primitives.h"
+#include "stardust/ui/HitTestTree.h"
 #include "stardust/ui/UIComponent.h"
 
 namespace stardust
@@ -37,6 +40,14 @@ namespace stardust
 
             using ComponentCreateHook = std::function<auto(Component&, Entity&, Scene&, const ComponentInfo&, const Optional<Any>&) -> void>;
 
+            struct LayoutEntry final
+            {
+                ObserverPointer<Component> component;
+                geometry::ScreenRectangle rectangle;
+
+                u32 depth;
+            };
+
         private:
             inline static HashMap<String, ComponentCreateHook> s_componentCreateHooks{ };
 
@@ -45,6 +56,12 @@ namespace stardust
             ObserverPointer<Scene> m_scene = nullptr;
             bool m_didLoadSuccessfully = false;
 
+            List<LayoutEntry> m_layout{ };
+            HitTestTree m_hitTestTree{ };
+            UVector2 m_layoutScreenSize = UVector2Zero;
+            bool m_isLayoutDirty = true;
+            bool m_isLayoutStructureDirty = true;
+
         public:
             static auto RegisterComponentCreateHook(const String& componentName, const ComponentCreateHook& createHook) -> void;
             [[nodiscard]] inline static auto GetComponentCreateHooks() noexcept -> const HashMap<String, ComponentCreateHook>& { return s_componentCreateHooks; }
@@ -58,7 +75,7 @@ namespace stardust
             auto CreateChild(const Component::Key& key, const ObserverPointer<EntityBundle> entityBundle = nullptr) -> Component&;
             auto CreateChildWithHook(const Component::Key& key, const String& hookName, const ObserverPointer<EntityBundle> entityBundle = nullptr, const Optional<Any>& userData = None) -> Component&;
             auto AddChild(const Component::Key& key, UniquePointer<Component>&& child) -> Component&;
-            inline auto RemoveChild(const Component::Key& key) -> void { m_childComponents.erase(key); }
+            inline auto RemoveChild(const Component::Key& key) -> void { m_childComponents.erase(key); MarkLayoutStructureDirty(); }
 
             [[nodiscard]] inline auto GetChildren() noexcept -> HashMap<Component::Key, UniquePointer<Component>>& { return m_childComponents; }
             [[nodiscard]] inline auto GetChildren() const noexcept -> const HashMap<Component::Key, UniquePointer<Component>>& { return m_childComponents; }
@@ -71,7 +88,20 @@ namespace stardust
 
             [[nodiscard]] inline auto DidLoadSuccessfully() const noexcept -> bool { return m_didLoadSuccessfully; }
 
+            auto UpdateLayout() -> void;
+            [[nodiscard]] inline auto GetLayout() const noexcept -> const List<LayoutEntry>& { return m_layout; }
+            [[nodiscard]] inline auto GetLayoutScreenSize() const noexcept -> UVector2 { return m_layoutScreenSize; }
+
+            [[nodiscard]] auto GetComponentAtPoint(const geometry::ScreenPoint point) -> ObserverPointer<Component>;
+            [[nodiscard]] auto GetComponentsAtPoint(const geometry::ScreenPoint point) -> List<ObserverPointer<Component>>;
+
+            inline auto MarkLayoutDirty() noexcept -> void { m_isLayoutDirty = true; }
+            inline auto MarkLayoutStructureDirty() noexcept -> void { m_isLayoutStructureDirty = true; m_isLayoutDirty = true; }
+
         private:
+            auto RebuildLayoutEntries() -> void;
+            auto UpdateComponentLayout(Component& component) -> void;
+
             auto LoadComponentsFromXML(const XML& xml, const StringView xmlFilepath, const ObserverPointer<EntityBundle> entityBundle, const Optional<Any>& userData) -> void;
         };
     }
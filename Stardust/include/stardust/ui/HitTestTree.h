@@ -0,0 +1,59 @@
+#pragma once
+#ifndef STARDUST_HIT_TEST_TREE_H
+#define STARDUST_HIT_TEST_TREE_H
+
+#include "stardust/geometry/Shapes.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/MathTypes.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace ui
+    {
+        class HitTestTree final
+        {
+        public:
+            static constexpr u32 MaxLeafItemCount = 4u;
+
+        private:
+            struct Node final
+            {
+                IVector2 minimum;
+                IVector2 maximum;
+
+                u32 firstIndex;
+                u32 itemCount;
+
+                u32 highestItemIndex;
+            };
+
+            List<geometry::ScreenRectangle> m_rectangles{ };
+            List<u32> m_itemIndices{ };
+            List<Node> m_nodes{ };
+
+            bool m_needsRebuild = false;
+            bool m_needsRefit = false;
+
+        public:
+            auto Reset(const usize itemCount) -> void;
+            auto SetRectangle(const u32 itemIndex, const geometry::ScreenRectangle& rectangle) -> void;
+            auto Update() -> void;
+
+            [[nodiscard]] auto FindTopmostItem(const geometry::ScreenPoint point) const -> Optional<u32>;
+            auto FindItems(const geometry::ScreenPoint point, List<u32>& itemIndices) const -> void;
+
+            [[nodiscard]] inline auto GetItemCount() const noexcept -> usize { return m_rectangles.size(); }
+            [[nodiscard]] inline auto GetNodeCount() const noexcept -> usize { return m_nodes.size(); }
+
+        private:
+            auto Rebuild() -> void;
+            auto Refit() -> void;
+
+            auto BuildNode(const u32 nodeIndex, const u32 firstIndex, const u32 itemCount) -> void;
+            auto FitLeafNode(Node& node) const -> void;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,130 @@
+#pragma once
+#ifndef STARDUST_UI_STYLE_H
+#define STARDUST_UI_STYLE_H
+
+#include <type_traits>
+
+#include "stardust/graphics/colour/Colour.h"
+#include "stardust/scripting/ScriptEngine.h"
+#include "stardust/types/Containers.h"
+#include "stardust/types/Pointers.h"
+#include "stardust/types/Primitives.h"
+#include "stardust/utility/hash/Hash.h"
+
+namespace stardust
+{
+    namespace ui
+    {
+        class Style final
+        {
+        public:
+            using Key = u64;
+            using Value = Variant<bool, f64, String, Colour>;
+
+            static constexpr u32 MaxInheritanceDepth = 16u;
+
+        private:
+            struct Property final
+            {
+                Key key;
+                Value value;
+            };
+
+            List<Property> m_properties{ };
+
+        public:
+            [[nodiscard]] static constexpr auto MakeKey(const StringView name) noexcept -> Key
+            {
+                return hash::FNV1a(name);
+            }
+
+            [[nodiscard]] static auto FromTable(const Table& styleTable) -> Style;
+
+            auto Inherit(const Style& baseStyle) -> void;
+            auto Override(const Style& overrideStyle) -> void;
+
+            [[nodiscard]] auto Has(const Key key) const noexcept -> bool;
+            [[nodiscard]] auto Find(const Key key) const noexcept -> ObserverPointer<const Value>;
+
+            template <typename T>
+            [[nodiscard]] auto Get(const Key key) const -> Optional<T>
+            {
+                const ObserverPointer<const Value> value = Find(key);
+
+                if (value == nullptr)
+                {
+                    return None;
+                }
+
+                if constexpr (std::is_same_v<T, bool>)
+                {
+                    if (const ObserverPointer<const bool> boolean = std::get_if<bool>(value);
+                        boolean != nullptr)
+                    {
+                        return *boolean;
+                    }
+                }
+                else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+                {
+                    if (const ObserverPointer<const f64> number = std::get_if<f64>(value);
+                        number != nullptr)
+                    {
+                        return static_cast<T>(*number);
+                    }
+                }
+                else if constexpr (std::is_same_v<T, Colour>)
+                {
+                    if (const ObserverPointer<const Colour> colour = std::get_if<Colour>(value);
+                        colour != nullptr)
+                    {
+                        return *colour;
+                    }
+                }
+                else if constexpr (std::is_constructible_v<T, const String&>)
+                {
+                    if (const ObserverPointer<const String> string = std::get_if<String>(value);
+                        string != nullptr)
+                    {
+                        return T(*string);
+                    }
+                }
+
+                return None;
+            }
+
+            template <typename T>
+            [[nodiscard]] inline auto GetOrDefault(const Key key, const T& defaultValue) const -> T
+            {
+                return Get<T>(key).value_or(defaultValue);
+            }
+
+            template <typename T>
+            auto Set(const Key key, const T& value) -> void
+            {
+                if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, Colour> || std::is_same_v<T, Value>)
+                {
+                    SetValue(key, Value(value));
+                }
+                else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+                {
+                    SetValue(key, Value(static_cast<f64>(value)));
+                }
+                else
+                {
+                    SetValue(key, Value(String(value)));
+                }
+            }
+
+            auto Remove(const Key key) -> void;
+            inline auto Clear() noexcept -> void { m_properties.clear(); }
+
+            [[nodiscard]] inline auto GetPropertyCount() const noexcept -> usize { return m_properties.size(); }
+            [[nodiscard]] inline auto IsEmpty() const noexcept -> bool { return m_properties.empty(); }
+
+        private:
+            auto SetValue(const Key key, Value&& value) -> void;
+        };
+    }
+}
+
+#endif
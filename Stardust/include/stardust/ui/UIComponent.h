@@ -7,6 +7,7 @@
 #include "stardust/camera/Camera2D.h"
 #include "stardust/ecs/bundle/EntityBundle.h"
 #include "stardust/ecs/entity/EntityHandle.h"
+#include "stardust/geometry/Shapes.h"
 #include "stardust/graphics/renderer/Renderer.h"
 #include "stardust/scene/Scene.h"
 #include "stardust/scripting/ScriptEngine.h"
@@ -14,6 +15,7 @@
 #include "stardust/types/MathTypes.h"
 #include "stardust/types/Pointers.h"
 #include "stardust/types/Primitives.h"
+#include "stardust/ui/Style.h"
 #include "stardust/ui/UI.h"
 
 namespace stardust
@@ -35,10 +37,15 @@ namespace stardust
             Anchor m_anchor = Anchor::TopLeft;
             IVector2 m_anchorOffset = IVector2Zero;
 
-            Table m_styles;
+            Style m_styles{ };
 
             u32 m_depth;
 
+            geometry::ScreenRectangle m_absoluteRectangle{ };
+            u32 m_layoutIndex = 0u;
+            bool m_isLayoutDirty = true;
+            bool m_hasDirtyDescendant = false;
+
             ObserverPointer<class Canvas> m_canvas = nullptr;
             ObserverPointer<Component> m_parent = nullptr;
             HashMap<Key, UniquePointer<Component>> m_childComponents{ };
@@ -49,7 +56,7 @@ namespace stardust
         public:
             friend class Canvas;
 
-            Component(class Canvas& canvas, const StringView key, const EntityHandle associatedEntityHandle, const u32 depth, Scene& scene);
+            Component(const ObserverPointer<class Canvas> canvas, const StringView key, const EntityHandle associatedEntityHandle, const u32 depth, Scene& scene);
 
             Component(Component&&) noexcept = default;
             auto operator =(Component&&) noexcept -> Component& = default;
@@ -60,43 +67,57 @@ namespace stardust
             [[nodiscard]] inline auto GetAssociatedEntityHandle() const noexcept -> EntityHandle { return m_associatedEntityHandle; }
 
             [[nodiscard]] inline auto GetSize() const noexcept -> UVector2 { return m_size; }
-            inline auto SetSize(const UVector2 size) noexcept -> void { m_size = size; }
+            inline auto SetSize(const UVector2 size) noexcept -> void { m_size = size; MarkLayoutDirty(); }
             [[nodiscard]] inline auto GetWidth() const noexcept -> u32 { return m_size.x; }
-            inline auto SetWidth(const u32 width) noexcept -> void { m_size.x = width; }
+            inline auto SetWidth(const u32 width) noexcept -> void { m_size.x = width; MarkLayoutDirty(); }
             [[nodiscard]] inline auto GetHeight() const noexcept -> u32 { return m_size.y; }
-            inline auto SetHeight(const u32 height) noexcept -> void { m_size.y = height; }
+            inline auto SetHeight(const u32 height) noexcept -> void { m_size.y = height; MarkLayoutDirty(); }
 
             [[nodiscard]] inline auto GetAnchor() const noexcept -> Anchor { return m_anchor; }
-            inline auto SetAnchor(const Anchor anchor) noexcept -> void { m_anchor = anchor; }
+            inline auto SetAnchor(const Anchor anchor) noexcept -> void { m_anchor = anchor; MarkLayoutDirty(); }
             [[nodiscard]] inline auto GetAnchorOffset() const noexcept -> IVector2 { return m_anchorOffset; }
-            inline auto SetAnchorOffset(const IVector2 anchorOffset) noexcept -> void { m_anchorOffset = anchorOffset; }
-            inline auto ShiftAnchorOffset(const IVector2 offset) noexcept -> void { m_anchorOffset += offset; }
+            inline auto SetAnchorOffset(const IVector2 anchorOffset) noexcept -> void { m_anchorOffset = anchorOffset; MarkLayoutDirty(); }
+            inline auto ShiftAnchorOffset(const IVector2 offset) noexcept -> void { m_anchorOffset += offset; MarkLayoutDirty(); }
+
+            [[nodiscard]] inline auto GetStyles() const noexcept -> const Style& { return m_styles; }
+            inline auto SetStyles(const Style& styles) -> void { m_styles = styles; }
+            inline auto SetStyles(const Table& stylesTable) -> void { m_styles = Style::FromTable(stylesTable); }
+            inline auto OverrideStyles(const Table& overridesTable) -> void { m_styles.Override(Style::FromTable(overridesTable)); }
+
+            [[nodiscard]] inline auto HasStyle(const Style::Key styleKey) const noexcept -> bool { return m_styles.Has(styleKey); }
+            [[nodiscard]] inline auto HasStyle(const StringView styleName) const noexcept -> bool { return m_styles.Has(Style::MakeKey(styleName)); }
+
+            template <typename T>
+            [[nodiscard]] inline auto GetStyle(const Style::Key styleKey) const -> Optional<T> { return m_styles.Get<T>(styleKey); }
+
+            template <typename T>
+            [[nodiscard]] inline auto GetStyle(const StringView styleName) const -> Optional<T> { return m_styles.Get<T>(Style::MakeKey(styleName)); }
+
+            template <typename T>
+            [[nodiscard]] inline auto GetStyleOrDefault(const Style::Key styleKey, const T& defaultValue) const -> T { return m_styles.GetOrDefault<T>(styleKey, defaultValue); }
 
-            [[nodiscard]] inline auto GetStyles() const noexcept -> const Table& { return m_styles; }
-            inline auto SetStyles(const Table& stylesTable) -> void { m_styles = stylesTable; }
-            [[nodiscard]] inline auto HasStyle(const String& styleKey) const -> bool { return m_styles[styleKey] != Nil; }
-            [[nodiscard]] inline auto GetStyle(const String& styleKey) const -> TableProxy { return m_styles[styleKey]; }
+            template <typename T>
+            [[nodiscard]] inline auto GetStyleOrDefault(const StringView styleName, const T& defaultValue) const -> T { return m_styles.GetOrDefault<T>(Style::MakeKey(styleName), defaultValue); }
 
             template <typename T>
-            [[nodiscard]] auto GetStyleOrDefault(const String& styleKey, const T& defaultValue) const -> T
-            {
-                return HasStyle(styleKey)
-                    ? m_styles[styleKey]
-                    : defaultValue;
-            }
+            inline auto SetStyle(const Style::Key styleKey, const T& styleValue) -> void { m_styles.Set(styleKey, styleValue); }
 
             template <typename T>
-            inline auto SetStyle(const String& styleKey, const T& styleValue) -> void { m_styles[styleKey] = styleValue; }
+            inline auto SetStyle(const StringView styleName, const T& styleValue) -> void { m_styles.Set(Style::MakeKey(styleName), styleValue); }
 
             [[nodiscard]] auto GetAbsolutePosition() const -> IVector2;
+            [[nodiscard]] auto GetAbsoluteRectangle() const -> geometry::ScreenRectangle;
             auto SetRelativePosition(const Anchor anchor, const IVector2 anchorOffset = IVector2Zero) noexcept -> void;
 
             [[nodiscard]] inline auto GetDepth() const noexcept -> u32 { return m_depth; }
 
+            [[nodiscard]] inline auto IsLayoutDirty() const noexcept -> bool { return m_isLayoutDirty; }
+            auto MarkLayoutDirty() noexcept -> void;
+
             auto CreateChild(const Key& key, const ObserverPointer<EntityBundle> entityBundle = nullptr) -> Component&;
             auto CreateChildWithHook(const Key& key, const String& hookName, const ObserverPointer<EntityBundle> entityBundle = nullptr, const Optional<Any>& userData = None) -> Component&;
             auto AddChild(const Key& key, UniquePointer<Component>&& child) -> Component&;
-            inline auto RemoveChild(const Key& key) -> void { m_childComponents.erase(key); }
+            auto RemoveChild(const Key& key) -> void;
 
             [[nodiscard]] inline auto GetChildren() noexcept -> HashMap<Key, UniquePointer<Component>>& { return m_childComponents; }
             [[nodiscard]] inline auto GetChildren() const noexcept -> const HashMap<Key, UniquePointer<Component>>& { return m_childComponents; }
@@ -117,6 +138,11 @@ namespace stardust
         private:
             inline auto SetParent(const ObserverPointer<Component> parent) noexcept -> void { m_parent = parent; }
             inline auto SetDepth(const u32 depth) noexcept -> void { m_depth = depth; }
+            auto AttachToCanvas(const ObserverPointer<class Canvas> canvas, const u32 depth) noexcept -> void;
+
+            [[nodiscard]] auto IsCachedLayoutCurrent() const noexcept -> bool;
+            [[nodiscard]] auto ComputeAbsolutePosition() const -> IVector2;
+            auto MarkSubtreeLayoutDirty() noexcept -> void;
         };
     }
 }
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef STARDUST_HASH_H
+#define STARDUST_HASH_H
+
+#include "stardust/types/Containers.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace hash
+    {
+        constexpr u64 FNV1aOffsetBasis = 0xCBF29CE484222325u;
+        constexpr u64 FNV1aPrime = 0x00000100000001B3u;
+
+        [[nodiscard]] constexpr auto FNV1a(const StringView string, const u64 seed = FNV1aOffsetBasis) noexcept -> u64
+        {
+            u64 hash = seed;
+
+            for (const char character : string)
+            {
+                hash ^= static_cast<u64>(static_cast<u8>(character));
+                hash *= FNV1aPrime;
+            }
+
+            return hash;
+        }
+
+        [[nodiscard]] constexpr auto FNV1a(const Slice<const ubyte> bytes, const u64 seed = FNV1aOffsetBasis) noexcept -> u64
+        {
+            u64 hash = seed;
+
+            for (const ubyte byte : bytes)
+            {
+                hash ^= static_cast<u64>(byte);
+                hash *= FNV1aPrime;
+            }
+
+            return hash;
+        }
+    }
+}
+
+#endif
@@ -1,11 +1,16 @@
 #include "stardust/application/Application.h"
 
+#include <algorithm>
+#include <chrono>
+#include <format>
 #include <limits>
+#include <numeric>
 #include <string>
 
 #include "stardust/debug/assert/Assert.h"
 #include "stardust/debug/logging/Logging.h"
 #include "stardust/filesystem/vfs/VirtualFilesystem.h"
+#include "stardust/filesystem/Filesystem.h"
 #include "stardust/graphics/backend/OpenGL.h"
 #include "stardust/input/controller/GameController.h"
 #include "stardust/input/controller/GameControllerCodes.h"
@@ -35,6 +40,8 @@ namespace stardust
             m_onExit.value()(*this);
         }
 
+        m_assetLoader.Shutdown();
+        m_scriptStatePool.Shutdown();
         m_globalSceneResources.Clear();
         m_entityRegistry.ClearAllEntities();
         m_inputController.GetGameControllerLobby().RemoveAllGameControllers();
@@ -85,6 +92,14 @@ namespace stardust
 
         while (m_isRunning.load(std::memory_order::relaxed))
         {
+            const auto frameStartTime = std::chrono::steady_clock::now();
+
+            if (const Optional<f64> replayDeltaTime = m_inputController.GetReplayDeltaTime();
+                replayDeltaTime.has_value())
+            {
+                m_timestepController.EnableFixedFrameStep(replayDeltaTime.value());
+            }
+
             m_timestepController.Update(m_elapsedTime);
 
             while (m_timestepController.HasFixedTimeAccumulated())
@@ -106,10 +121,23 @@ namespace stardust
                 Render();
             }
 
+            CollectScriptGarbage(std::chrono::duration<f64>(std::chrono::steady_clock::now() - frameStartTime).count());
+
             PollEvents(event);
             UpdateSceneQueue();
+
+            if (m_inputController.IsReplaying())
+            {
+                m_replayFrameSamples.push_back(FrameSample{
+                    .frameTime = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - frameStartTime).count(),
+                    .scriptGarbageCollectionTime = m_scriptEngine.GetGarbageCollectionStats().collectionTime * 1'000.0,
+                    .scriptHeapSize = m_scriptEngine.GetGarbageCollectionStats().heapSize,
+                });
+            }
         }
 
+        FinishInputRecording();
+
         if (!m_sceneManager.IsEmpty())
         {
             m_sceneManager.CurrentScene()->GetLayerStack().RemoveAllLayers();
@@ -135,6 +163,7 @@ namespace stardust
     auto Application::ProcessInput() -> void
     {
         m_inputController.Update();
+        m_inputManager.Update();
 
         m_sceneManager.CurrentScene()->ProcessInput(m_inputController, m_inputManager);
     }
@@ -152,7 +181,11 @@ namespace stardust
     auto Application::PostUpdate() -> void
     {
         m_sceneManager.CurrentScene()->PostUpdate(static_cast<f32>(m_timestepController.GetDeltaTime()));
+
+        m_soundSystem.UpdatePositionalSounds(m_sceneManager.CurrentScene()->GetEntityRegistry(), static_cast<f32>(m_timestepController.GetDeltaTime()));
         m_soundSystem.Update();
+
+        m_assetLoader.Update();
     }
 
     auto Application::Render() -> void
@@ -166,696 +199,799 @@ namespace stardust
     #endif
     }
 
+    auto Application::CollectScriptGarbage(const f64 frameTime) -> void
+    {
+        const f64 targetFrameTime = m_timestepController.IsFrameRateTargetting()
+            ? 1.0 / m_timestepController.GetTargetFrameRate()
+            : m_scriptTargetFrameTime;
+
+        m_scriptEngine.CollectGarbage(std::max(targetFrameTime - frameTime, 0.0));
+    }
+
     auto Application::PollEvents(SDL_Event& event) -> void
     {
         m_inputController.GetMouseState().ResetScrollState();
 
         while (SDL_PollEvent(&event) != 0)
         {
-            switch (event.type)
+            if (m_inputController.IsReplaying() && InputRecording::IsRecordableEvent(event))
             {
-            case SDL_QUIT:
-                ForceQuit();
+                continue;
+            }
 
-                break;
+            m_inputController.RecordEvent(event);
+            ProcessEvent(event);
+        }
 
-            case SDL_KEYDOWN:
-            {
-                const auto keyDownEvent = events::KeyDown{
-                    .keyCode = static_cast<KeyCode>(event.key.keysym.scancode),
-                    .virtualKeyCode = static_cast<VirtualKeyCode>(event.key.keysym.sym),
-                    .modState = static_cast<u32>(event.key.keysym.mod),
-                    .isRepeat = event.key.repeat != 0u,
-                };
+        for (const SDL_Event& replayEvent : m_inputController.GetReplayEvents())
+        {
+            ProcessEvent(replayEvent);
+        }
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnKeyDown(keyDownEvent);
+        m_inputController.EndFrame(m_timestepController.GetDeltaTime());
 
-                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                {
-                    m_globalEventHandler->OnKeyDown(*this, keyDownEvent);
-                }
+        if (m_inputController.IsReplaying() && m_inputController.HasReplayFinished())
+        {
+            ForceQuit();
+        }
 
-                break;
-            }
+        while (!m_userEvents.empty())
+        {
+            const events::UserEvent& userEvent = m_userEvents.front();
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnUserEvent(userEvent);
 
-            case SDL_KEYUP:
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
             {
-                const auto keyUpEvent = events::KeyUp{
-                    .keyCode = static_cast<KeyCode>(event.key.keysym.scancode),
-                    .virtualKeyCode = static_cast<VirtualKeyCode>(event.key.keysym.sym),
-                    .modState = static_cast<u32>(event.key.keysym.mod),
-                    .isRepeat = event.key.repeat != 0u,
-                };
+                m_globalEventHandler->OnUserEvent(*this, userEvent);
+            }
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnKeyUp(keyUpEvent);
+            m_userEvents.pop();
+        }
+    }
 
-                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                {
-                    m_globalEventHandler->OnKeyUp(*this, keyUpEvent);
-                }
+    auto Application::FinishInputRecording() -> void
+    {
+        if (m_inputController.IsRecording())
+        {
+            const InputRecording inputRecording = m_inputController.StopRecording();
 
-                break;
+            if (inputRecording.Save(m_inputRecordingFilepath) == Status::Success)
+            {
+                Log::EngineInfo("Recorded {} input frames to {}.", inputRecording.GetFrameCount(), m_inputRecordingFilepath);
             }
-
-            case SDL_TEXTINPUT:
+            else
             {
-                const auto textInputEvent = events::TextInput{
-                    .text = event.text.text,
-                };
-
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTextInput(textInputEvent);
-
-                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                {
-                    m_globalEventHandler->OnTextInput(*this, textInputEvent);
-                }
-
-                break;
+                Log::EngineWarn("Failed to save input recording to {}.", m_inputRecordingFilepath);
             }
+        }
 
-            case SDL_MOUSEBUTTONDOWN:
-            {
-                const auto mouseButtonDownEvent = events::MouseButtonDown{
-                    .mouseButton = static_cast<MouseButton>(event.button.button),
-                    .coordinates = IVector2{ event.button.x, event.button.y },
-                    .clickCount = static_cast<u32>(event.button.clicks),
-                };
+        if (m_inputController.IsReplaying())
+        {
+            m_inputController.StopReplay();
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseButtonDown(mouseButtonDownEvent);
+            if (m_replayFrameSamples.empty())
+            {
+                return;
+            }
 
-                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                {
-                    m_globalEventHandler->OnMouseButtonDown(*this, mouseButtonDownEvent);
-                }
+            List<f64> sortedFrameTimes{ };
+            sortedFrameTimes.reserve(m_replayFrameSamples.size());
 
-                break;
+            for (const FrameSample& frameSample : m_replayFrameSamples)
+            {
+                sortedFrameTimes.push_back(frameSample.frameTime);
             }
 
-            case SDL_MOUSEBUTTONUP:
-            {
-                const auto mouseButtonUpEvent = events::MouseButtonUp{
-                    .mouseButton = static_cast<MouseButton>(event.button.button),
-                    .coordinates = IVector2{ event.button.x, event.button.y },
-                    .clickCount = static_cast<u32>(event.button.clicks),
-                };
+            std::ranges::sort(sortedFrameTimes);
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseButtonUp(mouseButtonUpEvent);
+            const auto getPercentile = [&sortedFrameTimes](const f64 percentile) -> f64
+            {
+                return sortedFrameTimes[static_cast<usize>(percentile * static_cast<f64>(sortedFrameTimes.size() - 1u))];
+            };
 
-                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                {
-                    m_globalEventHandler->OnMouseButtonUp(*this, mouseButtonUpEvent);
-                }
+            const f64 meanFrameTime = std::accumulate(std::cbegin(sortedFrameTimes), std::cend(sortedFrameTimes), 0.0) / static_cast<f64>(sortedFrameTimes.size());
 
-                break;
-            }
+            Log::EngineInfo(
+                "Replayed {} frames: mean {:.3f} ms, median {:.3f} ms, 95th percentile {:.3f} ms, 99th percentile {:.3f} ms, max {:.3f} ms.",
+                sortedFrameTimes.size(),
+                meanFrameTime,
+                getPercentile(0.5),
+                getPercentile(0.95),
+                getPercentile(0.99),
+                sortedFrameTimes.back()
+            );
 
-            case SDL_MOUSEMOTION:
+            if (!m_frameTimesFilepath.empty())
             {
-                const auto mouseMotionEvent = events::MouseMotion{
-                    .coordinates = IVector2{ event.motion.x, event.motion.y },
-                    .relativeCoordinates = IVector2{ event.motion.xrel, event.motion.yrel },
-                };
+                String frameTimesCSV = "frame,milliseconds,script_gc_milliseconds,script_heap_bytes\n";
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseMotion(mouseMotionEvent);
-
-                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+                for (usize i = 0u; i < m_replayFrameSamples.size(); ++i)
                 {
-                    m_globalEventHandler->OnMouseMotion(*this, mouseMotionEvent);
+                    const FrameSample& frameSample = m_replayFrameSamples[i];
+
+                    frameTimesCSV += std::format("{},{:.6f},{:.6f},{}\n", i, frameSample.frameTime, frameSample.scriptGarbageCollectionTime, frameSample.scriptHeapSize);
                 }
 
-                break;
+                if (filesystem::WriteToFile(m_frameTimesFilepath, frameTimesCSV) != Status::Success)
+                {
+                    Log::EngineWarn("Failed to write replay frame times to {}.", m_frameTimesFilepath);
+                }
             }
+        }
+    }
 
-            case SDL_MOUSEWHEEL:
-            {
-                m_inputController.GetMouseState().UpdateScrollState(event.wheel.y, event.wheel.preciseY);
+    auto Application::ProcessEvent(const SDL_Event& event) -> void
+    {
+        switch (event.type)
+        {
+        case SDL_QUIT:
+            ForceQuit();
 
-                const auto mouseScrollEvent = events::MouseScroll{
-                    .scrollAmount = event.wheel.y,
-                    .preciseScrollAmount = event.wheel.preciseY,
-                };
+            break;
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseScroll(mouseScrollEvent);
+        case SDL_KEYDOWN:
+        {
+            const auto keyDownEvent = events::KeyDown{
+                .keyCode = static_cast<KeyCode>(event.key.keysym.scancode),
+                .virtualKeyCode = static_cast<VirtualKeyCode>(event.key.keysym.sym),
+                .modState = static_cast<u32>(event.key.keysym.mod),
+                .isRepeat = event.key.repeat != 0u,
+            };
 
-                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                {
-                    m_globalEventHandler->OnMouseScroll(*this, mouseScrollEvent);
-                }
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnKeyDown(keyDownEvent);
 
-                break;
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnKeyDown(*this, keyDownEvent);
             }
 
-            case SDL_CONTROLLERDEVICEADDED:
-                if (const ObserverPointer<GameController> gameController = m_inputController.GetGameControllerLobby().AddGameController(event.cdevice.which);
-                    gameController != nullptr)
-                {
-                    Log::EngineInfo("Game controller \"{}\" added (ID: {}; GUID: {}).", gameController->GetName(), gameController->GetID(), gameController->GetGUID());
-
-                    const auto gameControllerAddedEvent = events::GameControllerAdded{
-                        .gameController = gameController,
-                    };
+            break;
+        }
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerAdded(gameControllerAddedEvent);
+        case SDL_KEYUP:
+        {
+            const auto keyUpEvent = events::KeyUp{
+                .keyCode = static_cast<KeyCode>(event.key.keysym.scancode),
+                .virtualKeyCode = static_cast<VirtualKeyCode>(event.key.keysym.sym),
+                .modState = static_cast<u32>(event.key.keysym.mod),
+                .isRepeat = event.key.repeat != 0u,
+            };
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerAdded(*this, gameControllerAddedEvent);
-                    }
-                }
-                else
-                {
-                    message_box::ShowComplex(
-                        m_locale["engine"]["warnings"]["titles"]["game-controller"],
-                        m_locale({ "engine", "warnings", "bodies", "game-controller" }, {
-                            { "GAME_CONTROLLER_ID", std::to_string(event.cdevice.which) },
-                        }),
-                        message_box::Type::Warning,
-                        List<message_box::ButtonData>{
-                            message_box::ButtonData{
-                                .id = 0,
-                                .text = m_locale["engine"]["buttons"]["continue"],
-                                .flags = {
-                                    message_box::ButtonFlag::ReturnKeyDefault,
-                                    message_box::ButtonFlag::EscapeKeyDefault,
-                                },
-                            },
-                        }
-                    );
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnKeyUp(keyUpEvent);
 
-                    Log::EngineWarn("Failed to add game controller (ID: {}).", event.cdevice.which);
-                }
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnKeyUp(*this, keyUpEvent);
+            }
 
-                break;
+            break;
+        }
 
-            case SDL_CONTROLLERDEVICEREMOVED:
-                if (const ObserverPointer<const GameController> gameController = m_inputController.GetGameControllerLobby().GetGameController(event.cdevice.which);
-                    gameController != nullptr)
-                {
-                    Log::EngineInfo("Game controller {} removed.", gameController->GetID());
+        case SDL_TEXTINPUT:
+        {
+            const auto textInputEvent = events::TextInput{
+                .text = event.text.text,
+            };
 
-                    const auto gameControllerRemovedEvent = events::GameControllerRemoved{
-                        .gameController = gameController,
-                    };
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTextInput(textInputEvent);
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerRemoved(gameControllerRemovedEvent);
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnTextInput(*this, textInputEvent);
+            }
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerRemoved(*this, gameControllerRemovedEvent);
-                    }
-                }
+            break;
+        }
 
-                m_inputController.GetGameControllerLobby().RemoveGameController(event.cdevice.which);
+        case SDL_MOUSEBUTTONDOWN:
+        {
+            const auto mouseButtonDownEvent = events::MouseButtonDown{
+                .mouseButton = static_cast<MouseButton>(event.button.button),
+                .coordinates = IVector2{ event.button.x, event.button.y },
+                .clickCount = static_cast<u32>(event.button.clicks),
+            };
 
-                break;
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseButtonDown(mouseButtonDownEvent);
 
-            case SDL_CONTROLLERBUTTONDOWN:
-                if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.cbutton.which))
-                {
-                    const auto gameControllerButtonDownEvent = events::GameControllerButtonDown{
-                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.cbutton.which),
-                        .button = static_cast<GameControllerButton>(static_cast<SDL_GameControllerButton>(event.cbutton.button)),
-                    };
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnMouseButtonDown(*this, mouseButtonDownEvent);
+            }
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerButtonDown(gameControllerButtonDownEvent);
+            break;
+        }
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerButtonDown(*this, gameControllerButtonDownEvent);
-                    }
-                }
+        case SDL_MOUSEBUTTONUP:
+        {
+            const auto mouseButtonUpEvent = events::MouseButtonUp{
+                .mouseButton = static_cast<MouseButton>(event.button.button),
+                .coordinates = IVector2{ event.button.x, event.button.y },
+                .clickCount = static_cast<u32>(event.button.clicks),
+            };
 
-                break;
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseButtonUp(mouseButtonUpEvent);
 
-            case SDL_CONTROLLERBUTTONUP:
-                if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.cbutton.which))
-                {
-                    const auto gameControllerButtonUpEvent = events::GameControllerButtonUp{
-                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.cbutton.which),
-                        .button = static_cast<GameControllerButton>(static_cast<SDL_GameControllerButton>(event.cbutton.button)),
-                    };
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnMouseButtonUp(*this, mouseButtonUpEvent);
+            }
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerButtonUp(gameControllerButtonUpEvent);
+            break;
+        }
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerButtonUp(*this, gameControllerButtonUpEvent);
-                    }
-                }
+        case SDL_MOUSEMOTION:
+        {
+            const auto mouseMotionEvent = events::MouseMotion{
+                .coordinates = IVector2{ event.motion.x, event.motion.y },
+                .relativeCoordinates = IVector2{ event.motion.xrel, event.motion.yrel },
+            };
 
-                break;
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseMotion(mouseMotionEvent);
 
-            case SDL_CONTROLLERAXISMOTION:
-                if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.caxis.which))
-                {
-                    const auto gameControllerAxisMotionEvent = events::GameControllerAxisMotion{
-                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.caxis.which),
-                        .axis = static_cast<GameControllerAxis>(static_cast<SDL_GameControllerAxis>(event.caxis.axis)),
-                        .value = glm::clamp(static_cast<f32>(event.caxis.value) / static_cast<f32>(std::numeric_limits<i16>::max()), -1.0f, 1.0f),
-                    };
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnMouseMotion(*this, mouseMotionEvent);
+            }
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerAxisMotion(gameControllerAxisMotionEvent);
+            break;
+        }
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerAxisMotion(*this, gameControllerAxisMotionEvent);
-                    }
-                }
+        case SDL_MOUSEWHEEL:
+        {
+            m_inputController.GetMouseState().UpdateScrollState(event.wheel.y, event.wheel.preciseY);
 
-                break;
+            const auto mouseScrollEvent = events::MouseScroll{
+                .scrollAmount = event.wheel.y,
+                .preciseScrollAmount = event.wheel.preciseY,
+            };
 
-            case SDL_CONTROLLERTOUCHPADDOWN:
-                if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.ctouchpad.which))
-                {
-                    const auto gameControllerTouchpadFingerDownEvent = events::GameControllerTouchpadFingerDown{
-                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.ctouchpad.which),
-                        .fingerIndex = static_cast<usize>(event.ctouchpad.finger),
-                        .position = Vector2{ event.ctouchpad.x, event.ctouchpad.y },
-                        .pressure = event.ctouchpad.pressure,
-                    };
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMouseScroll(mouseScrollEvent);
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerTouchpadFingerDown(gameControllerTouchpadFingerDownEvent);
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnMouseScroll(*this, mouseScrollEvent);
+            }
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerTouchpadFingerDown(*this, gameControllerTouchpadFingerDownEvent);
-                    }
-                }
+            break;
+        }
 
-                break;
+        case SDL_CONTROLLERDEVICEADDED:
+            if (const ObserverPointer<GameController> gameController = m_inputController.GetGameControllerLobby().AddGameController(event.cdevice.which);
+                gameController != nullptr)
+            {
+                Log::EngineInfo("Game controller \"{}\" added (ID: {}; GUID: {}).", gameController->GetName(), gameController->GetID(), gameController->GetGUID());
 
-            case SDL_CONTROLLERTOUCHPADUP:
-                if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.ctouchpad.which))
-                {
-                    const auto gameControllerTouchpadFingerUpEvent = events::GameControllerTouchpadFingerUp{
-                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.ctouchpad.which),
-                        .fingerIndex = static_cast<usize>(event.ctouchpad.finger),
-                        .position = Vector2{ event.ctouchpad.x, event.ctouchpad.y },
-                    };
+                const auto gameControllerAddedEvent = events::GameControllerAdded{
+                    .gameController = gameController,
+                };
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerTouchpadFingerUp(gameControllerTouchpadFingerUpEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerAdded(gameControllerAddedEvent);
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerTouchpadFingerUp(*this, gameControllerTouchpadFingerUpEvent);
-                    }
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+                {
+                    m_globalEventHandler->OnGameControllerAdded(*this, gameControllerAddedEvent);
                 }
+            }
+            else
+            {
+                message_box::ShowComplex(
+                    m_locale["engine"]["warnings"]["titles"]["game-controller"],
+                    m_locale({ "engine", "warnings", "bodies", "game-controller" }, {
+                        { "GAME_CONTROLLER_ID", std::to_string(event.cdevice.which) },
+                    }),
+                    message_box::Type::Warning,
+                    List<message_box::ButtonData>{
+                        message_box::ButtonData{
+                            .id = 0,
+                            .text = m_locale["engine"]["buttons"]["continue"],
+                            .flags = {
+                                message_box::ButtonFlag::ReturnKeyDefault,
+                                message_box::ButtonFlag::EscapeKeyDefault,
+                            },
+                        },
+                    }
+                );
 
-                break;
+                Log::EngineWarn("Failed to add game controller (ID: {}).", event.cdevice.which);
+            }
 
-            case SDL_CONTROLLERTOUCHPADMOTION:
-                if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.ctouchpad.which))
-                {
-                    const auto gameControllerTouchpadFingerMotionEvent = events::GameControllerTouchpadFingerMotion{
-                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.ctouchpad.which),
-                        .fingerIndex = static_cast<usize>(event.ctouchpad.finger),
-                        .position = Vector2{ event.ctouchpad.x, event.ctouchpad.y },
-                        .pressure = event.ctouchpad.pressure,
-                    };
+            break;
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerTouchpadFingerMotion(gameControllerTouchpadFingerMotionEvent);
+        case SDL_CONTROLLERDEVICEREMOVED:
+            if (const ObserverPointer<const GameController> gameController = m_inputController.GetGameControllerLobby().GetGameController(event.cdevice.which);
+                gameController != nullptr)
+            {
+                Log::EngineInfo("Game controller {} removed.", gameController->GetID());
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnGameControllerTouchpadFingerMotion(*this, gameControllerTouchpadFingerMotionEvent);
-                    }
-                }
+                const auto gameControllerRemovedEvent = events::GameControllerRemoved{
+                    .gameController = gameController,
+                };
 
-                break;
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerRemoved(gameControllerRemovedEvent);
 
-            case SDL_CONTROLLERSENSORUPDATE:
-                if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.csensor.which))
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    switch (event.csensor.sensor)
-                    {
-                    case SDL_SENSOR_ACCEL:
-                    {
-                        const auto gameControllerAccelerometerUpdateEvent = events::GameControllerAccelerometerUpdate{
-                            .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.csensor.which),
-                            .acceleration = Vector3{ event.csensor.data[0], event.csensor.data[1], event.csensor.data[2] },
-                        };
+                    m_globalEventHandler->OnGameControllerRemoved(*this, gameControllerRemovedEvent);
+                }
+            }
 
-                        const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerAccelerometerUpdate(gameControllerAccelerometerUpdateEvent);
+            m_inputController.GetGameControllerLobby().RemoveGameController(event.cdevice.which);
 
-                        if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                        {
-                            m_globalEventHandler->OnGameControllerAccelerometerUpdate(*this, gameControllerAccelerometerUpdateEvent);
-                        }
+            break;
 
-                        break;
-                    }
+        case SDL_CONTROLLERBUTTONDOWN:
+            if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.cbutton.which))
+            {
+                const auto gameControllerButtonDownEvent = events::GameControllerButtonDown{
+                    .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.cbutton.which),
+                    .button = static_cast<GameControllerButton>(static_cast<SDL_GameControllerButton>(event.cbutton.button)),
+                };
 
-                    case SDL_SENSOR_GYRO:
-                    {
-                        const auto gameControllerGyroscopeUpdateEvent = events::GameControllerGyroscopeUpdate{
-                            .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.csensor.which),
-                            .rotation = Vector3{ event.csensor.data[0], event.csensor.data[1], event.csensor.data[2] },
-                        };
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerButtonDown(gameControllerButtonDownEvent);
 
-                        const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerGyroscopeUpdate(gameControllerGyroscopeUpdateEvent);
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+                {
+                    m_globalEventHandler->OnGameControllerButtonDown(*this, gameControllerButtonDownEvent);
+                }
+            }
 
-                        if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                        {
-                            m_globalEventHandler->OnGameControllerGyroscopeUpdate(*this, gameControllerGyroscopeUpdateEvent);
-                        }
+            break;
 
-                        break;
-                    }
-                    }
-                }
+        case SDL_CONTROLLERBUTTONUP:
+            if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.cbutton.which))
+            {
+                const auto gameControllerButtonUpEvent = events::GameControllerButtonUp{
+                    .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.cbutton.which),
+                    .button = static_cast<GameControllerButton>(static_cast<SDL_GameControllerButton>(event.cbutton.button)),
+                };
 
-                break;
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerButtonUp(gameControllerButtonUpEvent);
 
-            case SDL_JOYDEVICEADDED:
-                if (SDL_IsGameController(event.jdevice.which))
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    break;
+                    m_globalEventHandler->OnGameControllerButtonUp(*this, gameControllerButtonUpEvent);
                 }
+            }
 
-                if (const ObserverPointer<Joystick> joystick = m_inputController.GetJoystickLobby().AddJoystick(event.jdevice.which);
-                    joystick != nullptr)
-                {
-                    Log::EngineInfo("Joystick \"{}\" added (ID: {}; GUID: {}).", joystick->GetName(), joystick->GetID(), joystick->GetGUID());
+            break;
 
-                    const auto joystickAddedEvent = events::JoystickAdded{
-                        .joystick = joystick,
-                    };
+        case SDL_CONTROLLERAXISMOTION:
+            if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.caxis.which))
+            {
+                const auto gameControllerAxisMotionEvent = events::GameControllerAxisMotion{
+                    .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.caxis.which),
+                    .axis = static_cast<GameControllerAxis>(static_cast<SDL_GameControllerAxis>(event.caxis.axis)),
+                    .value = glm::clamp(static_cast<f32>(event.caxis.value) / static_cast<f32>(std::numeric_limits<i16>::max()), -1.0f, 1.0f),
+                };
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickAdded(joystickAddedEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerAxisMotion(gameControllerAxisMotionEvent);
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnJoystickAdded(*this, joystickAddedEvent);
-                    }
-                }
-                else
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    message_box::ShowComplex(
-                        m_locale["engine"]["warnings"]["titles"]["joystick"],
-                        m_locale({ "engine", "warnings", "bodies", "joystick" }, {
-                            { "JOYSTICK_ID", std::to_string(event.jdevice.which) },
-                        }),
-                        message_box::Type::Warning,
-                        List<message_box::ButtonData>{
-                            message_box::ButtonData{
-                                .id = 0,
-                                .text = m_locale["engine"]["buttons"]["continue"],
-                                .flags = {
-                                    message_box::ButtonFlag::ReturnKeyDefault,
-                                    message_box::ButtonFlag::EscapeKeyDefault,
-                                },
-                            },
-                        }
-                    );
-
-                    Log::EngineWarn("Failed to add joystick (ID: {}).", event.jdevice.which);
+                    m_globalEventHandler->OnGameControllerAxisMotion(*this, gameControllerAxisMotionEvent);
                 }
+            }
 
-                break;
+            break;
 
-            case SDL_JOYDEVICEREMOVED:
-                if (SDL_IsGameController(event.jdevice.which))
+        case SDL_CONTROLLERTOUCHPADDOWN:
+            if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.ctouchpad.which))
+            {
+                const auto gameControllerTouchpadFingerDownEvent = events::GameControllerTouchpadFingerDown{
+                    .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.ctouchpad.which),
+                    .fingerIndex = static_cast<usize>(event.ctouchpad.finger),
+                    .position = Vector2{ event.ctouchpad.x, event.ctouchpad.y },
+                    .pressure = event.ctouchpad.pressure,
+                };
+
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerTouchpadFingerDown(gameControllerTouchpadFingerDownEvent);
+
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    break;
+                    m_globalEventHandler->OnGameControllerTouchpadFingerDown(*this, gameControllerTouchpadFingerDownEvent);
                 }
+            }
 
-                if (const ObserverPointer<const Joystick> joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jdevice.which);
-                    joystick != nullptr)
-                {
-                    Log::EngineInfo("Joystick {} removed.", joystick->GetID());
+            break;
 
-                    const auto joystickRemovedEvent = events::JoystickRemoved{
-                        .joystick = joystick,
-                    };
+        case SDL_CONTROLLERTOUCHPADUP:
+            if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.ctouchpad.which))
+            {
+                const auto gameControllerTouchpadFingerUpEvent = events::GameControllerTouchpadFingerUp{
+                    .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.ctouchpad.which),
+                    .fingerIndex = static_cast<usize>(event.ctouchpad.finger),
+                    .position = Vector2{ event.ctouchpad.x, event.ctouchpad.y },
+                };
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickRemoved(joystickRemovedEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerTouchpadFingerUp(gameControllerTouchpadFingerUpEvent);
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnJoystickRemoved(*this, joystickRemovedEvent);
-                    }
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+                {
+                    m_globalEventHandler->OnGameControllerTouchpadFingerUp(*this, gameControllerTouchpadFingerUpEvent);
                 }
+            }
 
-                m_inputController.GetJoystickLobby().RemoveJoystick(event.jdevice.which);
-
-                break;
+            break;
 
-            case SDL_JOYBUTTONDOWN:
-                if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jbutton.which))
-                {
-                    const auto joystickButtonDownEvent = events::JoystickButtonDown{
-                        .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jbutton.which),
-                        .button = static_cast<Joystick::ButtonID>(event.jbutton.button),
-                    };
+        case SDL_CONTROLLERTOUCHPADMOTION:
+            if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.ctouchpad.which))
+            {
+                const auto gameControllerTouchpadFingerMotionEvent = events::GameControllerTouchpadFingerMotion{
+                    .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.ctouchpad.which),
+                    .fingerIndex = static_cast<usize>(event.ctouchpad.finger),
+                    .position = Vector2{ event.ctouchpad.x, event.ctouchpad.y },
+                    .pressure = event.ctouchpad.pressure,
+                };
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickButtonDown(joystickButtonDownEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerTouchpadFingerMotion(gameControllerTouchpadFingerMotionEvent);
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnJoystickButtonDown(*this, joystickButtonDownEvent);
-                    }
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+                {
+                    m_globalEventHandler->OnGameControllerTouchpadFingerMotion(*this, gameControllerTouchpadFingerMotionEvent);
                 }
+            }
 
-                break;
+            break;
 
-            case SDL_JOYBUTTONUP:
-                if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jbutton.which))
+        case SDL_CONTROLLERSENSORUPDATE:
+            if (m_inputController.GetGameControllerLobby().DoesGameControllerExist(event.csensor.which))
+            {
+                switch (event.csensor.sensor)
+                {
+                case SDL_SENSOR_ACCEL:
                 {
-                    const auto joystickButtonUpEvent = events::JoystickButtonUp{
-                        .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jbutton.which),
-                        .button = static_cast<Joystick::ButtonID>(event.jbutton.button),
+                    const auto gameControllerAccelerometerUpdateEvent = events::GameControllerAccelerometerUpdate{
+                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.csensor.which),
+                        .acceleration = Vector3{ event.csensor.data[0], event.csensor.data[1], event.csensor.data[2] },
                     };
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickButtonUp(joystickButtonUpEvent);
+                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerAccelerometerUpdate(gameControllerAccelerometerUpdateEvent);
 
                     if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                     {
-                        m_globalEventHandler->OnJoystickButtonUp(*this, joystickButtonUpEvent);
+                        m_globalEventHandler->OnGameControllerAccelerometerUpdate(*this, gameControllerAccelerometerUpdateEvent);
                     }
-                }
 
-                break;
+                    break;
+                }
 
-            case SDL_JOYAXISMOTION:
-                if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jaxis.which))
+                case SDL_SENSOR_GYRO:
                 {
-                    const auto joystickAxisMotionEvent = events::JoystickAxisMotion{
-                        .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jaxis.which),
-                        .axis = static_cast<Joystick::AxisID>(event.jaxis.axis),
-                        .value = glm::clamp(static_cast<f32>(event.jaxis.value) / static_cast<f32>(std::numeric_limits<i16>::max()), -1.0f, 1.0f),
+                    const auto gameControllerGyroscopeUpdateEvent = events::GameControllerGyroscopeUpdate{
+                        .gameController = m_inputController.GetGameControllerLobby().GetGameController(event.csensor.which),
+                        .rotation = Vector3{ event.csensor.data[0], event.csensor.data[1], event.csensor.data[2] },
                     };
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickAxisMotion(joystickAxisMotionEvent);
+                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnGameControllerGyroscopeUpdate(gameControllerGyroscopeUpdateEvent);
 
                     if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                     {
-                        m_globalEventHandler->OnJoystickAxisMotion(*this, joystickAxisMotionEvent);
+                        m_globalEventHandler->OnGameControllerGyroscopeUpdate(*this, gameControllerGyroscopeUpdateEvent);
                     }
+
+                    break;
+                }
                 }
+            }
 
-                break;
+            break;
 
-            case SDL_JOYHATMOTION:
-                if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jhat.which))
-                {
-                    const auto joystickHatSwitchMotionEvent = events::JoystickHatSwitchMotion{
-                        .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jhat.which),
-                        .hatSwitch = static_cast<Joystick::HatSwitchID>(event.jhat.hat),
-                        .direction = static_cast<JoystickHatSwitchDirection>(event.jhat.value),
-                    };
+        case SDL_JOYDEVICEADDED:
+            if (SDL_IsGameController(event.jdevice.which))
+            {
+                break;
+            }
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickHatSwitchMotion(joystickHatSwitchMotionEvent);
+            if (const ObserverPointer<Joystick> joystick = m_inputController.GetJoystickLobby().AddJoystick(event.jdevice.which);
+                joystick != nullptr)
+            {
+                Log::EngineInfo("Joystick \"{}\" added (ID: {}; GUID: {}).", joystick->GetName(), joystick->GetID(), joystick->GetGUID());
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnJoystickHatSwitchMotion(*this, joystickHatSwitchMotionEvent);
-                    }
-                }
+                const auto joystickAddedEvent = events::JoystickAdded{
+                    .joystick = joystick,
+                };
 
-                break;
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickAdded(joystickAddedEvent);
 
-            case SDL_JOYBALLMOTION:
-                if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jball.which))
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    const auto joystickTrackballMotionEvent = events::JoystickTrackballMotion{
-                        .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jball.which),
-                        .trackball = static_cast<Joystick::TrackballID>(event.jball.ball),
-                        .relativeMotion = Vector2{
-                            static_cast<f32>(event.jball.xrel),
-                            static_cast<f32>(event.jball.yrel),
+                    m_globalEventHandler->OnJoystickAdded(*this, joystickAddedEvent);
+                }
+            }
+            else
+            {
+                message_box::ShowComplex(
+                    m_locale["engine"]["warnings"]["titles"]["joystick"],
+                    m_locale({ "engine", "warnings", "bodies", "joystick" }, {
+                        { "JOYSTICK_ID", std::to_string(event.jdevice.which) },
+                    }),
+                    message_box::Type::Warning,
+                    List<message_box::ButtonData>{
+                        message_box::ButtonData{
+                            .id = 0,
+                            .text = m_locale["engine"]["buttons"]["continue"],
+                            .flags = {
+                                message_box::ButtonFlag::ReturnKeyDefault,
+                                message_box::ButtonFlag::EscapeKeyDefault,
+                            },
                         },
-                    };
+                    }
+                );
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickTrackballMotion(joystickTrackballMotionEvent);
+                Log::EngineWarn("Failed to add joystick (ID: {}).", event.jdevice.which);
+            }
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnJoystickTrackballMotion(*this, joystickTrackballMotionEvent);
-                    }
-                }
+            break;
 
+        case SDL_JOYDEVICEREMOVED:
+            if (SDL_IsGameController(event.jdevice.which))
+            {
                 break;
+            }
 
-            case SDL_FINGERDOWN:
+            if (const ObserverPointer<const Joystick> joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jdevice.which);
+                joystick != nullptr)
             {
-                const auto touchFingerDownEvent = events::TouchFingerDown{
-                    .touchDevice = TouchDevice(event.tfinger.touchId),
-                    .fingerID = event.tfinger.fingerId,
-                    .position = Vector2{ event.tfinger.x, event.tfinger.y },
-                    .pressure = event.tfinger.pressure,
-                    .isOnGameWindow = static_cast<Window::ID>(event.tfinger.windowID) == m_window.GetID(),
+                Log::EngineInfo("Joystick {} removed.", joystick->GetID());
+
+                const auto joystickRemovedEvent = events::JoystickRemoved{
+                    .joystick = joystick,
                 };
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTouchFingerDown(touchFingerDownEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickRemoved(joystickRemovedEvent);
 
                 if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    m_globalEventHandler->OnTouchFingerDown(*this, touchFingerDownEvent);
+                    m_globalEventHandler->OnJoystickRemoved(*this, joystickRemovedEvent);
                 }
-
-                break;
             }
 
-            case SDL_FINGERUP:
+            m_inputController.GetJoystickLobby().RemoveJoystick(event.jdevice.which);
+
+            break;
+
+        case SDL_JOYBUTTONDOWN:
+            if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jbutton.which))
             {
-                const auto touchFingerUpEvent = events::TouchFingerUp{
-                    .touchDevice = TouchDevice(event.tfinger.touchId),
-                    .fingerID = event.tfinger.fingerId,
-                    .position = Vector2{ event.tfinger.x, event.tfinger.y },
-                    .isOnGameWindow = static_cast<Window::ID>(event.tfinger.windowID) == m_window.GetID(),
+                const auto joystickButtonDownEvent = events::JoystickButtonDown{
+                    .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jbutton.which),
+                    .button = static_cast<Joystick::ButtonID>(event.jbutton.button),
                 };
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTouchFingerUp(touchFingerUpEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickButtonDown(joystickButtonDownEvent);
 
                 if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    m_globalEventHandler->OnTouchFingerUp(*this, touchFingerUpEvent);
+                    m_globalEventHandler->OnJoystickButtonDown(*this, joystickButtonDownEvent);
                 }
-
-                break;
             }
 
-            case SDL_FINGERMOTION:
+            break;
+
+        case SDL_JOYBUTTONUP:
+            if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jbutton.which))
             {
-                const auto touchFingerMotionEvent = events::TouchFingerMotion{
-                    .touchDevice = TouchDevice(event.tfinger.touchId),
-                    .fingerID = event.tfinger.fingerId,
-                    .position = Vector2{ event.tfinger.x, event.tfinger.y },
-                    .deltaPosition = Vector2{ event.tfinger.dx, event.tfinger.dy },
-                    .pressure = event.tfinger.pressure,
-                    .isOnGameWindow = static_cast<Window::ID>(event.tfinger.windowID) == m_window.GetID(),
+                const auto joystickButtonUpEvent = events::JoystickButtonUp{
+                    .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jbutton.which),
+                    .button = static_cast<Joystick::ButtonID>(event.jbutton.button),
                 };
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTouchFingerMotion(touchFingerMotionEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickButtonUp(joystickButtonUpEvent);
 
                 if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    m_globalEventHandler->OnTouchFingerMotion(*this, touchFingerMotionEvent);
+                    m_globalEventHandler->OnJoystickButtonUp(*this, joystickButtonUpEvent);
                 }
-
-                break;
             }
 
-            case SDL_MULTIGESTURE:
+            break;
+
+        case SDL_JOYAXISMOTION:
+            if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jaxis.which))
             {
-                const auto multiTouchFingerGestureEvent = events::MultiTouchFingerGesture{
-                    .touchDevice = TouchDevice(event.mgesture.touchId),
-                    .fingerCount = static_cast<u32>(event.mgesture.numFingers),
-                    .normalisedCentre = Vector2{ event.mgesture.x, event.mgesture.y },
-                    .pinchAmount = event.mgesture.dDist,
-                    .rotationAmount = event.mgesture.dTheta,
+                const auto joystickAxisMotionEvent = events::JoystickAxisMotion{
+                    .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jaxis.which),
+                    .axis = static_cast<Joystick::AxisID>(event.jaxis.axis),
+                    .value = glm::clamp(static_cast<f32>(event.jaxis.value) / static_cast<f32>(std::numeric_limits<i16>::max()), -1.0f, 1.0f),
                 };
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMultiTouchFingerGesture(multiTouchFingerGestureEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickAxisMotion(joystickAxisMotionEvent);
 
                 if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    m_globalEventHandler->OnMultiTouchFingerGesture(*this, multiTouchFingerGestureEvent);
+                    m_globalEventHandler->OnJoystickAxisMotion(*this, joystickAxisMotionEvent);
                 }
-
-                break;
             }
 
-            case SDL_DOLLARGESTURE:
+            break;
+
+        case SDL_JOYHATMOTION:
+            if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jhat.which))
             {
-                const auto dollarGesturePerformedEvent = events::DollarGesturePerformed{
-                    .touchDevice = TouchDevice(event.dgesture.touchId),
-                    .gestureID = event.dgesture.gestureId,
-                    .fingerCount = static_cast<u32>(event.dgesture.numFingers),
-                    .normalisedCentre = Vector2{ event.dgesture.x, event.dgesture.y },
-                    .errorAmount = event.dgesture.error,
+                const auto joystickHatSwitchMotionEvent = events::JoystickHatSwitchMotion{
+                    .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jhat.which),
+                    .hatSwitch = static_cast<Joystick::HatSwitchID>(event.jhat.hat),
+                    .direction = static_cast<JoystickHatSwitchDirection>(event.jhat.value),
                 };
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnDollarGesturePerformed(dollarGesturePerformedEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickHatSwitchMotion(joystickHatSwitchMotionEvent);
 
                 if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    m_globalEventHandler->OnDollarGesturePerformed(*this, dollarGesturePerformedEvent);
+                    m_globalEventHandler->OnJoystickHatSwitchMotion(*this, joystickHatSwitchMotionEvent);
                 }
-
-                break;
             }
 
-            case SDL_DOLLARRECORD:
+            break;
+
+        case SDL_JOYBALLMOTION:
+            if (m_inputController.GetJoystickLobby().DoesJoystickExist(event.jball.which))
             {
-                const auto dollarGestureRecordedEvent = events::DollarGestureRecorded{
-                    .touchDevice = TouchDevice(event.dgesture.touchId),
-                    .gestureID = event.dgesture.gestureId,
+                const auto joystickTrackballMotionEvent = events::JoystickTrackballMotion{
+                    .joystick = m_inputController.GetJoystickLobby().GetJoystick(event.jball.which),
+                    .trackball = static_cast<Joystick::TrackballID>(event.jball.ball),
+                    .relativeMotion = Vector2{
+                        static_cast<f32>(event.jball.xrel),
+                        static_cast<f32>(event.jball.yrel),
+                    },
                 };
 
-                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnDollarGestureRecorded(dollarGestureRecordedEvent);
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnJoystickTrackballMotion(joystickTrackballMotionEvent);
 
                 if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
                 {
-                    m_globalEventHandler->OnDollarGestureRecorded(*this, dollarGestureRecordedEvent);
+                    m_globalEventHandler->OnJoystickTrackballMotion(*this, joystickTrackballMotionEvent);
                 }
+            }
 
-                break;
+            break;
+
+        case SDL_FINGERDOWN:
+        {
+            const auto touchFingerDownEvent = events::TouchFingerDown{
+                .touchDevice = TouchDevice(event.tfinger.touchId),
+                .fingerID = event.tfinger.fingerId,
+                .position = Vector2{ event.tfinger.x, event.tfinger.y },
+                .pressure = event.tfinger.pressure,
+                .isOnGameWindow = static_cast<Window::ID>(event.tfinger.windowID) == m_window.GetID(),
+            };
+
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTouchFingerDown(touchFingerDownEvent);
+
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnTouchFingerDown(*this, touchFingerDownEvent);
             }
 
-            case SDL_WINDOWEVENT:
-                ProcessWindowEvent(event.window);
+            break;
+        }
 
-                break;
+        case SDL_FINGERUP:
+        {
+            const auto touchFingerUpEvent = events::TouchFingerUp{
+                .touchDevice = TouchDevice(event.tfinger.touchId),
+                .fingerID = event.tfinger.fingerId,
+                .position = Vector2{ event.tfinger.x, event.tfinger.y },
+                .isOnGameWindow = static_cast<Window::ID>(event.tfinger.windowID) == m_window.GetID(),
+            };
 
-            case SDL_USEREVENT:
-                switch (event.user.code)
-                {
-                case Locale::ChangeEventCode:
-                {
-                    const String newLocale = static_cast<const char*>(event.user.data1);
-                    Log::EngineInfo("Locale changed to {}.", newLocale);
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTouchFingerUp(touchFingerUpEvent);
 
-                    const auto localeChangedEvent = events::LocaleChanged{
-                        .newLocaleName = newLocale,
-                    };
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnTouchFingerUp(*this, touchFingerUpEvent);
+            }
 
-                    const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnLocaleChanged(localeChangedEvent);
+            break;
+        }
 
-                    if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
-                    {
-                        m_globalEventHandler->OnLocaleChanged(*this, localeChangedEvent);
-                    }
+        case SDL_FINGERMOTION:
+        {
+            const auto touchFingerMotionEvent = events::TouchFingerMotion{
+                .touchDevice = TouchDevice(event.tfinger.touchId),
+                .fingerID = event.tfinger.fingerId,
+                .position = Vector2{ event.tfinger.x, event.tfinger.y },
+                .deltaPosition = Vector2{ event.tfinger.dx, event.tfinger.dy },
+                .pressure = event.tfinger.pressure,
+                .isOnGameWindow = static_cast<Window::ID>(event.tfinger.windowID) == m_window.GetID(),
+            };
 
-                    break;
-                }
-                }
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnTouchFingerMotion(touchFingerMotionEvent);
 
-                break;
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnTouchFingerMotion(*this, touchFingerMotionEvent);
             }
+
+            break;
         }
 
-        while (!m_userEvents.empty())
+        case SDL_MULTIGESTURE:
         {
-            const events::UserEvent& userEvent = m_userEvents.front();
-            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnUserEvent(userEvent);
+            const auto multiTouchFingerGestureEvent = events::MultiTouchFingerGesture{
+                .touchDevice = TouchDevice(event.mgesture.touchId),
+                .fingerCount = static_cast<u32>(event.mgesture.numFingers),
+                .normalisedCentre = Vector2{ event.mgesture.x, event.mgesture.y },
+                .pinchAmount = event.mgesture.dDist,
+                .rotationAmount = event.mgesture.dTheta,
+            };
+
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnMultiTouchFingerGesture(multiTouchFingerGestureEvent);
 
             if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
             {
-                m_globalEventHandler->OnUserEvent(*this, userEvent);
+                m_globalEventHandler->OnMultiTouchFingerGesture(*this, multiTouchFingerGestureEvent);
             }
 
-            m_userEvents.pop();
+            break;
+        }
+
+        case SDL_DOLLARGESTURE:
+        {
+            const auto dollarGesturePerformedEvent = events::DollarGesturePerformed{
+                .touchDevice = TouchDevice(event.dgesture.touchId),
+                .gestureID = event.dgesture.gestureId,
+                .fingerCount = static_cast<u32>(event.dgesture.numFingers),
+                .normalisedCentre = Vector2{ event.dgesture.x, event.dgesture.y },
+                .errorAmount = event.dgesture.error,
+            };
+
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnDollarGesturePerformed(dollarGesturePerformedEvent);
+
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnDollarGesturePerformed(*this, dollarGesturePerformedEvent);
+            }
+
+            break;
+        }
+
+        case SDL_DOLLARRECORD:
+        {
+            const auto dollarGestureRecordedEvent = events::DollarGestureRecorded{
+                .touchDevice = TouchDevice(event.dgesture.touchId),
+                .gestureID = event.dgesture.gestureId,
+            };
+
+            const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnDollarGestureRecorded(dollarGestureRecordedEvent);
+
+            if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+            {
+                m_globalEventHandler->OnDollarGestureRecorded(*this, dollarGestureRecordedEvent);
+            }
+
+            break;
+        }
+
+        case SDL_WINDOWEVENT:
+            ProcessWindowEvent(event.window);
+
+            break;
+
+        case SDL_USEREVENT:
+            switch (event.user.code)
+            {
+            case Locale::ChangeEventCode:
+            {
+                const String newLocale = static_cast<const char*>(event.user.data1);
+                Log::EngineInfo("Locale changed to {}.", newLocale);
+
+                const auto localeChangedEvent = events::LocaleChanged{
+                    .newLocaleName = newLocale,
+                };
+
+                const EventStatus eventStatus = m_sceneManager.CurrentScene()->OnLocaleChanged(localeChangedEvent);
+
+                if (eventStatus == EventStatus::NotHandled && m_globalEventHandler != nullptr)
+                {
+                    m_globalEventHandler->OnLocaleChanged(*this, localeChangedEvent);
+                }
+
+                break;
+            }
+            }
+
+            break;
         }
     }
 
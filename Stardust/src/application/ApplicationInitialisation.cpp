@@ -63,6 +63,7 @@ namespace stardust
             &Application::InitialiseGraphics,
             &Application::InitialiseRenderer,
             &Application::InitialiseAudio,
+            &Application::InitialiseAssetLoader,
             &Application::InitialiseScriptEngine,
             &Application::InitialisePhysics,
             &Application::InitialiseInput,
@@ -342,7 +343,7 @@ namespace stardust
 
         List<Window::CreateFlag> windowCreateFlags{
             Window::CreateFlag::OpenGL,
-            Window::CreateFlag::Shown,
+            createInfo.inputRecordingInfo.replayFilepath.empty() ? Window::CreateFlag::Shown : Window::CreateFlag::Hidden,
         };
 
         if (createInfo.windowInfo.isResizable)
@@ -527,9 +528,42 @@ namespace stardust
         return Status::Success;
     }
 
-    [[nodiscard]] auto Application::InitialiseScriptEngine(const CreateInfo&) -> Status
+    [[nodiscard]] auto Application::InitialiseAssetLoader(const CreateInfo& createInfo) -> Status
+    {
+        const u32 loaderThreadCount = createInfo.assetInfo.loaderThreadCount != 0u
+            ? createInfo.assetInfo.loaderThreadCount
+            : AssetLoader::GetDefaultWorkerCount();
+
+        m_assetLoader.Initialise(loaderThreadCount);
+
+        if (createInfo.assetInfo.uploadBudgetPerFrame > 0.0f)
+        {
+            m_assetLoader.SetUploadBudgetPerFrame(createInfo.assetInfo.uploadBudgetPerFrame);
+        }
+
+        Log::EngineInfo("Asset loader initialised with {} worker threads.", m_assetLoader.GetWorkerCount());
+
+        return Status::Success;
+    }
+
+    [[nodiscard]] auto Application::InitialiseScriptEngine(const CreateInfo& createInfo) -> Status
     {
         m_scriptEngine.Initialise(*this);
+        m_scriptEngine.SetGarbageCollectionMode(createInfo.scriptInfo.garbageCollectionMode);
+        m_scriptTargetFrameTime = createInfo.scriptInfo.targetFrameTime;
+        m_scriptEngine.SetPrecompiledScriptLoadingEnabled(createInfo.scriptInfo.isPrecompiledScriptLoadingEnabled);
+
+        if (!createInfo.scriptInfo.bytecodeCacheRelativeDirectory.empty())
+        {
+            m_scriptEngine.SetBytecodeCacheDirectory(filesystem::GetApplicationPreferenceDirectory() + createInfo.scriptInfo.bytecodeCacheRelativeDirectory);
+        }
+
+        if (createInfo.scriptInfo.workerStateCount != 0u)
+        {
+            m_scriptStatePool.Initialise(*this, createInfo.scriptInfo.workerStateCount);
+            Log::EngineInfo("Script state pool initialised with {} Lua states.", m_scriptStatePool.GetStateCount());
+        }
+
         Log::EngineInfo("Lua script engine initialised.");
 
         return Status::Success;
@@ -633,6 +667,37 @@ namespace stardust
             Log::EngineWarn("Failed to save control preferences.");
         }
 
+        m_inputRecordingFilepath = createInfo.inputRecordingInfo.recordingFilepath;
+        m_frameTimesFilepath = createInfo.inputRecordingInfo.frameTimesFilepath;
+
+        if (!createInfo.inputRecordingInfo.replayFilepath.empty())
+        {
+            InputRecording inputRecording{ };
+
+            if (inputRecording.Load(createInfo.inputRecordingInfo.replayFilepath) != Status::Success)
+            {
+                Log::EngineCritical("Failed to load input recording at {}.", createInfo.inputRecordingInfo.replayFilepath);
+
+                return Status::Fail;
+            }
+
+            const usize replayFrameCount = inputRecording.GetFrameCount();
+
+            if (m_inputController.StartReplay(std::move(inputRecording)) != Status::Success)
+            {
+                Log::EngineCritical("Failed to attach virtual game controllers for input replay: {}.", SDL_GetError());
+
+                return Status::Fail;
+            }
+
+            Log::EngineInfo("Replaying {} input frames with their recorded frame times.", replayFrameCount);
+        }
+        else if (!m_inputRecordingFilepath.empty())
+        {
+            m_inputController.StartRecording();
+            Log::EngineInfo("Recording input to {}.", m_inputRecordingFilepath);
+        }
+
         Log::EngineInfo("Input subsystem initialised.");
 
         return Status::Success;
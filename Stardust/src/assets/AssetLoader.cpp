@@ -0,0 +1,279 @@
+#include "stardust/assets/AssetLoader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <utility>
+
+#include "stardust/debug/logging/Logging.h"
+
+namespace stardust
+{
+    AssetRequest::AssetRequest(const String& name, const SharedPointer<std::atomic<AssetLoadState>>& state)
+        : m_name(name), m_state(state)
+    { }
+
+    [[nodiscard]] auto AssetRequest::GetState() const noexcept -> AssetLoadState
+    {
+        return m_state != nullptr
+            ? m_state->load(std::memory_order::acquire)
+            : AssetLoadState::Failed;
+    }
+
+    [[nodiscard]] auto AssetLoader::GetDefaultWorkerCount() noexcept -> u32
+    {
+        const u32 hardwareThreadCount = static_cast<u32>(std::thread::hardware_concurrency());
+
+        return std::max(hardwareThreadCount, 2u) - 1u;
+    }
+
+    AssetLoader::AssetLoader(const u32 workerCount)
+    {
+        Initialise(workerCount);
+    }
+
+    AssetLoader::~AssetLoader() noexcept
+    {
+        Shutdown();
+    }
+
+    auto AssetLoader::Initialise(const u32 workerCount) -> void
+    {
+        Shutdown();
+
+        m_workerThreads.reserve(workerCount);
+
+        for (u32 i = 0u; i < workerCount; ++i)
+        {
+            m_workerThreads.emplace_back([this](const std::stop_token stopToken) { RunWorkerThread(stopToken); });
+        }
+    }
+
+    auto AssetLoader::Shutdown() -> void
+    {
+        for (auto& workerThread : m_workerThreads)
+        {
+            workerThread.request_stop();
+        }
+
+        m_backgroundTaskCondition.notify_all();
+        m_workerThreads.clear();
+
+        Queue<QueuedTask> cancelledBackgroundTasks{ };
+        Queue<QueuedTask> cancelledMainThreadTasks{ };
+
+        {
+            const std::scoped_lock<std::mutex> lock(m_backgroundTaskMutex);
+            std::swap(cancelledBackgroundTasks, m_backgroundTasks);
+        }
+
+        {
+            const std::scoped_lock<std::mutex> lock(m_mainThreadTaskMutex);
+            std::swap(cancelledMainThreadTasks, m_mainThreadTasks);
+        }
+
+        CancelTasks(cancelledBackgroundTasks);
+        CancelTasks(cancelledMainThreadTasks);
+
+        {
+            const std::scoped_lock<std::mutex> lock(m_mainThreadTaskMutex);
+
+            m_requestedAssetCount.store(0u, std::memory_order::release);
+            m_finishedAssetCount.store(0u, std::memory_order::release);
+        }
+
+        m_mainThreadTaskCondition.notify_all();
+    }
+
+    auto AssetLoader::SubmitBackgroundTask(Task&& task, Task&& onCancel) -> void
+    {
+        if (m_workerThreads.empty())
+        {
+            QueuedTask queuedTask{
+                .task = std::move(task),
+                .onCancel = std::move(onCancel),
+            };
+
+            RunTask(queuedTask);
+
+            return;
+        }
+
+        {
+            const std::scoped_lock<std::mutex> lock(m_backgroundTaskMutex);
+            m_backgroundTasks.push(QueuedTask{
+                .task = std::move(task),
+                .onCancel = std::move(onCancel),
+            });
+        }
+
+        m_backgroundTaskCondition.notify_one();
+    }
+
+    auto AssetLoader::SubmitMainThreadTask(Task&& task, Task&& onCancel) -> void
+    {
+        {
+            const std::scoped_lock<std::mutex> lock(m_mainThreadTaskMutex);
+
+            m_mainThreadTasks.push(QueuedTask{
+                .task = std::move(task),
+                .onCancel = std::move(onCancel),
+            });
+        }
+
+        m_mainThreadTaskCondition.notify_all();
+    }
+
+    auto AssetLoader::Update() -> u32
+    {
+        return Update(m_uploadBudgetPerFrame);
+    }
+
+    auto AssetLoader::Update(const f32 uploadBudget) -> u32
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const Clock::time_point startTime = Clock::now();
+        const auto budgetDuration = std::chrono::duration<f32>(uploadBudget);
+
+        u32 processedTaskCount = 0u;
+
+        while (true)
+        {
+            QueuedTask queuedTask;
+
+            {
+                const std::scoped_lock<std::mutex> lock(m_mainThreadTaskMutex);
+
+                if (m_mainThreadTasks.empty())
+                {
+                    break;
+                }
+
+                queuedTask = std::move(m_mainThreadTasks.front());
+                m_mainThreadTasks.pop();
+            }
+
+            RunTask(queuedTask);
+            ++processedTaskCount;
+
+            if (Clock::now() - startTime >= budgetDuration)
+            {
+                break;
+            }
+        }
+
+        return processedTaskCount;
+    }
+
+    auto AssetLoader::Flush() -> void
+    {
+        while (true)
+        {
+            Update(std::numeric_limits<f32>::max());
+
+            std::unique_lock<std::mutex> lock(m_mainThreadTaskMutex);
+            m_mainThreadTaskCondition.wait(lock, [this] { return IsIdle() || !m_mainThreadTasks.empty(); });
+
+            if (m_mainThreadTasks.empty())
+            {
+                return;
+            }
+        }
+    }
+
+    auto AssetLoader::BeginRequest() noexcept -> void
+    {
+        m_requestedAssetCount.fetch_add(1u, std::memory_order::acq_rel);
+    }
+
+    auto AssetLoader::FinishRequest() -> void
+    {
+        {
+            const std::scoped_lock<std::mutex> lock(m_mainThreadTaskMutex);
+            m_finishedAssetCount.fetch_add(1u, std::memory_order::acq_rel);
+        }
+
+        m_mainThreadTaskCondition.notify_all();
+    }
+
+    [[nodiscard]] auto AssetLoader::GetProgress() const noexcept -> f32
+    {
+        const u32 requestedAssetCount = GetRequestedAssetCount();
+
+        if (requestedAssetCount == 0u)
+        {
+            return 1.0f;
+        }
+
+        return static_cast<f32>(GetFinishedAssetCount()) / static_cast<f32>(requestedAssetCount);
+    }
+
+    auto AssetLoader::ResetProgress() noexcept -> void
+    {
+        if (IsIdle())
+        {
+            m_requestedAssetCount.store(0u, std::memory_order::release);
+            m_finishedAssetCount.store(0u, std::memory_order::release);
+        }
+    }
+
+    auto AssetLoader::RunWorkerThread(const std::stop_token stopToken) -> void
+    {
+        while (!stopToken.stop_requested())
+        {
+            QueuedTask queuedTask;
+
+            {
+                std::unique_lock<std::mutex> lock(m_backgroundTaskMutex);
+
+                if (!m_backgroundTaskCondition.wait(lock, stopToken, [this] { return !m_backgroundTasks.empty(); }))
+                {
+                    return;
+                }
+
+                queuedTask = std::move(m_backgroundTasks.front());
+                m_backgroundTasks.pop();
+            }
+
+            RunTask(queuedTask);
+        }
+    }
+
+    auto AssetLoader::RunTask(QueuedTask& queuedTask) -> void
+    {
+        try
+        {
+            queuedTask.task();
+
+            return;
+        }
+        catch (const std::exception& error)
+        {
+            Log::EngineError("Asset loading task failed: {}", error.what());
+        }
+        catch (...)
+        {
+            Log::EngineError("Asset loading task failed with an unknown error.");
+        }
+
+        if (queuedTask.onCancel != nullptr)
+        {
+            queuedTask.onCancel();
+        }
+    }
+
+    auto AssetLoader::CancelTasks(Queue<QueuedTask>& tasks) -> void
+    {
+        while (!tasks.empty())
+        {
+            if (tasks.front().onCancel != nullptr)
+            {
+                tasks.front().onCancel();
+            }
+
+            tasks.pop();
+        }
+    }
+}
@@ -1,5 +1,7 @@
 #include "stardust/audio/SoundCuePlayer.h"
 
+#include <algorithm>
+#include <functional>
 #include <variant>
 
 #include "stardust/math/random/Random.h"
@@ -9,6 +11,11 @@ namespace stardust
 {
     namespace audio
     {
+        [[nodiscard]] auto SoundCuePlayer::GetCueVoiceGroup(const String& cueName) -> VoiceGroup
+        {
+            return std::max<VoiceGroup>(static_cast<VoiceGroup>(std::hash<String>{ }(cueName)), 1u);
+        }
+
         auto SoundCuePlayer::Initialise(SoundSystem& soundSystem, const VolumeManager& volumeManager) -> void
         {
             m_soundSystem = &soundSystem;
@@ -19,25 +26,32 @@ namespace stardust
         {
             const auto& soundVariant = GetRandomSoundFromCue(cueName);
 
+            SoundPlayData cueSoundPlayData = soundPlayData;
+
+            if (cueSoundPlayData.voiceGroup == NoVoiceGroup)
+            {
+                cueSoundPlayData.voiceGroup = GetCueVoiceGroup(cueName);
+            }
+
             return std::visit(
                 utility::VariantOverloader{
-                    [this, soundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> SoundSource
+                    [this, cueSoundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> SoundSource
                     {
                         if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlaySound(*sound, soundPlayData);
+                            return mixingBus->PlaySound(*sound, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlaySound(*sound, soundPlayData);
+                        return m_soundSystem->PlaySound(*sound, cueSoundPlayData);
                     },
-                    [this, soundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> SoundSource
+                    [this, cueSoundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> SoundSource
                     {
                         if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlaySound(*soundStream, soundPlayData);
+                            return mixingBus->PlaySound(*soundStream, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlaySound(*soundStream, soundPlayData);
+                        return m_soundSystem->PlaySound(*soundStream, cueSoundPlayData);
                     },
                 },
                 soundVariant
@@ -48,25 +62,32 @@ namespace stardust
         {
             const auto& soundVariant = GetRandomSoundFromCue(cueName);
 
+            SoundPlayData cueSoundPlayData = soundPlayData;
+
+            if (cueSoundPlayData.voiceGroup == NoVoiceGroup)
+            {
+                cueSoundPlayData.voiceGroup = GetCueVoiceGroup(cueName);
+            }
+
             return std::visit(
                 utility::VariantOverloader{
-                    [this, fixedTimestep, soundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> SoundSource
+                    [this, fixedTimestep, cueSoundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> SoundSource
                     {
                         if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlaySoundClocked(*sound, fixedTimestep, soundPlayData);
+                            return mixingBus->PlaySoundClocked(*sound, fixedTimestep, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlaySoundClocked(*sound, fixedTimestep, soundPlayData);
+                        return m_soundSystem->PlaySoundClocked(*sound, fixedTimestep, cueSoundPlayData);
                     },
-                    [this, fixedTimestep, soundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> SoundSource
+                    [this, fixedTimestep, cueSoundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> SoundSource
                     {
                         if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlaySoundClocked(*soundStream, fixedTimestep, soundPlayData);
+                            return mixingBus->PlaySoundClocked(*soundStream, fixedTimestep, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlaySoundClocked(*soundStream, fixedTimestep, soundPlayData);
+                        return m_soundSystem->PlaySoundClocked(*soundStream, fixedTimestep, cueSoundPlayData);
                     },
                 },
                 soundVariant
@@ -77,25 +98,32 @@ namespace stardust
         {
             const auto& soundVariant = GetRandomSoundFromCue(cueName);
 
+            PositionalSoundPlayData cueSoundPlayData = soundPlayData;
+
+            if (cueSoundPlayData.voiceGroup == NoVoiceGroup)
+            {
+                cueSoundPlayData.voiceGroup = GetCueVoiceGroup(cueName);
+            }
+
             return std::visit(
                 utility::VariantOverloader{
-                    [this, soundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> PositionalSoundSource
+                    [this, cueSoundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> PositionalSoundSource
                     {
                     if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlayPositionalSound(*sound, soundPlayData);
+                            return mixingBus->PlayPositionalSound(*sound, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlayPositionalSound(*sound, soundPlayData);
+                        return m_soundSystem->PlayPositionalSound(*sound, cueSoundPlayData);
                     },
-                    [this, soundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> PositionalSoundSource
+                    [this, cueSoundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> PositionalSoundSource
                     {
                         if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlayPositionalSound(*soundStream, soundPlayData);
+                            return mixingBus->PlayPositionalSound(*soundStream, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlayPositionalSound(*soundStream, soundPlayData);
+                        return m_soundSystem->PlayPositionalSound(*soundStream, cueSoundPlayData);
                     },
                 },
                 soundVariant
@@ -106,25 +134,32 @@ namespace stardust
         {
             const auto& soundVariant = GetRandomSoundFromCue(cueName);
 
+            PositionalSoundPlayData cueSoundPlayData = soundPlayData;
+
+            if (cueSoundPlayData.voiceGroup == NoVoiceGroup)
+            {
+                cueSoundPlayData.voiceGroup = GetCueVoiceGroup(cueName);
+            }
+
             return std::visit(
                 utility::VariantOverloader{
-                    [this, fixedTimestep, soundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> PositionalSoundSource
+                    [this, fixedTimestep, cueSoundPlayData, mixingBus](const ObserverPointer<Sound> sound) -> PositionalSoundSource
                     {
                         if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlayPositionalSoundClocked(*sound, fixedTimestep, soundPlayData);
+                            return mixingBus->PlayPositionalSoundClocked(*sound, fixedTimestep, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlayPositionalSoundClocked(*sound, fixedTimestep, soundPlayData);
+                        return m_soundSystem->PlayPositionalSoundClocked(*sound, fixedTimestep, cueSoundPlayData);
                     },
-                    [this, fixedTimestep, soundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> PositionalSoundSource
+                    [this, fixedTimestep, cueSoundPlayData, mixingBus](const ObserverPointer<SoundStream> soundStream) -> PositionalSoundSource
                     {
                         if (mixingBus != nullptr)
                         {
-                            return mixingBus->PlayPositionalSoundClocked(*soundStream, fixedTimestep, soundPlayData);
+                            return mixingBus->PlayPositionalSoundClocked(*soundStream, fixedTimestep, cueSoundPlayData);
                         }
 
-                        return m_soundSystem->PlayPositionalSoundClocked(*soundStream, fixedTimestep, soundPlayData);
+                        return m_soundSystem->PlayPositionalSoundClocked(*soundStream, fixedTimestep, cueSoundPlayData);
                     },
                 },
                 soundVariant
@@ -179,6 +214,16 @@ namespace stardust
             m_soundCues[cueName].push_back(&soundStream);
         }
 
+        [[nodiscard]] auto SoundCuePlayer::GetCueVoiceLimit(const String& cueName) const -> u32
+        {
+            return m_soundSystem->GetVoiceManager().GetVoiceGroupLimit(GetCueVoiceGroup(cueName));
+        }
+
+        auto SoundCuePlayer::SetCueVoiceLimit(const String& cueName, const u32 voiceLimit) -> void
+        {
+            m_soundSystem->GetVoiceManager().SetVoiceGroupLimit(GetCueVoiceGroup(cueName), voiceLimit);
+        }
+
         auto SoundCuePlayer::GetRandomSoundFromCue(const String& cueName) const -> const Variant<ObserverPointer<Sound>, ObserverPointer<SoundStream>>&
         {
             const auto& sounds = m_soundCues.at(cueName);
@@ -3,6 +3,9 @@
 #include <memory>
 #include <utility>
 
+#include "stardust/ecs/components/PositionalSoundComponent.h"
+#include "stardust/ecs/components/TransformComponent.h"
+
 namespace stardust
 {
     namespace audio
@@ -13,6 +16,7 @@ namespace stardust
 
             std::swap(m_soLoudHandle, other.m_soLoudHandle);
             m_listener = std::move(other.m_listener);
+            m_voiceManager = std::move(other.m_voiceManager);
 
             std::swap(m_didInitialiseSuccessfully, other.m_didInitialiseSuccessfully);
             std::swap(m_errorString, other.m_errorString);
@@ -24,6 +28,7 @@ namespace stardust
 
             std::swap(m_soLoudHandle, other.m_soLoudHandle);
             m_listener = std::move(other.m_listener);
+            m_voiceManager = std::move(other.m_voiceManager);
 
             std::swap(m_didInitialiseSuccessfully, other.m_didInitialiseSuccessfully);
             std::swap(m_errorString, other.m_errorString);
@@ -58,116 +63,159 @@ namespace stardust
                 m_soLoudHandle->deinit();
                 m_soLoudHandle = nullptr;
 
+                m_voiceManager.Clear();
+
                 m_didInitialiseSuccessfully = false;
             }
         }
 
-        auto SoundSystem::Update() const -> void
+        auto SoundSystem::Update() -> void
         {
             m_soLoudHandle->update3dAudio();
+            m_voiceManager.Update(*m_soLoudHandle);
+        }
+
+        auto SoundSystem::UpdatePositionalSounds(EntityRegistry& entityRegistry, const f32 deltaTime) -> void
+        {
+            for (auto&& [entity, positionalSound, transform] : entityRegistry.IterateEntities<components::PositionalSound, const components::Transform>())
+            {
+                if (!positionalSound.followsTransform || !positionalSound.source.IsValid())
+                {
+                    continue;
+                }
+
+                PositionalSoundSource& source = positionalSound.source;
+                const Vector2 displacement = transform.translation - source.GetPosition();
+
+                if (displacement == Vector2Zero && source.GetVelocity() == Vector2Zero)
+                {
+                    continue;
+                }
+
+                const Vector2 velocity = deltaTime > 0.0f
+                    ? displacement / deltaTime
+                    : Vector2Zero;
+
+                source.SetPositionAndVelocity(transform.translation, velocity);
+            }
         }
 
         auto SoundSystem::PlaySound(Sound& sound, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->play(sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan, soundPlayData.startPaused);
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->play(sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan, soundPlayData.startPaused);
+            });
 
             return SoundSource(voiceHandle, *this);
         }
 
         auto SoundSystem::PlaySound(SoundStream& soundStream, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->play(soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->play(soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
+            });
 
             return SoundSource(voiceHandle, *this);
         }
 
         auto SoundSystem::PlaySoundClocked(Sound& sound, const f64 fixedTimestep, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->playClocked(fixedTimestep, sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->playClocked(fixedTimestep, sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
+            });
 
             return SoundSource(voiceHandle, *this);
         }
 
         auto SoundSystem::PlaySoundClocked(SoundStream& soundStream, const f64 fixedTimestep, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->playClocked(fixedTimestep, soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->playClocked(fixedTimestep, soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
+            });
 
             return SoundSource(voiceHandle, *this);
         }
 
         auto SoundSystem::PlayPositionalSound(Sound& sound, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->play3d(
-                sound.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume,
-                soundPlayData.startPaused
-            );
-
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->play3d(
+                    sound.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume,
+                    soundPlayData.startPaused
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *this, nullptr, soundPlayData.position, soundPlayData.velocity);
         }
 
         auto SoundSystem::PlayPositionalSound(SoundStream& soundStream, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->play3d(
-                soundStream.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume,
-                soundPlayData.startPaused
-            );
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->play3d(
+                    soundStream.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume,
+                    soundPlayData.startPaused
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *this, nullptr, soundPlayData.position, soundPlayData.velocity);
         }
 
         auto SoundSystem::PlayPositionalSoundClocked(Sound& sound, const f64 fixedTimestep, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->play3dClocked(
-                fixedTimestep,
-                sound.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume
-            );
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->play3dClocked(
+                    fixedTimestep,
+                    sound.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *this, nullptr, soundPlayData.position, soundPlayData.velocity);
         }
 
         auto SoundSystem::PlayPositionalSoundClocked(SoundStream& soundStream, const f64 fixedTimestep, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_soLoudHandle->play3dClocked(
-                fixedTimestep,
-                soundStream.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume
-            );
-            SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = PlayVoice(soundPlayData, nullptr, [&]
+            {
+                return m_soLoudHandle->play3dClocked(
+                    fixedTimestep,
+                    soundStream.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *this, nullptr, soundPlayData.position, soundPlayData.velocity);
         }
@@ -242,6 +290,42 @@ namespace stardust
         m_soLoudHandle->set3dSoundSpeed(speedOfSound);
         }
 
+        [[nodiscard]] auto SoundSystem::RequestVoice(const SoundPlayData& soundPlayData, const ObserverPointer<const MixingBus> mixingBus) -> Optional<VoiceRequest>
+        {
+            const VoiceRequest voiceRequest{
+                .mixingBus = mixingBus,
+                .voiceGroup = soundPlayData.voiceGroup,
+                .priority = soundPlayData.priority,
+                .audibility = VoiceManager::EstimateAudibility(soundPlayData),
+                .isProtected = soundPlayData.protect,
+            };
+
+            if (!m_voiceManager.RequestVoice(*m_soLoudHandle, voiceRequest))
+            {
+                return None;
+            }
+
+            return voiceRequest;
+        }
+
+        [[nodiscard]] auto SoundSystem::RequestVoice(const PositionalSoundPlayData& soundPlayData, const ObserverPointer<const MixingBus> mixingBus) -> Optional<VoiceRequest>
+        {
+            const VoiceRequest voiceRequest{
+                .mixingBus = mixingBus,
+                .voiceGroup = soundPlayData.voiceGroup,
+                .priority = soundPlayData.priority,
+                .audibility = VoiceManager::EstimateAudibility(soundPlayData, m_listener.GetPosition()),
+                .isProtected = soundPlayData.protect,
+            };
+
+            if (!m_voiceManager.RequestVoice(*m_soLoudHandle, voiceRequest))
+            {
+                return None;
+            }
+
+            return voiceRequest;
+        }
+
         auto SoundSystem::SetVoiceHandleParameters(const VoiceHandle voiceHandle, const SoundPlayData& soundPlayData) const -> void
         {
             if (soundPlayData.protect)
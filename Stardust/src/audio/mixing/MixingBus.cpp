@@ -98,105 +98,120 @@ namespace stardust
 
         auto MixingBus::PlaySound(Sound& sound, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.play(sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan, soundPlayData.startPaused);
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.play(sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan, soundPlayData.startPaused);
+            });
 
             return SoundSource(voiceHandle, *m_soundSystem, this);
         }
 
         auto MixingBus::PlaySound(SoundStream& soundStream, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.play(soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.play(soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
+            });
 
             return SoundSource(voiceHandle, *m_soundSystem, this);
         }
 
         auto MixingBus::PlaySoundClocked(Sound& sound, const f64 fixedTimestep, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.playClocked(fixedTimestep, sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.playClocked(fixedTimestep, sound.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
+            });
 
             return SoundSource(voiceHandle, *m_soundSystem, this);
         }
 
         auto MixingBus::PlaySoundClocked(SoundStream& soundStream, const f64 fixedTimestep, const SoundPlayData& soundPlayData) -> SoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.playClocked(fixedTimestep, soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.playClocked(fixedTimestep, soundStream.GetRawHandle(), soundPlayData.volume, soundPlayData.pan);
+            });
 
             return SoundSource(voiceHandle, *m_soundSystem, this);
         }
 
         auto MixingBus::PlayPositionalSound(Sound& sound, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.play3d(
-                sound.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume,
-                soundPlayData.startPaused
-            );
-
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.play3d(
+                    sound.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume,
+                    soundPlayData.startPaused
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *m_soundSystem, this, soundPlayData.position, soundPlayData.velocity);
         }
 
         auto MixingBus::PlayPositionalSound(SoundStream& soundStream, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.play3d(
-                soundStream.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume,
-                soundPlayData.startPaused
-            );
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.play3d(
+                    soundStream.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume,
+                    soundPlayData.startPaused
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *m_soundSystem, this, soundPlayData.position, soundPlayData.velocity);
         }
 
         auto MixingBus::PlayPositionalSoundClocked(Sound& sound, const f64 fixedTimestep, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.play3dClocked(
-                fixedTimestep,
-                sound.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume
-            );
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.play3dClocked(
+                    fixedTimestep,
+                    sound.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *m_soundSystem, this, soundPlayData.position, soundPlayData.velocity);
         }
 
         auto MixingBus::PlayPositionalSoundClocked(SoundStream& soundStream, const f64 fixedTimestep, const PositionalSoundPlayData& soundPlayData) -> PositionalSoundSource
         {
-            const VoiceHandle voiceHandle = m_handle.play3dClocked(
-                fixedTimestep,
-                soundStream.GetRawHandle(),
-                soundPlayData.position.x,
-                soundPlayData.position.y,
-                0.0f,
-                soundPlayData.velocity.x,
-                soundPlayData.velocity.y,
-                0.0f,
-                soundPlayData.volume
-            );
-            m_soundSystem->SetVoiceHandleParameters(voiceHandle, soundPlayData);
+            const VoiceHandle voiceHandle = m_soundSystem->PlayVoice(soundPlayData, this, [&]
+            {
+                return m_handle.play3dClocked(
+                    fixedTimestep,
+                    soundStream.GetRawHandle(),
+                    soundPlayData.position.x,
+                    soundPlayData.position.y,
+                    0.0f,
+                    soundPlayData.velocity.x,
+                    soundPlayData.velocity.y,
+                    0.0f,
+                    soundPlayData.volume
+                );
+            });
 
             return PositionalSoundSource(voiceHandle, *m_soundSystem, this, soundPlayData.position, soundPlayData.velocity);
         }
@@ -0,0 +1,377 @@
+#include "stardust/audio/sounds/SampleCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <utility>
+
+#include <soloud/soloud_wav.h>
+#undef min
+#undef max
+
+#include "stardust/filesystem/vfs/VirtualFilesystem.h"
+#include "stardust/filesystem/Filesystem.h"
+#include "stardust/utility/hash/Hash.h"
+
+namespace stardust
+{
+    namespace audio
+    {
+        namespace sample_cache
+        {
+            namespace
+            {
+                struct CacheEntry final
+                {
+                    u64 contentHash;
+                    WeakPointer<const DecodedSamples> samples;
+                };
+
+                struct DiskCacheHeader final
+                {
+                    u32 magic;
+                    u32 version;
+                    u32 format;
+                    u32 channelCount;
+                    f32 sampleRate;
+                    u32 padding;
+                    u64 contentHash;
+                    u64 sampleCount;
+                };
+
+                constexpr u32 DiskCacheMagic = 0x43'50'44'53u;
+                constexpr u32 DiskCacheVersion = 1u;
+
+                std::mutex cacheMutex;
+                HashMap<String, CacheEntry> cacheEntries{ };
+
+                String diskCacheDirectory;
+                SampleCacheFormat diskCacheFormat = SampleCacheFormat::Float32;
+
+                [[nodiscard]] auto HashContents(const List<ubyte>& contents) noexcept -> u64
+                {
+                    return hash::FNV1a(contents);
+                }
+
+                [[nodiscard]] auto GetDiskCacheFilepath(const StringView directory, const u64 contentHash) -> String
+                {
+                    return std::format("{}{}{:016x}.pcm", directory, filesystem::GetDirectorySeparator(), contentHash);
+                }
+
+                [[nodiscard]] auto ReadFromDiskCache(const StringView directory, const u64 contentHash) -> SharedPointer<DecodedSamples>
+                {
+                    const String filepath = GetDiskCacheFilepath(directory, contentHash);
+
+                    if (!filesystem::DoesPathExist(filepath))
+                    {
+                        return nullptr;
+                    }
+
+                    auto fileBytesResult = filesystem::ReadFileBytes(filepath);
+
+                    if (fileBytesResult.is_err())
+                    {
+                        return nullptr;
+                    }
+
+                    const List<ubyte> fileBytes = std::move(fileBytesResult).unwrap();
+
+                    if (fileBytes.size() < sizeof(DiskCacheHeader))
+                    {
+                        return nullptr;
+                    }
+
+                    DiskCacheHeader header{ };
+                    std::memcpy(&header, fileBytes.data(), sizeof(DiskCacheHeader));
+
+                    if (header.magic != DiskCacheMagic || header.version != DiskCacheVersion || header.contentHash != contentHash || header.channelCount == 0u)
+                    {
+                        return nullptr;
+                    }
+
+                    const SampleCacheFormat format = static_cast<SampleCacheFormat>(header.format);
+                    const usize sampleSize = format == SampleCacheFormat::Int16 ? sizeof(i16) : sizeof(f32);
+
+                    if (fileBytes.size() != sizeof(DiskCacheHeader) + header.sampleCount * sampleSize)
+                    {
+                        return nullptr;
+                    }
+
+                    auto decodedSamples = std::make_shared<DecodedSamples>();
+                    decodedSamples->samples.resize(header.sampleCount);
+                    decodedSamples->channelCount = header.channelCount;
+                    decodedSamples->sampleRate = header.sampleRate;
+                    decodedSamples->contentHash = contentHash;
+
+                    const ubyte* const sampleData = fileBytes.data() + sizeof(DiskCacheHeader);
+
+                    switch (format)
+                    {
+                    case SampleCacheFormat::Int16:
+                        for (usize i = 0u; i < header.sampleCount; ++i)
+                        {
+                            i16 sample = 0;
+                            std::memcpy(&sample, sampleData + i * sizeof(i16), sizeof(i16));
+
+                            decodedSamples->samples[i] = static_cast<f32>(sample) / 32'767.0f;
+                        }
+
+                        break;
+
+                    case SampleCacheFormat::Float32:
+                    default:
+                        std::memcpy(decodedSamples->samples.data(), sampleData, header.sampleCount * sizeof(f32));
+
+                        break;
+                    }
+
+                    return decodedSamples;
+                }
+
+                auto WriteToDiskCache(const StringView directory, const SampleCacheFormat format, const DecodedSamples& decodedSamples) -> void
+                {
+                    const usize sampleSize = format == SampleCacheFormat::Int16 ? sizeof(i16) : sizeof(f32);
+
+                    const DiskCacheHeader header{
+                        .magic = DiskCacheMagic,
+                        .version = DiskCacheVersion,
+                        .format = static_cast<u32>(format),
+                        .channelCount = decodedSamples.channelCount,
+                        .sampleRate = decodedSamples.sampleRate,
+                        .padding = 0u,
+                        .contentHash = decodedSamples.contentHash,
+                        .sampleCount = static_cast<u64>(decodedSamples.samples.size()),
+                    };
+
+                    List<ubyte> fileBytes(sizeof(DiskCacheHeader) + decodedSamples.samples.size() * sampleSize);
+                    std::memcpy(fileBytes.data(), &header, sizeof(DiskCacheHeader));
+
+                    ubyte* const sampleData = fileBytes.data() + sizeof(DiskCacheHeader);
+
+                    switch (format)
+                    {
+                    case SampleCacheFormat::Int16:
+                        for (usize i = 0u; i < decodedSamples.samples.size(); ++i)
+                        {
+                            const i16 sample = static_cast<i16>(std::lround(std::clamp(decodedSamples.samples[i], -1.0f, 1.0f) * 32'767.0f));
+                            std::memcpy(sampleData + i * sizeof(i16), &sample, sizeof(i16));
+                        }
+
+                        break;
+
+                    case SampleCacheFormat::Float32:
+                    default:
+                        std::memcpy(sampleData, decodedSamples.samples.data(), decodedSamples.samples.size() * sizeof(f32));
+
+                        break;
+                    }
+
+                    if (!filesystem::DoesPathExist(directory))
+                    {
+                        if (filesystem::CreateDirectory(directory) != Status::Success)
+                        {
+                            return;
+                        }
+                    }
+
+                    [[maybe_unused]] const Status writeStatus = filesystem::WriteBytesToFile(GetDiskCacheFilepath(directory, decodedSamples.contentHash), fileBytes);
+                }
+
+                [[nodiscard]] auto FindCachedSamples(const StringView filepath, const u64 contentHash) -> SharedPointer<const DecodedSamples>
+                {
+                    if (const auto cacheEntryLocation = cacheEntries.find(String(filepath));
+                        cacheEntryLocation != std::cend(cacheEntries) && cacheEntryLocation->second.contentHash == contentHash)
+                    {
+                        if (auto cachedSamples = cacheEntryLocation->second.samples.lock();
+                            cachedSamples != nullptr)
+                        {
+                            return cachedSamples;
+                        }
+                    }
+
+                    for (const auto& [cachedFilepath, cacheEntry] : cacheEntries)
+                    {
+                        if (cacheEntry.contentHash != contentHash)
+                        {
+                            continue;
+                        }
+
+                        if (auto cachedSamples = cacheEntry.samples.lock();
+                            cachedSamples != nullptr)
+                        {
+                            cacheEntries[String(filepath)] = CacheEntry{
+                                .contentHash = contentHash,
+                                .samples = cachedSamples,
+                            };
+
+                            return cachedSamples;
+                        }
+                    }
+
+                    return nullptr;
+                }
+
+                [[nodiscard]] auto Decode(const List<ubyte>& encodedData, const u64 contentHash) -> SharedPointer<DecodedSamples>
+                {
+                    SoLoud::Wav decoder;
+
+                    const SoLoud::result decodeStatus = decoder.loadMem(
+                        encodedData.data(),
+                        static_cast<u32>(encodedData.size()),
+                        false,
+                        false
+                    );
+
+                    if (decodeStatus != 0u || decoder.mData == nullptr)
+                    {
+                        return nullptr;
+                    }
+
+                    const usize sampleCount = static_cast<usize>(decoder.mSampleCount) * static_cast<usize>(decoder.mChannels);
+
+                    auto decodedSamples = std::make_shared<DecodedSamples>();
+                    decodedSamples->samples.assign(decoder.mData, decoder.mData + sampleCount);
+                    decodedSamples->channelCount = decoder.mChannels;
+                    decodedSamples->sampleRate = decoder.mBaseSamplerate;
+                    decodedSamples->contentHash = contentHash;
+
+                    return decodedSamples;
+                }
+            }
+
+            auto SetDiskCacheDirectory(const StringView directory) -> void
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                diskCacheDirectory = String(directory);
+            }
+
+            [[nodiscard]] auto GetDiskCacheDirectory() -> String
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                return diskCacheDirectory;
+            }
+
+            auto SetDiskCacheFormat(const SampleCacheFormat format) -> void
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                diskCacheFormat = format;
+            }
+
+            [[nodiscard]] auto GetDiskCacheFormat() -> SampleCacheFormat
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                return diskCacheFormat;
+            }
+
+            [[nodiscard]] auto Acquire(const StringView filepath) -> SharedPointer<const DecodedSamples>
+            {
+                auto encodedDataResult = vfs::ReadFileBytes(filepath);
+
+                if (encodedDataResult.is_err())
+                {
+                    return nullptr;
+                }
+
+                const List<ubyte> encodedData = std::move(encodedDataResult).unwrap();
+                const u64 contentHash = HashContents(encodedData);
+
+                {
+                    const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                    if (auto cachedSamples = FindCachedSamples(filepath, contentHash);
+                        cachedSamples != nullptr)
+                    {
+                        return cachedSamples;
+                    }
+                }
+
+                const String currentDiskCacheDirectory = GetDiskCacheDirectory();
+                const SampleCacheFormat currentDiskCacheFormat = GetDiskCacheFormat();
+
+                SharedPointer<DecodedSamples> decodedSamples = nullptr;
+
+                if (!currentDiskCacheDirectory.empty())
+                {
+                    decodedSamples = ReadFromDiskCache(currentDiskCacheDirectory, contentHash);
+                }
+
+                if (decodedSamples == nullptr)
+                {
+                    decodedSamples = Decode(encodedData, contentHash);
+
+                    if (decodedSamples == nullptr)
+                    {
+                        return nullptr;
+                    }
+
+                    if (!currentDiskCacheDirectory.empty())
+                    {
+                        WriteToDiskCache(currentDiskCacheDirectory, currentDiskCacheFormat, *decodedSamples);
+                    }
+                }
+
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                if (auto cachedSamples = FindCachedSamples(filepath, contentHash);
+                    cachedSamples != nullptr)
+                {
+                    return cachedSamples;
+                }
+
+                cacheEntries[String(filepath)] = CacheEntry{
+                    .contentHash = contentHash,
+                    .samples = decodedSamples,
+                };
+
+                return decodedSamples;
+            }
+
+            auto PurgeExpired() -> void
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                std::erase_if(cacheEntries, [](const auto& cacheEntry) { return cacheEntry.second.samples.expired(); });
+            }
+
+            auto Clear() -> void
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                cacheEntries.clear();
+            }
+
+            [[nodiscard]] auto GetCachedSoundCount() -> usize
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                return static_cast<usize>(std::ranges::count_if(cacheEntries, [](const auto& cacheEntry) { return !cacheEntry.second.samples.expired(); }));
+            }
+
+            [[nodiscard]] auto GetCachedSampleMemory() -> usize
+            {
+                const std::scoped_lock<std::mutex> lock(cacheMutex);
+
+                HashSet<const DecodedSamples*> countedSamples{ };
+                usize sampleMemory = 0u;
+
+                for (const auto& [filepath, cacheEntry] : cacheEntries)
+                {
+                    if (const auto cachedSamples = cacheEntry.samples.lock();
+                        cachedSamples != nullptr && countedSamples.insert(cachedSamples.get()).second)
+                    {
+                        sampleMemory += cachedSamples->samples.size() * sizeof(f32);
+                    }
+                }
+
+                return sampleMemory;
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include "stardust/audio/sounds/VirtualSoundFile.h"
+
+#include <physfs/physfs.h>
+
+namespace stardust
+{
+    namespace audio
+    {
+        VirtualSoundFile::VirtualSoundFile(const StringView filepath)
+        {
+            [[maybe_unused]] const Status openStatus = Open(filepath);
+        }
+
+        VirtualSoundFile::~VirtualSoundFile() noexcept
+        {
+            Close();
+        }
+
+        [[nodiscard]] auto VirtualSoundFile::Open(const StringView filepath) -> Status
+        {
+            Close();
+
+            m_handle = PHYSFS_openRead(filepath.data());
+
+            if (m_handle == nullptr)
+            {
+                return Status::Fail;
+            }
+
+            const PHYSFS_sint64 fileLength = PHYSFS_fileLength(m_handle);
+
+            if (fileLength <= 0)
+            {
+                Close();
+
+                return Status::Fail;
+            }
+
+            m_length = static_cast<u32>(fileLength);
+
+            return Status::Success;
+        }
+
+        auto VirtualSoundFile::Close() noexcept -> void
+        {
+            if (m_handle != nullptr)
+            {
+                PHYSFS_close(m_handle);
+                m_handle = nullptr;
+            }
+
+            m_length = 0u;
+        }
+
+        [[nodiscard]] auto VirtualSoundFile::eof() -> i32
+        {
+            return m_handle == nullptr || PHYSFS_eof(m_handle) != 0
+                ? 1
+                : 0;
+        }
+
+        [[nodiscard]] auto VirtualSoundFile::read(ubyte* destination, const u32 byteCount) -> u32
+        {
+            if (m_handle == nullptr)
+            {
+                return 0u;
+            }
+
+            const PHYSFS_sint64 bytesRead = PHYSFS_readBytes(m_handle, destination, byteCount);
+
+            return bytesRead > 0
+                ? static_cast<u32>(bytesRead)
+                : 0u;
+        }
+
+        [[nodiscard]] auto VirtualSoundFile::length() -> u32
+        {
+            return m_length;
+        }
+
+        auto VirtualSoundFile::seek(const i32 offset) -> void
+        {
+            if (m_handle != nullptr)
+            {
+                PHYSFS_seek(m_handle, static_cast<PHYSFS_uint64>(offset < 0 ? 0 : offset));
+            }
+        }
+
+        [[nodiscard]] auto VirtualSoundFile::pos() -> u32
+        {
+            if (m_handle == nullptr)
+            {
+                return 0u;
+            }
+
+            const PHYSFS_sint64 position = PHYSFS_tell(m_handle);
+
+            return position > 0
+                ? static_cast<u32>(position)
+                : 0u;
+        }
+    }
+}
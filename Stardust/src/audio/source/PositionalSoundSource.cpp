@@ -173,6 +173,13 @@ namespace stardust
             m_velocity = velocity;
         }
 
+        auto PositionalSoundSource::SetPositionAndVelocity(const Vector2 position, const Vector2 velocity) -> void
+        {
+            m_soundSystem->GetRawHandle().set3dSourceParameters(m_handle, position.x, position.y, 0.0f, velocity.x, velocity.y, 0.0f);
+            m_position = position;
+            m_velocity = velocity;
+        }
+
         auto PositionalSoundSource::SetAttenuationModel(const AttenuationModel attenuationModel) -> void
         {
             m_soundSystem->GetRawHandle().set3dSourceAttenuation(m_handle, static_cast<u32>(attenuationModel), m_attenuationInfo.rolloffFactor);
@@ -0,0 +1,248 @@
+#include "stardust/audio/voices/VoiceManager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+#include "stardust/audio/mixing/MixingBus.h"
+
+namespace stardust
+{
+    namespace audio
+    {
+        [[nodiscard]] auto VoiceManager::EstimateAudibility(const SoundPlayData& soundPlayData) noexcept -> f32
+        {
+            return soundPlayData.volume;
+        }
+
+        [[nodiscard]] auto VoiceManager::EstimateAudibility(const PositionalSoundPlayData& soundPlayData, const Vector2 listenerPosition) -> f32
+        {
+            const AttenuationInfo& attenuation = soundPlayData.attenuation;
+
+            const f32 minDistance = std::max(attenuation.minDistance, std::numeric_limits<f32>::epsilon());
+            const f32 maxDistance = std::max(attenuation.maxDistance, minDistance);
+            const f32 rolloffFactor = std::max(attenuation.rolloffFactor, 0.0f);
+
+            const f32 distance = std::clamp(
+                glm::distance(soundPlayData.position, listenerPosition),
+                minDistance,
+                maxDistance
+            );
+
+            f32 attenuationFactor = 1.0f;
+
+            switch (attenuation.model)
+            {
+            case AttenuationModel::Inverse:
+                attenuationFactor = minDistance / (minDistance + rolloffFactor * (distance - minDistance));
+
+                break;
+
+            case AttenuationModel::Linear:
+                attenuationFactor = 1.0f - rolloffFactor * (distance - minDistance) / std::max(maxDistance - minDistance, std::numeric_limits<f32>::epsilon());
+
+                break;
+
+            case AttenuationModel::Exponential:
+                attenuationFactor = std::pow(distance / minDistance, -rolloffFactor);
+
+                break;
+
+            case AttenuationModel::None:
+            default:
+                break;
+            }
+
+            return soundPlayData.volume * std::max(attenuationFactor, 0.0f);
+        }
+
+        [[nodiscard]] auto VoiceManager::RequestVoice(SoLoud::Soloud& soLoudHandle, const VoiceRequest& voiceRequest) -> bool
+        {
+            ++m_stats.requestedCount;
+
+            if (!voiceRequest.isProtected && voiceRequest.audibility < m_minimumAudibility)
+            {
+                ++m_stats.culledCount;
+
+                return false;
+            }
+
+            SaturatedScopes saturatedScopes = FindSaturatedScopes(voiceRequest);
+
+            if (saturatedScopes.IsAny())
+            {
+                Update(soLoudHandle);
+                saturatedScopes = FindSaturatedScopes(voiceRequest);
+            }
+
+            if (!saturatedScopes.IsAny() || StealVoice(soLoudHandle, voiceRequest, saturatedScopes))
+            {
+                return true;
+            }
+
+            if (!voiceRequest.isProtected)
+            {
+                ++m_stats.culledCount;
+
+                return false;
+            }
+
+            return true;
+        }
+
+        auto VoiceManager::RegisterVoice(const VoiceHandle voiceHandle, const VoiceRequest& voiceRequest) -> void
+        {
+            if (voiceHandle == 0u || voiceHandle == InvalidVoiceHandle)
+            {
+                return;
+            }
+
+            ++m_stats.startedCount;
+
+            m_activeVoices.push_back(ActiveVoice{
+                .handle = voiceHandle,
+                .mixingBus = voiceRequest.mixingBus,
+                .voiceGroup = voiceRequest.voiceGroup,
+                .priority = voiceRequest.priority,
+                .isProtected = voiceRequest.isProtected,
+            });
+        }
+
+        auto VoiceManager::Update(SoLoud::Soloud& soLoudHandle) -> void
+        {
+            std::erase_if(m_activeVoices, [&soLoudHandle](const ActiveVoice& activeVoice) { return !soLoudHandle.isValidVoiceHandle(activeVoice.handle); });
+        }
+
+        auto VoiceManager::Clear() -> void
+        {
+            m_activeVoices.clear();
+        }
+
+        [[nodiscard]] auto VoiceManager::GetMixingBusLimit(const MixingBus& mixingBus) const -> u32
+        {
+            if (const auto limitLocation = m_mixingBusLimits.find(&mixingBus);
+                limitLocation != std::cend(m_mixingBusLimits))
+            {
+                return limitLocation->second;
+            }
+
+            return Unlimited;
+        }
+
+        auto VoiceManager::SetMixingBusLimit(const MixingBus& mixingBus, const u32 voiceLimit) -> void
+        {
+            if (voiceLimit == Unlimited)
+            {
+                m_mixingBusLimits.erase(&mixingBus);
+            }
+            else
+            {
+                m_mixingBusLimits[&mixingBus] = voiceLimit;
+            }
+        }
+
+        [[nodiscard]] auto VoiceManager::GetVoiceGroupLimit(const VoiceGroup voiceGroup) const -> u32
+        {
+            if (const auto limitLocation = m_voiceGroupLimits.find(voiceGroup);
+                limitLocation != std::cend(m_voiceGroupLimits))
+            {
+                return limitLocation->second;
+            }
+
+            return Unlimited;
+        }
+
+        auto VoiceManager::SetVoiceGroupLimit(const VoiceGroup voiceGroup, const u32 voiceLimit) -> void
+        {
+            if (voiceLimit == Unlimited)
+            {
+                m_voiceGroupLimits.erase(voiceGroup);
+            }
+            else
+            {
+                m_voiceGroupLimits[voiceGroup] = voiceLimit;
+            }
+        }
+
+        [[nodiscard]] auto VoiceManager::FindSaturatedScopes(const VoiceRequest& voiceRequest) const -> SaturatedScopes
+        {
+            const u32 mixingBusLimit = voiceRequest.mixingBus != nullptr ? GetMixingBusLimit(*voiceRequest.mixingBus) : Unlimited;
+            const u32 voiceGroupLimit = voiceRequest.voiceGroup != NoVoiceGroup ? GetVoiceGroupLimit(voiceRequest.voiceGroup) : Unlimited;
+
+            u32 mixingBusVoiceCount = 0u;
+            u32 voiceGroupVoiceCount = 0u;
+
+            if (mixingBusLimit != Unlimited || voiceGroupLimit != Unlimited)
+            {
+                for (const ActiveVoice& activeVoice : m_activeVoices)
+                {
+                    if (activeVoice.mixingBus == voiceRequest.mixingBus)
+                    {
+                        ++mixingBusVoiceCount;
+                    }
+
+                    if (activeVoice.voiceGroup == voiceRequest.voiceGroup)
+                    {
+                        ++voiceGroupVoiceCount;
+                    }
+                }
+            }
+
+            return SaturatedScopes{
+                .isGlobal = m_maxVoices != Unlimited && m_activeVoices.size() >= m_maxVoices,
+                .isMixingBus = mixingBusLimit != Unlimited && mixingBusVoiceCount >= mixingBusLimit,
+                .isVoiceGroup = voiceGroupLimit != Unlimited && voiceGroupVoiceCount >= voiceGroupLimit,
+            };
+        }
+
+        [[nodiscard]] auto VoiceManager::StealVoice(SoLoud::Soloud& soLoudHandle, const VoiceRequest& voiceRequest, const SaturatedScopes& saturatedScopes) -> bool
+        {
+            auto victimLocation = std::end(m_activeVoices);
+            f32 victimVolume = 0.0f;
+
+            for (auto activeVoiceLocation = std::begin(m_activeVoices); activeVoiceLocation != std::end(m_activeVoices); ++activeVoiceLocation)
+            {
+                if (activeVoiceLocation->isProtected
+                    || (saturatedScopes.isMixingBus && activeVoiceLocation->mixingBus != voiceRequest.mixingBus)
+                    || (saturatedScopes.isVoiceGroup && activeVoiceLocation->voiceGroup != voiceRequest.voiceGroup))
+                {
+                    continue;
+                }
+
+                const f32 activeVoiceVolume = soLoudHandle.getOverallVolume(activeVoiceLocation->handle);
+
+                if (victimLocation == std::end(m_activeVoices)
+                    || activeVoiceLocation->priority < victimLocation->priority
+                    || (activeVoiceLocation->priority == victimLocation->priority && activeVoiceVolume < victimVolume))
+                {
+                    victimLocation = activeVoiceLocation;
+                    victimVolume = activeVoiceVolume;
+                }
+            }
+
+            if (victimLocation == std::end(m_activeVoices))
+            {
+                return false;
+            }
+
+            const bool canStealVictim = voiceRequest.isProtected
+                || victimLocation->priority < voiceRequest.priority
+                || (victimLocation->priority == voiceRequest.priority && victimVolume < voiceRequest.audibility);
+
+            if (!canStealVictim)
+            {
+                return false;
+            }
+
+            soLoudHandle.stop(victimLocation->handle);
+            m_activeVoices.erase(victimLocation);
+
+            ++m_stats.stolenCount;
+
+            return true;
+        }
+    }
+}
@@ -49,6 +49,24 @@ namespace stardust
         return viewMatrix;
     }
 
+    [[nodiscard]] auto Camera2D::GetViewBounds() const noexcept -> Pair<Vector2, Vector2>
+    {
+        const f32 absoluteZoom = glm::abs(m_zoom);
+        const Vector2 halfViewSize{ m_halfSize / absoluteZoom, m_halfSize / m_aspectRatio / absoluteZoom };
+
+        const f32 rotationCosine = glm::abs(glm::cos(glm::radians(m_rotation)));
+        const f32 rotationSine = glm::abs(glm::sin(glm::radians(m_rotation)));
+
+        const Vector2 halfBoundsSize{
+            rotationCosine * halfViewSize.x + rotationSine * halfViewSize.y,
+            rotationSine * halfViewSize.x + rotationCosine * halfViewSize.y,
+        };
+
+        const Vector2 position = GetPosition();
+
+        return { position - halfBoundsSize, position + halfBoundsSize };
+    }
+
     [[nodiscard]] auto Camera2D::WorldSpaceToScreenSpace(Vector2 position) const noexcept -> IVector2
     {
         position.x += m_halfSize;
@@ -0,0 +1,133 @@
+#include "stardust/ecs/culling/SpriteCuller.h"
+
+#include "stardust/ecs/components/SpriteComponent.h"
+#include "stardust/math/Math.h"
+
+namespace stardust
+{
+    [[nodiscard]] auto SpriteCuller::GetTransformBounds(const components::Transform& transform) noexcept -> Pair<Vector2, Vector2>
+    {
+        f32 shearX = 0.0f;
+        f32 shearY = 0.0f;
+
+        if (transform.shear.has_value())
+        {
+            shearX = glm::tan(glm::radians(transform.shear.value().x));
+            shearY = glm::tan(glm::radians(transform.shear.value().y));
+        }
+
+        const f32 scaledXX = (1.0f + shearX * shearY) * transform.scale.x;
+        const f32 scaledXY = shearX * transform.scale.y;
+        const f32 scaledYX = shearY * transform.scale.x;
+        const f32 scaledYY = transform.scale.y;
+
+        const f32 rotationCosine = glm::cos(-glm::radians(transform.rotation));
+        const f32 rotationSine = glm::sin(-glm::radians(transform.rotation));
+
+        const Vector2 halfSize{
+            0.5f * (glm::abs(rotationCosine * scaledXX - rotationSine * scaledYX) + glm::abs(rotationCosine * scaledXY - rotationSine * scaledYY)),
+            0.5f * (glm::abs(rotationSine * scaledXX + rotationCosine * scaledYX) + glm::abs(rotationSine * scaledXY + rotationCosine * scaledYY)),
+        };
+
+        Vector2 centre = transform.translation;
+
+        if (transform.pivot.has_value())
+        {
+            const Vector2 pivot = transform.pivot.value();
+
+            centre += pivot - Vector2{
+                rotationCosine * pivot.x - rotationSine * pivot.y,
+                rotationSine * pivot.x + rotationCosine * pivot.y,
+            };
+        }
+
+        return { centre - halfSize, centre + halfSize };
+    }
+
+    SpriteCuller::SpriteCuller(EntityRegistry& registry)
+    {
+        Initialise(registry);
+    }
+
+    auto SpriteCuller::Cull(const Camera2D& camera) -> void
+    {
+        GatherBounds();
+        TestBounds(camera.GetViewBounds());
+
+        m_visibleEntities.clear();
+
+        for (usize i = 0u; i < m_candidateEntities.size(); ++i)
+        {
+            if (m_visibilityFlags[i] != 0u)
+            {
+                m_visibleEntities.push_back(m_candidateEntities[i]);
+            }
+        }
+
+        m_statistics = Statistics{
+            .visibleCount = static_cast<u32>(m_visibleEntities.size()),
+            .culledCount = static_cast<u32>(m_candidateEntities.size() - m_visibleEntities.size()),
+        };
+    }
+
+    auto SpriteCuller::BatchVisibleSprites(graphics::Renderer& renderer) const -> void
+    {
+        const entt::registry& registry = m_registry->GetHandle();
+
+        for (const EntityHandle entityHandle : m_visibleEntities)
+        {
+            const auto [transform, sprite] = registry.get<const components::Transform, const components::Sprite>(entityHandle);
+
+            renderer.BatchRectangle(transform, sprite);
+        }
+    }
+
+    auto SpriteCuller::GatherBounds() -> void
+    {
+        const auto spriteView = m_registry->GetHandle().view<const components::Transform, const components::Sprite>();
+
+        m_candidateEntities.clear();
+        m_lowerXBounds.clear();
+        m_lowerYBounds.clear();
+        m_upperXBounds.clear();
+        m_upperYBounds.clear();
+
+        for (const auto [entityHandle, transform, sprite] : spriteView.each())
+        {
+            const auto [lowerBound, upperBound] = GetTransformBounds(transform);
+
+            m_candidateEntities.push_back(entityHandle);
+            m_lowerXBounds.push_back(lowerBound.x);
+            m_lowerYBounds.push_back(lowerBound.y);
+            m_upperXBounds.push_back(upperBound.x);
+            m_upperYBounds.push_back(upperBound.y);
+        }
+    }
+
+    auto SpriteCuller::TestBounds(const Pair<Vector2, Vector2>& viewBounds) -> void
+    {
+        const usize candidateCount = m_candidateEntities.size();
+        m_visibilityFlags.resize(candidateCount);
+
+        const f32 viewLowerX = viewBounds.first.x;
+        const f32 viewLowerY = viewBounds.first.y;
+        const f32 viewUpperX = viewBounds.second.x;
+        const f32 viewUpperY = viewBounds.second.y;
+
+        const f32* const lowerXBounds = m_lowerXBounds.data();
+        const f32* const lowerYBounds = m_lowerYBounds.data();
+        const f32* const upperXBounds = m_upperXBounds.data();
+        const f32* const upperYBounds = m_upperYBounds.data();
+        u8* const visibilityFlags = m_visibilityFlags.data();
+
+        for (usize i = 0u; i < candidateCount; ++i)
+        {
+            visibilityFlags[i] = static_cast<u8>(
+                static_cast<u8>(lowerXBounds[i] <= viewUpperX) &
+                static_cast<u8>(upperXBounds[i] >= viewLowerX) &
+                static_cast<u8>(lowerYBounds[i] <= viewUpperY) &
+                static_cast<u8>(upperYBounds[i] >= viewLowerY)
+            );
+        }
+    }
+}
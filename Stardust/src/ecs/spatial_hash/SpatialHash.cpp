@@ -0,0 +1,267 @@
+#include "stardust/ecs/spatial_hash/SpatialHash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "stardust/ecs/components/TransformComponent.h"
+#include "stardust/math/Math.h"
+
+namespace stardust
+{
+    SpatialHash::SpatialHash(EntityRegistry& registry, const f32 cellSize)
+    {
+        Initialise(registry, cellSize);
+    }
+
+    SpatialHash::~SpatialHash() noexcept
+    {
+        if (m_registry != nullptr)
+        {
+            m_registry->GetHandle().on_destroy<components::Transform>().disconnect(*this);
+        }
+    }
+
+    auto SpatialHash::Initialise(EntityRegistry& registry, const f32 cellSize) -> void
+    {
+        if (m_registry != nullptr)
+        {
+            m_registry->GetHandle().on_destroy<components::Transform>().disconnect(*this);
+        }
+
+        m_registry = &registry;
+        m_cellSize = cellSize;
+
+        m_registry->GetHandle().on_destroy<components::Transform>().connect<&SpatialHash::OnTransformDestroyed>(*this);
+
+        Rebuild();
+    }
+
+    auto SpatialHash::Update() -> void
+    {
+        for (const auto [entityHandle, transform] : m_registry->GetHandle().view<const components::Transform>().each())
+        {
+            if (const auto entityLocation = m_entityLocations.find(entityHandle);
+                entityLocation != std::cend(m_entityLocations) && entityLocation->second.position == transform.translation)
+            {
+                continue;
+            }
+
+            Insert(entityHandle, transform.translation);
+        }
+    }
+
+    auto SpatialHash::Rebuild() -> void
+    {
+        Clear();
+
+        for (const auto [entityHandle, transform] : m_registry->GetHandle().view<const components::Transform>().each())
+        {
+            Insert(entityHandle, transform.translation);
+        }
+    }
+
+    auto SpatialHash::Clear() -> void
+    {
+        m_cells.clear();
+        m_entityLocations.clear();
+    }
+
+    auto SpatialHash::Refresh(const EntityHandle entityHandle) -> void
+    {
+        if (const ObserverPointer<const components::Transform> transform = m_registry->GetHandle().try_get<components::Transform>(entityHandle);
+            transform != nullptr)
+        {
+            Insert(entityHandle, transform->translation);
+        }
+        else
+        {
+            Remove(entityHandle);
+        }
+    }
+
+    auto SpatialHash::Remove(const EntityHandle entityHandle) -> void
+    {
+        const auto entityLocation = m_entityLocations.find(entityHandle);
+
+        if (entityLocation == std::end(m_entityLocations))
+        {
+            return;
+        }
+
+        const CellKey cellKey = entityLocation->second.cellKey;
+        const usize cellIndex = entityLocation->second.cellIndex;
+        m_entityLocations.erase(entityLocation);
+
+        List<CellEntry>& cellEntries = m_cells[cellKey];
+
+        if (cellIndex != cellEntries.size() - 1u)
+        {
+            cellEntries[cellIndex] = cellEntries.back();
+            m_entityLocations[cellEntries[cellIndex].entityHandle].cellIndex = cellIndex;
+        }
+
+        cellEntries.pop_back();
+
+        if (cellEntries.empty())
+        {
+            m_cells.erase(cellKey);
+        }
+    }
+
+    [[nodiscard]] auto SpatialHash::QueryRadius(const Vector2 centre, const f32 radius) const -> List<EntityHandle>
+    {
+        List<EntityHandle> results{ };
+        QueryRadius(centre, radius, results);
+
+        return results;
+    }
+
+    auto SpatialHash::QueryRadius(const Vector2 centre, const f32 radius, List<EntityHandle>& results) const -> void
+    {
+        results.clear();
+
+        const f32 squaredRadius = radius * radius;
+
+        ForEachCellEntry(centre - Vector2{ radius, radius }, centre + Vector2{ radius, radius }, [&results, centre, squaredRadius](const CellEntry& cellEntry)
+        {
+            const Vector2 offset = cellEntry.position - centre;
+
+            if (glm::dot(offset, offset) <= squaredRadius)
+            {
+                results.push_back(cellEntry.entityHandle);
+            }
+        });
+    }
+
+    [[nodiscard]] auto SpatialHash::QueryAABB(const physics::AABB& box) const -> List<EntityHandle>
+    {
+        List<EntityHandle> results{ };
+        QueryAABB(box, results);
+
+        return results;
+    }
+
+    auto SpatialHash::QueryAABB(const physics::AABB& box, List<EntityHandle>& results) const -> void
+    {
+        results.clear();
+
+        ForEachCellEntry(box.GetLowerBound(), box.GetUpperBound(), [&results, &box](const CellEntry& cellEntry)
+        {
+            if (box.Contains(cellEntry.position))
+            {
+                results.push_back(cellEntry.entityHandle);
+            }
+        });
+    }
+
+    [[nodiscard]] auto SpatialHash::QueryNearest(const Vector2 position, const usize count, const f32 maxDistance) const -> List<EntityHandle>
+    {
+        List<EntityHandle> results{ };
+        QueryNearest(position, count, results, maxDistance);
+
+        return results;
+    }
+
+    auto SpatialHash::QueryNearest(const Vector2 position, const usize count, List<EntityHandle>& results, const f32 maxDistance) const -> void
+    {
+        results.clear();
+
+        if (count == 0u || m_entityLocations.empty())
+        {
+            return;
+        }
+
+        List<Pair<f32, EntityHandle>> candidates{ };
+        f32 searchRadius = std::min(m_cellSize, maxDistance);
+
+        while (true)
+        {
+            candidates.clear();
+
+            const f32 squaredSearchRadius = searchRadius * searchRadius;
+
+            ForEachCellEntry(position - Vector2{ searchRadius, searchRadius }, position + Vector2{ searchRadius, searchRadius }, [&candidates, position, squaredSearchRadius](const CellEntry& cellEntry)
+            {
+                const Vector2 offset = cellEntry.position - position;
+
+                if (const f32 squaredDistance = glm::dot(offset, offset);
+                    squaredDistance <= squaredSearchRadius)
+                {
+                    candidates.emplace_back(squaredDistance, cellEntry.entityHandle);
+                }
+            });
+
+            if (candidates.size() >= count || candidates.size() == m_entityLocations.size() || searchRadius >= maxDistance)
+            {
+                break;
+            }
+
+            searchRadius = std::min(searchRadius * 2.0f, maxDistance);
+        }
+
+        const usize resultCount = std::min(count, candidates.size());
+
+        std::partial_sort(
+            std::begin(candidates), std::begin(candidates) + resultCount, std::end(candidates),
+            [](const Pair<f32, EntityHandle>& lhs, const Pair<f32, EntityHandle>& rhs) { return lhs.first < rhs.first; }
+        );
+
+        results.reserve(resultCount);
+
+        for (usize i = 0u; i < resultCount; ++i)
+        {
+            results.push_back(candidates[i].second);
+        }
+    }
+
+    [[nodiscard]] auto SpatialHash::GetCellCoordinates(const Vector2 position) const -> IVector2
+    {
+        return IVector2{
+            static_cast<i32>(std::floor(position.x / m_cellSize)),
+            static_cast<i32>(std::floor(position.y / m_cellSize)),
+        };
+    }
+
+    [[nodiscard]] auto SpatialHash::GetCellKey(const IVector2 cellCoordinates) noexcept -> CellKey
+    {
+        return (static_cast<CellKey>(static_cast<u32>(cellCoordinates.x)) << 32u) | static_cast<CellKey>(static_cast<u32>(cellCoordinates.y));
+    }
+
+    auto SpatialHash::Insert(const EntityHandle entityHandle, const Vector2 position) -> void
+    {
+        const CellKey cellKey = GetCellKey(GetCellCoordinates(position));
+
+        if (const auto entityLocation = m_entityLocations.find(entityHandle);
+            entityLocation != std::end(m_entityLocations))
+        {
+            if (entityLocation->second.cellKey == cellKey)
+            {
+                m_cells[cellKey][entityLocation->second.cellIndex].position = position;
+                entityLocation->second.position = position;
+
+                return;
+            }
+
+            Remove(entityHandle);
+        }
+
+        List<CellEntry>& cellEntries = m_cells[cellKey];
+
+        m_entityLocations[entityHandle] = EntityLocation{
+            .cellKey = cellKey,
+            .cellIndex = cellEntries.size(),
+            .position = position,
+        };
+
+        cellEntries.push_back(CellEntry{
+            .entityHandle = entityHandle,
+            .position = position,
+        });
+    }
+
+    auto SpatialHash::OnTransformDestroyed(entt::registry&, const EntityHandle entityHandle) -> void
+    {
+        Remove(entityHandle);
+    }
+}
@@ -227,6 +227,15 @@ namespace stardust
                 : Status::Fail;
         }
 
+        [[nodiscard]] auto RemoveFile(const StringView filepath) -> Status
+        {
+            std::error_code errorCode{ };
+
+            return std::filesystem::remove(filepath, errorCode)
+                ? Status::Success
+                : Status::Fail;
+        }
+
         [[nodiscard]] auto GetDirectorySeparator() -> String
         {
         #ifdef STARDUST_PLATFORM_WINDOWS
@@ -410,7 +419,6 @@ namespace stardust
             }
 
             outputFile.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
-            outputFile << data.data();
             outputFile.close();
 
             return Status::Success;
@@ -0,0 +1,165 @@
+#include "stardust/filesystem/MemoryMappedFile.h"
+
+#ifdef STARDUST_PLATFORM_WINDOWS
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+namespace stardust
+{
+    namespace filesystem
+    {
+        MemoryMappedFile::MemoryMappedFile(const StringView filepath)
+        {
+            [[maybe_unused]] const Status openStatus = Open(filepath);
+        }
+
+        MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+        {
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            std::swap(m_fileHandle, other.m_fileHandle);
+            std::swap(m_mappingHandle, other.m_mappingHandle);
+        }
+
+        auto MemoryMappedFile::operator =(MemoryMappedFile&& other) noexcept -> MemoryMappedFile&
+        {
+            Close();
+
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            std::swap(m_fileHandle, other.m_fileHandle);
+            std::swap(m_mappingHandle, other.m_mappingHandle);
+
+            return *this;
+        }
+
+        MemoryMappedFile::~MemoryMappedFile() noexcept
+        {
+            Close();
+        }
+
+    #ifdef STARDUST_PLATFORM_WINDOWS
+        [[nodiscard]] auto MemoryMappedFile::Open(const StringView filepath) -> Status
+        {
+            Close();
+
+            const HANDLE fileHandle = CreateFileA(String(filepath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+            if (fileHandle == INVALID_HANDLE_VALUE)
+            {
+                return Status::Fail;
+            }
+
+            LARGE_INTEGER fileSize{ };
+
+            if (GetFileSizeEx(fileHandle, &fileSize) == FALSE || fileSize.QuadPart == 0)
+            {
+                CloseHandle(fileHandle);
+
+                return Status::Fail;
+            }
+
+            const HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+
+            if (mappingHandle == nullptr)
+            {
+                CloseHandle(fileHandle);
+
+                return Status::Fail;
+            }
+
+            const void* const mappedData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0u, 0u, 0u);
+
+            if (mappedData == nullptr)
+            {
+                CloseHandle(mappingHandle);
+                CloseHandle(fileHandle);
+
+                return Status::Fail;
+            }
+
+            m_data = static_cast<const ubyte*>(mappedData);
+            m_size = static_cast<usize>(fileSize.QuadPart);
+            m_fileHandle = fileHandle;
+            m_mappingHandle = mappingHandle;
+
+            return Status::Success;
+        }
+
+        auto MemoryMappedFile::Close() noexcept -> void
+        {
+            if (m_data != nullptr)
+            {
+                UnmapViewOfFile(m_data);
+                m_data = nullptr;
+            }
+
+            if (m_mappingHandle != nullptr)
+            {
+                CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+                m_mappingHandle = nullptr;
+            }
+
+            if (m_fileHandle != nullptr)
+            {
+                CloseHandle(static_cast<HANDLE>(m_fileHandle));
+                m_fileHandle = nullptr;
+            }
+
+            m_size = 0u;
+        }
+    #else
+        [[nodiscard]] auto MemoryMappedFile::Open(const StringView filepath) -> Status
+        {
+            Close();
+
+            const int fileDescriptor = open(String(filepath).c_str(), O_RDONLY);
+
+            if (fileDescriptor == -1)
+            {
+                return Status::Fail;
+            }
+
+            struct stat fileStats{ };
+
+            if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size == 0)
+            {
+                close(fileDescriptor);
+
+                return Status::Fail;
+            }
+
+            void* const mappedData = mmap(nullptr, static_cast<usize>(fileStats.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            close(fileDescriptor);
+
+            if (mappedData == MAP_FAILED)
+            {
+                return Status::Fail;
+            }
+
+            m_data = static_cast<const ubyte*>(mappedData);
+            m_size = static_cast<usize>(fileStats.st_size);
+
+            return Status::Success;
+        }
+
+        auto MemoryMappedFile::Close() noexcept -> void
+        {
+            if (m_data != nullptr)
+            {
+                munmap(const_cast<ubyte*>(m_data), m_size);
+                m_data = nullptr;
+            }
+
+            m_size = 0u;
+        }
+    #endif
+    }
+}
@@ -0,0 +1,645 @@
+#include "stardust/filesystem/vfs/PackArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <physfs/physfs.h>
+
+#include "stardust/utility/hash/Hash.h"
+
+namespace stardust
+{
+    namespace vfs
+    {
+        namespace
+        {
+            [[nodiscard]] auto DecompressLZ4Block(const Slice<const ubyte> source, const Slice<ubyte> destination) noexcept -> bool
+            {
+                const ubyte* sourcePointer = source.data();
+                const ubyte* const sourceEnd = source.data() + source.size();
+
+                ubyte* destinationPointer = destination.data();
+                ubyte* const destinationEnd = destination.data() + destination.size();
+
+                const auto readLength = [&sourcePointer, sourceEnd](usize length) noexcept -> Optional<usize>
+                {
+                    if (length != 15u)
+                    {
+                        return length;
+                    }
+
+                    ubyte extraLength = 255u;
+
+                    while (extraLength == 255u)
+                    {
+                        if (sourcePointer == sourceEnd)
+                        {
+                            return None;
+                        }
+
+                        extraLength = *sourcePointer++;
+                        length += extraLength;
+                    }
+
+                    return length;
+                };
+
+                while (sourcePointer < sourceEnd)
+                {
+                    const ubyte token = *sourcePointer++;
+
+                    const Optional<usize> literalLength = readLength(static_cast<usize>(token >> 4u));
+
+                    if (!literalLength.has_value()
+                        || literalLength.value() > static_cast<usize>(sourceEnd - sourcePointer)
+                        || literalLength.value() > static_cast<usize>(destinationEnd - destinationPointer))
+                    {
+                        return false;
+                    }
+
+                    std::memcpy(destinationPointer, sourcePointer, literalLength.value());
+                    sourcePointer += literalLength.value();
+                    destinationPointer += literalLength.value();
+
+                    if (sourcePointer == sourceEnd)
+                    {
+                        break;
+                    }
+
+                    if (sourceEnd - sourcePointer < 2)
+                    {
+                        return false;
+                    }
+
+                    const usize matchOffset = static_cast<usize>(sourcePointer[0]) | (static_cast<usize>(sourcePointer[1]) << 8u);
+                    sourcePointer += 2;
+
+                    if (matchOffset == 0u || matchOffset > static_cast<usize>(destinationPointer - destination.data()))
+                    {
+                        return false;
+                    }
+
+                    const Optional<usize> matchLength = readLength(static_cast<usize>(token & 0x0Fu));
+
+                    if (!matchLength.has_value() || matchLength.value() + 4u > static_cast<usize>(destinationEnd - destinationPointer))
+                    {
+                        return false;
+                    }
+
+                    const ubyte* matchPointer = destinationPointer - matchOffset;
+
+                    for (usize i = 0u; i < matchLength.value() + 4u; ++i)
+                    {
+                        *destinationPointer++ = *matchPointer++;
+                    }
+                }
+
+                return destinationPointer == destinationEnd;
+            }
+
+            struct MountedPackArchive final
+            {
+                PackArchive archive;
+                PHYSFS_Io* io = nullptr;
+                String name;
+            };
+
+            struct PackFileReader final
+            {
+                Slice<const ubyte> bytes;
+                SharedPointer<const List<ubyte>> ownedBytes;
+                u64 position;
+            };
+
+            std::mutex mountedPackArchivesMutex;
+            HashMap<String, ObserverPointer<const PackArchive>> mountedPackArchives{ };
+
+            [[nodiscard]] auto CreateReaderIo(const Slice<const ubyte> bytes, SharedPointer<const List<ubyte>> ownedBytes) -> PHYSFS_Io*;
+
+            auto ReadFromReader(PHYSFS_Io* io, void* buffer, const PHYSFS_uint64 length) -> PHYSFS_sint64
+            {
+                PackFileReader& reader = *static_cast<PackFileReader*>(io->opaque);
+
+                const u64 bytesToRead = std::min<u64>(length, static_cast<u64>(reader.bytes.size()) - reader.position);
+
+                if (bytesToRead > 0u)
+                {
+                    std::memcpy(buffer, reader.bytes.data() + reader.position, static_cast<usize>(bytesToRead));
+                    reader.position += bytesToRead;
+                }
+
+                return static_cast<PHYSFS_sint64>(bytesToRead);
+            }
+
+            auto WriteToReader(PHYSFS_Io*, const void*, PHYSFS_uint64) -> PHYSFS_sint64
+            {
+                PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+                return -1;
+            }
+
+            auto SeekReader(PHYSFS_Io* io, const PHYSFS_uint64 offset) -> int
+            {
+                PackFileReader& reader = *static_cast<PackFileReader*>(io->opaque);
+
+                if (offset > static_cast<u64>(reader.bytes.size()))
+                {
+                    PHYSFS_setErrorCode(PHYSFS_ERR_PAST_EOF);
+
+                    return 0;
+                }
+
+                reader.position = offset;
+
+                return 1;
+            }
+
+            auto TellReader(PHYSFS_Io* io) -> PHYSFS_sint64
+            {
+                return static_cast<PHYSFS_sint64>(static_cast<PackFileReader*>(io->opaque)->position);
+            }
+
+            auto GetReaderLength(PHYSFS_Io* io) -> PHYSFS_sint64
+            {
+                return static_cast<PHYSFS_sint64>(static_cast<PackFileReader*>(io->opaque)->bytes.size());
+            }
+
+            auto DuplicateReader(PHYSFS_Io* io) -> PHYSFS_Io*
+            {
+                const PackFileReader& reader = *static_cast<PackFileReader*>(io->opaque);
+
+                return CreateReaderIo(reader.bytes, reader.ownedBytes);
+            }
+
+            auto FlushReader(PHYSFS_Io*) -> int
+            {
+                return 1;
+            }
+
+            auto DestroyReader(PHYSFS_Io* io) -> void
+            {
+                delete static_cast<PackFileReader*>(io->opaque);
+                delete io;
+            }
+
+            [[nodiscard]] auto CreateReaderIo(const Slice<const ubyte> bytes, SharedPointer<const List<ubyte>> ownedBytes) -> PHYSFS_Io*
+            {
+                return new PHYSFS_Io{
+                    .version = 0u,
+                    .opaque = new PackFileReader{
+                        .bytes = bytes,
+                        .ownedBytes = std::move(ownedBytes),
+                        .position = 0u,
+                    },
+                    .read = ReadFromReader,
+                    .write = WriteToReader,
+                    .seek = SeekReader,
+                    .tell = TellReader,
+                    .length = GetReaderLength,
+                    .duplicate = DuplicateReader,
+                    .flush = FlushReader,
+                    .destroy = DestroyReader,
+                };
+            }
+
+            auto OpenPackArchive(PHYSFS_Io* io, const char* name, const int forWrite, int* claimed) -> void*
+            {
+                Array<ubyte, sizeof(PackHeader)> headerBytes{ };
+
+                if (io->read(io, headerBytes.data(), headerBytes.size()) != static_cast<PHYSFS_sint64>(headerBytes.size())
+                    || !PackArchive::IsPackArchive(headerBytes))
+                {
+                    return nullptr;
+                }
+
+                *claimed = 1;
+
+                if (forWrite != 0)
+                {
+                    PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+                    return nullptr;
+                }
+
+                auto mountedPackArchive = std::make_unique<MountedPackArchive>();
+                mountedPackArchive->name = name;
+
+                if (mountedPackArchive->archive.Open(name) != Status::Success)
+                {
+                    const PHYSFS_sint64 archiveLength = io->length(io);
+
+                    if (archiveLength <= 0 || io->seek(io, 0u) == 0)
+                    {
+                        PHYSFS_setErrorCode(PHYSFS_ERR_IO);
+
+                        return nullptr;
+                    }
+
+                    List<ubyte> archiveBytes(static_cast<usize>(archiveLength));
+
+                    if (io->read(io, archiveBytes.data(), archiveBytes.size()) != archiveLength
+                        || mountedPackArchive->archive.Open(std::move(archiveBytes)) != Status::Success)
+                    {
+                        PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+
+                        return nullptr;
+                    }
+                }
+
+                mountedPackArchive->io = io;
+
+                {
+                    const std::scoped_lock<std::mutex> lock(mountedPackArchivesMutex);
+                    mountedPackArchives[mountedPackArchive->name] = &mountedPackArchive->archive;
+                }
+
+                return mountedPackArchive.release();
+            }
+
+            auto EnumeratePackArchive(void* opaque, const char* directoryName, PHYSFS_EnumerateCallback callback, const char* originalDirectory, void* callbackData) -> PHYSFS_EnumerateCallbackResult
+            {
+                const PackArchive& archive = static_cast<MountedPackArchive*>(opaque)->archive;
+                const ObserverPointer<const List<String>> children = archive.GetDirectoryChildren(directoryName);
+
+                if (children == nullptr)
+                {
+                    PHYSFS_setErrorCode(PHYSFS_ERR_NOT_FOUND);
+
+                    return PHYSFS_ENUM_ERROR;
+                }
+
+                for (const String& child : *children)
+                {
+                    switch (callback(callbackData, originalDirectory, child.c_str()))
+                    {
+                    case PHYSFS_ENUM_ERROR:
+                        PHYSFS_setErrorCode(PHYSFS_ERR_APP_CALLBACK);
+
+                        return PHYSFS_ENUM_ERROR;
+
+                    case PHYSFS_ENUM_STOP:
+                        return PHYSFS_ENUM_STOP;
+
+                    case PHYSFS_ENUM_OK:
+                    default:
+                        break;
+                    }
+                }
+
+                return PHYSFS_ENUM_OK;
+            }
+
+            auto OpenPackEntryRead(void* opaque, const char* filename) -> PHYSFS_Io*
+            {
+                const PackArchive& archive = static_cast<MountedPackArchive*>(opaque)->archive;
+                const ObserverPointer<const PackEntry> entry = archive.FindEntry(filename);
+
+                if (entry == nullptr)
+                {
+                    PHYSFS_setErrorCode(archive.IsDirectory(filename) ? PHYSFS_ERR_NOT_A_FILE : PHYSFS_ERR_NOT_FOUND);
+
+                    return nullptr;
+                }
+
+                if (const Optional<Slice<const ubyte>> entryView = archive.GetEntryView(*entry);
+                    entryView.has_value())
+                {
+                    return CreateReaderIo(entryView.value(), nullptr);
+                }
+
+                auto entryBytes = std::make_shared<List<ubyte>>(static_cast<usize>(entry->size));
+
+                if (archive.ReadEntry(*entry, *entryBytes) != Status::Success)
+                {
+                    PHYSFS_setErrorCode(entry->compression == PackCompression::Zstd ? PHYSFS_ERR_UNSUPPORTED : PHYSFS_ERR_CORRUPT);
+
+                    return nullptr;
+                }
+
+                const Slice<const ubyte> entryByteView(entryBytes->data(), entryBytes->size());
+
+                return CreateReaderIo(entryByteView, std::move(entryBytes));
+            }
+
+            auto OpenPackEntryWrite(void*, const char*) -> PHYSFS_Io*
+            {
+                PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+                return nullptr;
+            }
+
+            auto ModifyPackArchive(void*, const char*) -> int
+            {
+                PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+                return 0;
+            }
+
+            auto StatPackEntry(void* opaque, const char* filename, PHYSFS_Stat* stat) -> int
+            {
+                const PackArchive& archive = static_cast<MountedPackArchive*>(opaque)->archive;
+
+                stat->modtime = -1;
+                stat->createtime = -1;
+                stat->accesstime = -1;
+                stat->readonly = 1;
+
+                if (const ObserverPointer<const PackEntry> entry = archive.FindEntry(filename);
+                    entry != nullptr)
+                {
+                    stat->filesize = static_cast<PHYSFS_sint64>(entry->size);
+                    stat->filetype = PHYSFS_FILETYPE_REGULAR;
+
+                    return 1;
+                }
+
+                if (archive.IsDirectory(filename))
+                {
+                    stat->filesize = 0;
+                    stat->filetype = PHYSFS_FILETYPE_DIRECTORY;
+
+                    return 1;
+                }
+
+                PHYSFS_setErrorCode(PHYSFS_ERR_NOT_FOUND);
+
+                return 0;
+            }
+
+            auto ClosePackArchive(void* opaque) -> void
+            {
+                const UniquePointer<MountedPackArchive> mountedPackArchive(static_cast<MountedPackArchive*>(opaque));
+
+                {
+                    const std::scoped_lock<std::mutex> lock(mountedPackArchivesMutex);
+                    mountedPackArchives.erase(mountedPackArchive->name);
+                }
+
+                if (mountedPackArchive->io != nullptr)
+                {
+                    mountedPackArchive->io->destroy(mountedPackArchive->io);
+                    mountedPackArchive->io = nullptr;
+                }
+            }
+        }
+
+        [[nodiscard]] auto PackArchive::HashPath(const StringView path) noexcept -> u64
+        {
+            return hash::FNV1a(path);
+        }
+
+        [[nodiscard]] auto PackArchive::IsPackArchive(const Slice<const ubyte> headerBytes) noexcept -> bool
+        {
+            if (headerBytes.size() < sizeof(PackHeader))
+            {
+                return false;
+            }
+
+            PackHeader header{ };
+            std::memcpy(&header, headerBytes.data(), sizeof(PackHeader));
+
+            return header.magic == Magic && header.version == Version;
+        }
+
+        [[nodiscard]] auto PackArchive::Open(const StringView filepath) -> Status
+        {
+            m_ownedBytes.clear();
+
+            if (m_mappedFile.Open(filepath) != Status::Success)
+            {
+                return Status::Fail;
+            }
+
+            m_bytes = m_mappedFile.GetBytes();
+
+            return Initialise();
+        }
+
+        [[nodiscard]] auto PackArchive::Open(List<ubyte>&& archiveBytes) -> Status
+        {
+            m_mappedFile.Close();
+
+            m_ownedBytes = std::move(archiveBytes);
+            m_bytes = Slice<const ubyte>(m_ownedBytes.data(), m_ownedBytes.size());
+
+            return Initialise();
+        }
+
+        [[nodiscard]] auto PackArchive::FindEntry(const StringView path) const -> ObserverPointer<const PackEntry>
+        {
+            if (m_buckets.empty())
+            {
+                return nullptr;
+            }
+
+            const u64 pathHash = HashPath(path);
+            const usize bucketMask = m_buckets.size() - 1u;
+
+            for (usize probeCount = 0u, bucketIndex = static_cast<usize>(pathHash) & bucketMask; probeCount < m_buckets.size(); ++probeCount, bucketIndex = (bucketIndex + 1u) & bucketMask)
+            {
+                const u32 entryIndex = m_buckets[bucketIndex];
+
+                if (entryIndex == EmptyBucket)
+                {
+                    return nullptr;
+                }
+
+                if (const PackEntry& entry = m_entries[entryIndex];
+                    entry.pathHash == pathHash && GetEntryPath(entry) == path)
+                {
+                    return &entry;
+                }
+            }
+
+            return nullptr;
+        }
+
+        [[nodiscard]] auto PackArchive::GetEntryPath(const PackEntry& entry) const -> StringView
+        {
+            return m_stringTable.substr(entry.pathOffset, entry.pathLength);
+        }
+
+        [[nodiscard]] auto PackArchive::GetEntryView(const PackEntry& entry) const -> Optional<Slice<const ubyte>>
+        {
+            if (entry.compression != PackCompression::None)
+            {
+                return None;
+            }
+
+            return m_bytes.subspan(static_cast<usize>(entry.offset), static_cast<usize>(entry.size));
+        }
+
+        [[nodiscard]] auto PackArchive::ReadEntry(const PackEntry& entry, const Slice<ubyte> destination) const -> Status
+        {
+            if (destination.size() != entry.size)
+            {
+                return Status::Fail;
+            }
+
+            const Slice<const ubyte> storedBytes = m_bytes.subspan(static_cast<usize>(entry.offset), static_cast<usize>(entry.storedSize));
+
+            switch (entry.compression)
+            {
+            case PackCompression::None:
+                std::ranges::copy(storedBytes, std::begin(destination));
+
+                return Status::Success;
+
+            case PackCompression::LZ4:
+                return DecompressLZ4Block(storedBytes, destination)
+                    ? Status::Success
+                    : Status::Fail;
+
+            case PackCompression::Zstd:
+            default:
+                return Status::Fail;
+            }
+        }
+
+        [[nodiscard]] auto PackArchive::IsDirectory(const StringView path) const -> bool
+        {
+            return m_directories.contains(String(path));
+        }
+
+        [[nodiscard]] auto PackArchive::GetDirectoryChildren(const StringView path) const -> ObserverPointer<const List<String>>
+        {
+            if (const auto directoryLocation = m_directories.find(String(path));
+                directoryLocation != std::cend(m_directories))
+            {
+                return &directoryLocation->second;
+            }
+
+            return nullptr;
+        }
+
+        [[nodiscard]] auto PackArchive::Initialise() -> Status
+        {
+            m_entries.clear();
+            m_buckets.clear();
+            m_stringTable = StringView{ };
+            m_directories.clear();
+
+            if (!IsPackArchive(m_bytes))
+            {
+                return Status::Fail;
+            }
+
+            PackHeader header{ };
+            std::memcpy(&header, m_bytes.data(), sizeof(PackHeader));
+
+            const auto isRangeValid = [this](const u64 offset, const u64 size) noexcept -> bool
+            {
+                return offset <= m_bytes.size() && size <= m_bytes.size() - offset;
+            };
+
+            if (!isRangeValid(header.entryTableOffset, static_cast<u64>(header.entryCount) * sizeof(PackEntry))
+                || !isRangeValid(header.bucketTableOffset, static_cast<u64>(header.bucketCount) * sizeof(u32))
+                || !isRangeValid(header.stringTableOffset, header.stringTableSize)
+                || (header.bucketCount & (header.bucketCount - 1u)) != 0u
+                || header.bucketCount < header.entryCount)
+            {
+                return Status::Fail;
+            }
+
+            m_entries.resize(header.entryCount);
+            std::memcpy(m_entries.data(), m_bytes.data() + header.entryTableOffset, m_entries.size() * sizeof(PackEntry));
+
+            m_buckets.resize(header.bucketCount);
+            std::memcpy(m_buckets.data(), m_bytes.data() + header.bucketTableOffset, m_buckets.size() * sizeof(u32));
+
+            m_stringTable = StringView(reinterpret_cast<const char*>(m_bytes.data() + header.stringTableOffset), static_cast<usize>(header.stringTableSize));
+
+            for (const u32 entryIndex : m_buckets)
+            {
+                if (entryIndex != EmptyBucket && entryIndex >= header.entryCount)
+                {
+                    return Status::Fail;
+                }
+            }
+
+            m_directories[""] = { };
+            HashSet<String> seenDirectoryChildren{ };
+
+            for (const PackEntry& entry : m_entries)
+            {
+                if (!isRangeValid(entry.offset, entry.storedSize)
+                    || static_cast<u64>(entry.pathOffset) + entry.pathLength > header.stringTableSize
+                    || (entry.compression == PackCompression::None && entry.storedSize != entry.size))
+                {
+                    return Status::Fail;
+                }
+
+                const StringView entryPath = GetEntryPath(entry);
+                usize componentStart = 0u;
+
+                while (componentStart < entryPath.size())
+                {
+                    const usize separatorLocation = entryPath.find('/', componentStart);
+                    const bool isLastComponent = separatorLocation == StringView::npos;
+
+                    const String parentDirectory(entryPath.substr(0u, componentStart == 0u ? 0u : componentStart - 1u));
+                    const String componentName(entryPath.substr(componentStart, isLastComponent ? StringView::npos : separatorLocation - componentStart));
+
+                    if (seenDirectoryChildren.insert(parentDirectory + "/" + componentName).second)
+                    {
+                        m_directories[parentDirectory].push_back(componentName);
+                    }
+
+                    if (isLastComponent)
+                    {
+                        break;
+                    }
+
+                    m_directories.try_emplace(String(entryPath.substr(0u, separatorLocation)));
+                    componentStart = separatorLocation + 1u;
+                }
+            }
+
+            return Status::Success;
+        }
+
+        [[nodiscard]] auto RegisterPackArchiver() -> Status
+        {
+            const PHYSFS_Archiver packArchiver{
+                .version = 0u,
+                .info = PHYSFS_ArchiveInfo{
+                    .extension = "SDPAK",
+                    .description = "Stardust indexed pack archive",
+                    .author = "Stardust",
+                    .url = "",
+                    .supportsSymlinks = 0,
+                },
+                .openArchive = OpenPackArchive,
+                .enumerate = EnumeratePackArchive,
+                .openRead = OpenPackEntryRead,
+                .openWrite = OpenPackEntryWrite,
+                .openAppend = OpenPackEntryWrite,
+                .remove = ModifyPackArchive,
+                .mkdir = ModifyPackArchive,
+                .stat = StatPackEntry,
+                .closeArchive = ClosePackArchive,
+            };
+
+            return PHYSFS_registerArchiver(&packArchiver) != 0
+                ? Status::Success
+                : Status::Fail;
+        }
+
+        [[nodiscard]] auto FindMountedPackArchive(const StringView archiveName) -> ObserverPointer<const PackArchive>
+        {
+            const std::scoped_lock<std::mutex> lock(mountedPackArchivesMutex);
+
+            if (const auto archiveLocation = mountedPackArchives.find(String(archiveName));
+                archiveLocation != std::cend(mountedPackArchives))
+            {
+                return archiveLocation->second;
+            }
+
+            return nullptr;
+        }
+    }
+}
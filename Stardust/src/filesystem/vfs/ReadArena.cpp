@@ -0,0 +1,90 @@
+#include "stardust/filesystem/vfs/ReadArena.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace stardust
+{
+    namespace vfs
+    {
+        ReadArena::ReadArena(const usize blockSize)
+            : m_blockSize(std::max(blockSize, DefaultAlignment))
+        { }
+
+        [[nodiscard]] auto ReadArena::Allocate(const usize size, const usize alignment) -> Slice<ubyte>
+        {
+            if (size == 0u)
+            {
+                return { };
+            }
+
+            for (; m_currentBlockIndex < m_blocks.size(); ++m_currentBlockIndex)
+            {
+                Block& block = m_blocks[m_currentBlockIndex];
+
+                void* allocationPointer = block.data.get() + block.usedSize;
+                usize remainingSize = block.capacity - block.usedSize;
+
+                if (std::align(alignment, size, allocationPointer, remainingSize) != nullptr)
+                {
+                    ubyte* const allocation = static_cast<ubyte*>(allocationPointer);
+                    block.usedSize = static_cast<usize>(allocation - block.data.get()) + size;
+
+                    return Slice<ubyte>(allocation, size);
+                }
+            }
+
+            const usize blockCapacity = std::max(m_blockSize, size + alignment);
+
+            m_blocks.push_back(Block{
+                .data = std::make_unique_for_overwrite<ubyte[]>(blockCapacity),
+                .capacity = blockCapacity,
+                .usedSize = 0u,
+            });
+
+            m_currentBlockIndex = m_blocks.size() - 1u;
+
+            return Allocate(size, alignment);
+        }
+
+        auto ReadArena::Reset() noexcept -> void
+        {
+            for (Block& block : m_blocks)
+            {
+                block.usedSize = 0u;
+            }
+
+            m_currentBlockIndex = 0u;
+        }
+
+        auto ReadArena::Release() noexcept -> void
+        {
+            m_blocks.clear();
+            m_currentBlockIndex = 0u;
+        }
+
+        [[nodiscard]] auto ReadArena::GetCapacity() const noexcept -> usize
+        {
+            usize capacity = 0u;
+
+            for (const Block& block : m_blocks)
+            {
+                capacity += block.capacity;
+            }
+
+            return capacity;
+        }
+
+        [[nodiscard]] auto ReadArena::GetUsedSize() const noexcept -> usize
+        {
+            usize usedSize = 0u;
+
+            for (const Block& block : m_blocks)
+            {
+                usedSize += block.usedSize;
+            }
+
+            return usedSize;
+        }
+    }
+}
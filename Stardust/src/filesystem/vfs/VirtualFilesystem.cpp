@@ -6,15 +6,98 @@
 #include <physfs/physfs.h>
 #include <toml++/toml.h>
 
+#include "stardust/filesystem/vfs/PackArchive.h"
+
 namespace stardust
 {
     namespace vfs
     {
+        namespace
+        {
+            constexpr usize ScratchBufferRetentionLimit = 4'194'304u;
+
+            thread_local List<ubyte> scratchBuffer{ };
+
+            template <typename AcquireDestinationCallback>
+            [[nodiscard]] auto ReadOpenedFile(const StringView filepath, AcquireDestinationCallback&& acquireDestination) -> Result<usize, VirtualFileError>
+            {
+                PHYSFS_File* file = PHYSFS_openRead(filepath.data());
+
+                if (file == nullptr)
+                {
+                    return Error<VirtualFileError>(VirtualFileError::CannotOpenFile);
+                }
+
+                const PHYSFS_sint64 fileLength = PHYSFS_fileLength(file);
+
+                if (fileLength <= 0ll)
+                {
+                    PHYSFS_close(file);
+                    file = nullptr;
+
+                    return Error<VirtualFileError>(VirtualFileError::CannotReadFile);
+                }
+
+                const usize fileSize = static_cast<usize>(fileLength);
+                void* const destination = acquireDestination(fileSize);
+
+                if (destination == nullptr)
+                {
+                    PHYSFS_close(file);
+                    file = nullptr;
+
+                    return Error<VirtualFileError>(VirtualFileError::BufferTooSmall);
+                }
+
+                const PHYSFS_sint64 readByteCount = PHYSFS_readBytes(file, destination, static_cast<PHYSFS_uint64>(fileSize));
+
+                PHYSFS_close(file);
+                file = nullptr;
+
+                if (readByteCount != fileLength)
+                {
+                    return Error<VirtualFileError>(VirtualFileError::CannotReadFile);
+                }
+
+                return Ok<usize>(static_cast<usize>(fileLength));
+            }
+
+            template <typename T>
+            [[nodiscard]] auto ParseFileBytes(const StringView filepath, auto (*parser)(const Slice<const ubyte>) -> Result<T, VirtualFileError>) -> Result<T, VirtualFileError>
+            {
+                if (const Optional<Slice<const ubyte>> fileView = GetFileView(filepath);
+                    fileView.has_value())
+                {
+                    return parser(fileView.value());
+                }
+
+                List<ubyte> fileBytes = std::move(scratchBuffer);
+                auto readResult = ReadFileBytes(filepath, fileBytes);
+
+                if (readResult.is_err())
+                {
+                    return Error<VirtualFileError>(std::move(readResult).unwrap_err());
+                }
+
+                Result<T, VirtualFileError> parseResult = parser(std::move(readResult).unwrap());
+
+                if (fileBytes.capacity() <= ScratchBufferRetentionLimit)
+                {
+                    scratchBuffer = std::move(fileBytes);
+                }
+
+                return parseResult;
+            }
+        }
+
         [[nodiscard]] auto Initialise(const char* argv0) -> Status
         {
-            return PHYSFS_init(argv0) != 0
-                ? Status::Success
-                : Status::Fail;
+            if (PHYSFS_init(argv0) == 0)
+            {
+                return Status::Fail;
+            }
+
+            return RegisterPackArchiver();
         }
 
         auto Quit() -> void
@@ -265,84 +348,162 @@ namespace stardust
             return fileStats.filetype == PHYSFS_FileType::PHYSFS_FILETYPE_DIRECTORY;
         }
 
-        [[nodiscard]] auto ReadFileBytes(const StringView filepath) -> Result<List<ubyte>, VirtualFileError>
+        [[nodiscard]] auto IsInPackArchive(const StringView filepath) -> bool
         {
-            PHYSFS_File* file = PHYSFS_openRead(filepath.data());
+            const char* const archiveName = PHYSFS_getRealDir(filepath.data());
 
-            if (file == nullptr)
+            if (archiveName == nullptr)
             {
-                return Error<VirtualFileError>(VirtualFileError::CannotOpenFile);
+                return false;
             }
 
-            const usize fileSize = GetFileSize(filepath);
+            const ObserverPointer<const PackArchive> packArchive = FindMountedPackArchive(archiveName);
+
+            return packArchive != nullptr && packArchive->FindEntry(filepath) != nullptr;
+        }
+
+        [[nodiscard]] auto GetFileView(const StringView filepath) -> Optional<Slice<const ubyte>>
+        {
+            const char* const archiveName = PHYSFS_getRealDir(filepath.data());
 
-            if (fileSize == 0u)
+            if (archiveName == nullptr)
             {
-                return Error<VirtualFileError>(VirtualFileError::CannotReadFile);
+                return None;
             }
 
-            List<ubyte> fileBytes(fileSize);
+            const ObserverPointer<const PackArchive> packArchive = FindMountedPackArchive(archiveName);
 
-            if (PHYSFS_readBytes(file, fileBytes.data(), fileSize) == -1ll)
+            if (packArchive == nullptr)
             {
-                PHYSFS_close(file);
-                file = nullptr;
+                return None;
+            }
 
-                return Error<VirtualFileError>(VirtualFileError::CannotReadFile);
+            if (const ObserverPointer<const PackEntry> entry = packArchive->FindEntry(filepath);
+                entry != nullptr)
+            {
+                return packArchive->GetEntryView(*entry);
             }
 
-            PHYSFS_close(file);
-            file = nullptr;
+            return None;
+        }
+
+        [[nodiscard]] auto ReadFileBytes(const StringView filepath) -> Result<List<ubyte>, VirtualFileError>
+        {
+            List<ubyte> fileBytes{ };
+
+            if (auto readResult = ReadFileBytes(filepath, fileBytes);
+                readResult.is_err())
+            {
+                return Error<VirtualFileError>(std::move(readResult).unwrap_err());
+            }
 
             return Ok<List<ubyte>>(std::move(fileBytes));
         }
 
-        [[nodiscard]] auto ReadFileString(const StringView filepath) -> Result<String, VirtualFileError>
+        [[nodiscard]] auto ReadFileBytes(const StringView filepath, List<ubyte>& buffer) -> Result<Slice<const ubyte>, VirtualFileError>
         {
-            PHYSFS_File* file = PHYSFS_openRead(filepath.data());
+            auto readResult = ReadOpenedFile(
+                filepath,
+                [&buffer](const usize fileSize) -> void*
+                {
+                    buffer.resize(fileSize);
+
+                    return buffer.data();
+                }
+            );
 
-            if (file == nullptr)
+            if (readResult.is_err())
             {
-                return Error<VirtualFileError>(VirtualFileError::CannotOpenFile);
+                buffer.clear();
+
+                return Error<VirtualFileError>(std::move(readResult).unwrap_err());
             }
 
-            const usize fileSize = GetFileSize(filepath);
+            return Ok<Slice<const ubyte>>(Slice<const ubyte>(buffer.data(), buffer.size()));
+        }
+
+        [[nodiscard]] auto ReadFileBytes(const StringView filepath, ReadArena& arena) -> Result<Slice<const ubyte>, VirtualFileError>
+        {
+            Slice<ubyte> allocation{ };
+
+            auto readResult = ReadOpenedFile(
+                filepath,
+                [&arena, &allocation](const usize fileSize) -> void*
+                {
+                    allocation = arena.Allocate(fileSize);
+
+                    return allocation.data();
+                }
+            );
 
-            if (fileSize == 0u)
+            if (readResult.is_err())
             {
-                return Error<VirtualFileError>(VirtualFileError::CannotReadFile);
+                return Error<VirtualFileError>(std::move(readResult).unwrap_err());
             }
 
-            String fileString(fileSize, '\0');
+            return Ok<Slice<const ubyte>>(Slice<const ubyte>(allocation.data(), allocation.size()));
+        }
 
-            if (PHYSFS_readBytes(file, fileString.data(), fileSize) == -1ll)
-            {
-                PHYSFS_close(file);
-                file = nullptr;
+        [[nodiscard]] auto ReadFileBytesInto(const StringView filepath, const Slice<ubyte> destination) -> Result<usize, VirtualFileError>
+        {
+            return ReadOpenedFile(
+                filepath,
+                [destination](const usize fileSize) -> void*
+                {
+                    return fileSize <= destination.size()
+                        ? destination.data()
+                        : nullptr;
+                }
+            );
+        }
 
-                return Error<VirtualFileError>(VirtualFileError::CannotReadFile);
-            }
+        [[nodiscard]] auto ReadFileString(const StringView filepath) -> Result<String, VirtualFileError>
+        {
+            String fileString{ };
+
+            auto readResult = ReadOpenedFile(
+                filepath,
+                [&fileString](const usize fileSize) -> void*
+                {
+                    fileString.resize(fileSize, '\0');
+
+                    return fileString.data();
+                }
+            );
 
-            PHYSFS_close(file);
-            file = nullptr;
+            if (readResult.is_err())
+            {
+                return Error<VirtualFileError>(std::move(readResult).unwrap_err());
+            }
 
             return Ok<String>(std::move(fileString));
         }
 
         [[nodiscard]] auto ReadJSON(const StringView filepath) -> Result<JSON, VirtualFileError>
         {
-            auto fileDataResult = ReadFileBytes(filepath);
+            return ParseFileBytes(filepath, ParseJSON);
+        }
 
-            if (fileDataResult.is_err())
-            {
-                return Error<VirtualFileError>(std::move(fileDataResult).unwrap_err());
-            }
+        [[nodiscard]] auto ReadMessagePack(const StringView filepath) -> Result<JSON, VirtualFileError>
+        {
+            return ParseFileBytes(filepath, ParseMessagePack);
+        }
 
-            List<ubyte> fileData = std::move(fileDataResult).unwrap();
+        [[nodiscard]] auto ReadTOML(const StringView filepath) -> Result<TOML, VirtualFileError>
+        {
+            return ParseFileBytes(filepath, ParseTOML);
+        }
 
+        [[nodiscard]] auto ReadXML(const StringView filepath) -> Result<XML, VirtualFileError>
+        {
+            return ParseFileBytes(filepath, ParseXML);
+        }
+
+        [[nodiscard]] auto ParseJSON(const Slice<const ubyte> bytes) -> Result<JSON, VirtualFileError>
+        {
             JSON jsonData = JSON::parse(
-                reinterpret_cast<const u8*>(fileData.data()),
-                reinterpret_cast<const u8*>(fileData.data()) + fileData.size(),
+                reinterpret_cast<const u8*>(bytes.data()),
+                reinterpret_cast<const u8*>(bytes.data()) + bytes.size(),
                 nullptr,
                 false
             );
@@ -355,16 +516,9 @@ namespace stardust
             return Ok<JSON>(std::move(jsonData));
         }
 
-        [[nodiscard]] auto ReadMessagePack(const StringView filepath) -> Result<JSON, VirtualFileError>
+        [[nodiscard]] auto ParseMessagePack(const Slice<const ubyte> bytes) -> Result<JSON, VirtualFileError>
         {
-            auto fileReadResult = ReadFileBytes(filepath);
-
-            if (fileReadResult.is_err())
-            {
-                return Error<VirtualFileError>(std::move(fileReadResult).unwrap_err());
-            }
-
-            JSON messagePackAsJSON = JSON::from_msgpack(std::move(fileReadResult).unwrap(), false, false);
+            JSON messagePackAsJSON = JSON::from_msgpack(bytes.begin(), bytes.end(), false, false);
 
             if (messagePackAsJSON.is_discarded())
             {
@@ -374,19 +528,11 @@ namespace stardust
             return Ok<JSON>(std::move(messagePackAsJSON));
         }
 
-        [[nodiscard]] auto ReadTOML(const StringView filepath) -> Result<TOML, VirtualFileError>
+        [[nodiscard]] auto ParseTOML(const Slice<const ubyte> bytes) -> Result<TOML, VirtualFileError>
         {
             try
             {
-                auto tomlStringResult = ReadFileString(filepath);
-
-                if (tomlStringResult.is_err())
-                {
-                    return Error<VirtualFileError>(std::move(tomlStringResult).unwrap_err());
-                }
-
-                const String tomlString = std::move(tomlStringResult).unwrap();
-                TOML tomlData = toml::parse(tomlString);
+                TOML tomlData = toml::parse(StringView(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
 
                 return Ok<TOML>(std::move(tomlData));
             }
@@ -396,19 +542,10 @@ namespace stardust
             }
         }
 
-        [[nodiscard]] auto ReadXML(const StringView filepath) -> Result<XML, VirtualFileError>
+        [[nodiscard]] auto ParseXML(const Slice<const ubyte> bytes) -> Result<XML, VirtualFileError>
         {
-            auto fileReadResult = ReadFileBytes(filepath);
-
-            if (fileReadResult.is_err())
-            {
-                return Error<VirtualFileError>(std::move(fileReadResult).unwrap_err());
-            }
-
-            const List<ubyte> xmlBuffer = std::move(fileReadResult).unwrap();
-
             XML xmlDocument;
-            const pugi::xml_parse_result parseResult = xmlDocument.load_buffer(xmlBuffer.data(), xmlBuffer.size());
+            const pugi::xml_parse_result parseResult = xmlDocument.load_buffer(bytes.data(), bytes.size());
 
             switch (parseResult.status)
             {
@@ -445,5 +582,22 @@ namespace stardust
 
             return static_cast<usize>(fileStats.filesize);
         }
+
+        [[nodiscard]] auto GetLastModifiedTime(const StringView filepath) -> Optional<i64>
+        {
+            PHYSFS_Stat fileStats{ };
+
+            if (PHYSFS_isInit() == 0)
+            {
+                return None;
+            }
+
+            if (PHYSFS_stat(filepath.data(), &fileStats) == 0 || fileStats.modtime < 0)
+            {
+                return None;
+            }
+
+            return static_cast<i64>(fileStats.modtime);
+        }
     }
 }
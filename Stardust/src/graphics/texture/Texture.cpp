@@ -81,11 +81,60 @@ namespace stardust
             glActiveTexture(GL_TEXTURE0);
         }
 
+        [[nodiscard]] auto Texture::DecodeImageFile(const StringView filepath) -> Optional<DecodedImage>
+        {
+            auto textureFileDataResult = vfs::ReadFileBytes(filepath);
+
+            if (textureFileDataResult.is_err())
+            {
+                return None;
+            }
+
+            const List<ubyte> textureFileData = std::move(textureFileDataResult).unwrap();
+
+            i32 width = 0;
+            i32 height = 0;
+            i32 componentCount = 0;
+
+            stbi_uc* textureData = stbi_load_from_memory(
+                reinterpret_cast<const stbi_uc*>(textureFileData.data()),
+                static_cast<i32>(textureFileData.size()),
+                &width,
+                &height,
+                &componentCount,
+                STBI_default
+            );
+
+            if (textureData == nullptr)
+            {
+                return None;
+            }
+
+            const usize pixelByteCount = static_cast<usize>(width) * static_cast<usize>(height) * static_cast<usize>(componentCount);
+            const ubyte* const pixelData = reinterpret_cast<const ubyte*>(textureData);
+
+            DecodedImage decodedImage{
+                .pixels = List<ubyte>(pixelData, pixelData + pixelByteCount),
+                .extent = UVector2{ static_cast<u32>(width), static_cast<u32>(height) },
+                .channelCount = static_cast<u32>(componentCount),
+            };
+
+            stbi_image_free(textureData);
+            textureData = nullptr;
+
+            return decodedImage;
+        }
+
         Texture::Texture(const StringView filepath, const Sampler& sampler)
         {
             Initialise(filepath, sampler);
         }
 
+        Texture::Texture(const DecodedImage& decodedImage, const Sampler& sampler)
+        {
+            Initialise(decodedImage, sampler);
+        }
+
         Texture::Texture(const UVector2 extent, const u32 channelCount, const Sampler& sampler)
         {
             Initialise(extent, channelCount, sampler);
@@ -132,6 +181,16 @@ namespace stardust
             m_isValid = LoadFromImageFile(filepath, sampler) == Status::Success;
         }
 
+        auto Texture::Initialise(const DecodedImage& decodedImage, const Sampler& sampler) -> void
+        {
+            if (!s_componentMap.contains(decodedImage.channelCount))
+            {
+                return;
+            }
+
+            Initialise(decodedImage.pixels.data(), decodedImage.extent, decodedImage.channelCount, sampler);
+        }
+
         auto Texture::Initialise(const UVector2 extent, const u32 channelCount, const Sampler& sampler) -> void
         {
             Initialise(nullptr, extent, channelCount, sampler);
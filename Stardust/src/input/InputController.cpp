@@ -1,5 +1,7 @@
 #include "stardust/input/InputController.h"
 
+#include <limits>
+#include <string>
 #include <utility>
 
 #include <SDL2/SDL.h>
@@ -8,6 +10,38 @@
 
 namespace stardust
 {
+    namespace
+    {
+        [[nodiscard]] auto CreateVirtualGameControllerMapping(const SDL_JoystickGUID guid) -> String
+        {
+            Array<char, 33u> guidString{ };
+            SDL_JoystickGetGUIDString(guid, guidString.data(), static_cast<i32>(guidString.size()));
+
+            String mapping = String(guidString.data()) + ",Stardust Replay Controller,";
+
+            for (i32 button = 0; button < SDL_CONTROLLER_BUTTON_MAX; ++button)
+            {
+                mapping += SDL_GameControllerGetStringForButton(static_cast<SDL_GameControllerButton>(button));
+                mapping += ":b" + std::to_string(button) + ",";
+            }
+
+            for (i32 axis = 0; axis < SDL_CONTROLLER_AXIS_MAX; ++axis)
+            {
+                const bool isTrigger = axis == SDL_CONTROLLER_AXIS_TRIGGERLEFT || axis == SDL_CONTROLLER_AXIS_TRIGGERRIGHT;
+
+                mapping += SDL_GameControllerGetStringForAxis(static_cast<SDL_GameControllerAxis>(axis));
+                mapping += (isTrigger ? ":+a" : ":a") + std::to_string(axis) + ",";
+            }
+
+            return mapping;
+        }
+    }
+
+    InputController::~InputController() noexcept
+    {
+        DetachVirtualGameControllers();
+    }
+
     [[nodiscard]] auto InputController::LoadGameControllerDatabase(const StringView gameControllerDatabasePath) -> Status
     {
         auto gameControllerDatabaseResult = vfs::ReadFileBytes(gameControllerDatabasePath);
@@ -45,9 +79,260 @@ namespace stardust
 
     auto InputController::Update() -> void
     {
-        m_keyboardState.Update();
-        m_mouseState.Update();
+        if (m_isReplaying)
+        {
+            ApplyReplayFrame();
+        }
+        else
+        {
+            m_keyboardState.Update();
+            m_mouseState.Update();
+        }
+
         m_gameControllerLobby.Update(*this);
         m_joystickLobby.Update(*this);
+
+        if (m_isRecording)
+        {
+            CaptureRecordingFrame();
+        }
+    }
+
+    auto InputController::EndFrame(const f64 deltaTime) -> void
+    {
+        if (m_isRecording)
+        {
+            m_recordingFrame.deltaTime = deltaTime;
+            m_recording.AddFrame(std::move(m_recordingFrame));
+            m_recordingFrame = InputRecording::Frame{ };
+        }
+
+        if (m_isReplaying && !HasReplayFinished())
+        {
+            ++m_replayFrameIndex;
+        }
+    }
+
+    auto InputController::StartRecording() -> void
+    {
+        m_recording.Clear();
+        m_recordingFrame = InputRecording::Frame{ };
+        m_recordedKeyStates.assign(SDL_NUM_SCANCODES, SDL_FALSE);
+        m_recordedGameControllerIndices.clear();
+
+        m_isRecording = true;
+    }
+
+    [[nodiscard]] auto InputController::StopRecording() -> InputRecording
+    {
+        m_isRecording = false;
+
+        return std::exchange(m_recording, InputRecording{ });
+    }
+
+    auto InputController::RecordEvent(const SDL_Event& event) -> void
+    {
+        if (m_isRecording && InputRecording::IsRecordableEvent(event))
+        {
+            m_recordingFrame.events.push_back(event);
+        }
+    }
+
+    [[nodiscard]] auto InputController::StartReplay(InputRecording&& recording) -> Status
+    {
+        StopReplay();
+
+        m_replay = std::move(recording);
+        m_replayFrameIndex = 0u;
+        m_replayKeyStates.assign(SDL_NUM_SCANCODES, SDL_FALSE);
+
+        if (AttachVirtualGameControllers() != Status::Success)
+        {
+            m_replay.Clear();
+
+            return Status::Fail;
+        }
+
+        m_isReplaying = true;
+
+        return Status::Success;
+    }
+
+    auto InputController::StopReplay() -> void
+    {
+        DetachVirtualGameControllers();
+
+        m_isReplaying = false;
+        m_replay.Clear();
+        m_replayFrameIndex = 0u;
+    }
+
+    [[nodiscard]] auto InputController::GetReplayEvents() const -> const List<SDL_Event>&
+    {
+        static const List<SDL_Event> noEvents{ };
+
+        if (!m_isReplaying || HasReplayFinished())
+        {
+            return noEvents;
+        }
+
+        return m_replay.GetFrames()[m_replayFrameIndex].events;
+    }
+
+    [[nodiscard]] auto InputController::GetReplayDeltaTime() const -> Optional<f64>
+    {
+        if (!m_isReplaying || HasReplayFinished())
+        {
+            return None;
+        }
+
+        return m_replay.GetFrames()[m_replayFrameIndex].deltaTime;
+    }
+
+    auto InputController::CaptureRecordingFrame() -> void
+    {
+        const List<u8>& keyStates = m_keyboardState.GetKeyStates();
+
+        for (u16 scancode = 0u; scancode < static_cast<u16>(SDL_NUM_SCANCODES); ++scancode)
+        {
+            if (keyStates[scancode] != m_recordedKeyStates[scancode])
+            {
+                m_recordingFrame.toggledKeys.push_back(scancode);
+                m_recordedKeyStates[scancode] = keyStates[scancode];
+            }
+        }
+
+        m_recordingFrame.mouseButtonState = m_mouseState.GetButtonState();
+        m_recordingFrame.mouseCoordinates = m_mouseState.GetCoordinates();
+
+        for (const auto& [instanceID, gameController] : m_gameControllerLobby.GetGameControllers())
+        {
+            const auto [controllerIndexLocation, wasInserted] = m_recordedGameControllerIndices.try_emplace(
+                instanceID,
+                static_cast<InputRecording::ControllerIndex>(m_recordedGameControllerIndices.size())
+            );
+
+            if (wasInserted && m_recordedGameControllerIndices.size() > static_cast<usize>(std::numeric_limits<InputRecording::ControllerIndex>::max()) + 1u)
+            {
+                m_recordedGameControllerIndices.erase(controllerIndexLocation);
+
+                continue;
+            }
+
+            InputRecording::GameControllerFrame gameControllerFrame{
+                .controllerIndex = controllerIndexLocation->second,
+                .buttonState = 0u,
+                .axisValues = { },
+            };
+
+            for (i32 button = 0; button < SDL_CONTROLLER_BUTTON_MAX; ++button)
+            {
+                if (SDL_GameControllerGetButton(gameController.GetRawHandle(), static_cast<SDL_GameControllerButton>(button)) != 0u)
+                {
+                    gameControllerFrame.buttonState |= 1u << static_cast<u32>(button);
+                }
+            }
+
+            for (i32 axis = 0; axis < SDL_CONTROLLER_AXIS_MAX; ++axis)
+            {
+                gameControllerFrame.axisValues[axis] = SDL_GameControllerGetAxis(gameController.GetRawHandle(), static_cast<SDL_GameControllerAxis>(axis));
+            }
+
+            m_recordingFrame.gameControllers.push_back(gameControllerFrame);
+        }
+    }
+
+    auto InputController::ApplyReplayFrame() -> void
+    {
+        if (HasReplayFinished())
+        {
+            m_keyboardState.Update(m_replayKeyStates);
+            m_mouseState.Update(m_mouseState.GetButtonState(), m_mouseState.GetCoordinates());
+
+            return;
+        }
+
+        const InputRecording::Frame& frame = m_replay.GetFrames()[m_replayFrameIndex];
+
+        for (const u16 toggledKey : frame.toggledKeys)
+        {
+            m_replayKeyStates[toggledKey] = m_replayKeyStates[toggledKey] == SDL_FALSE ? SDL_TRUE : SDL_FALSE;
+        }
+
+        m_keyboardState.Update(m_replayKeyStates);
+        m_mouseState.Update(frame.mouseButtonState, frame.mouseCoordinates);
+
+        for (const InputRecording::GameControllerFrame& gameControllerFrame : frame.gameControllers)
+        {
+            const ObserverPointer<SDL_Joystick> virtualGameController = m_virtualGameControllers[gameControllerFrame.controllerIndex];
+
+            for (i32 button = 0; button < SDL_CONTROLLER_BUTTON_MAX; ++button)
+            {
+                const bool isButtonDown = (gameControllerFrame.buttonState & (1u << static_cast<u32>(button))) != 0u;
+                SDL_JoystickSetVirtualButton(virtualGameController, button, isButtonDown ? SDL_PRESSED : SDL_RELEASED);
+            }
+
+            for (i32 axis = 0; axis < SDL_CONTROLLER_AXIS_MAX; ++axis)
+            {
+                SDL_JoystickSetVirtualAxis(virtualGameController, axis, gameControllerFrame.axisValues[axis]);
+            }
+        }
+
+        if (!frame.gameControllers.empty())
+        {
+            SDL_JoystickUpdate();
+        }
+    }
+
+    [[nodiscard]] auto InputController::AttachVirtualGameControllers() -> Status
+    {
+        for (u32 i = 0u; i < m_replay.GetGameControllerCount(); ++i)
+        {
+            const i32 deviceIndex = SDL_JoystickAttachVirtual(SDL_JOYSTICK_TYPE_GAMECONTROLLER, SDL_CONTROLLER_AXIS_MAX, SDL_CONTROLLER_BUTTON_MAX, 0);
+
+            if (deviceIndex < 0)
+            {
+                DetachVirtualGameControllers();
+
+                return Status::Fail;
+            }
+
+            SDL_GameControllerAddMapping(CreateVirtualGameControllerMapping(SDL_JoystickGetDeviceGUID(deviceIndex)).c_str());
+
+            const ObserverPointer<SDL_Joystick> virtualGameController = SDL_JoystickOpen(deviceIndex);
+
+            if (virtualGameController == nullptr)
+            {
+                SDL_JoystickDetachVirtual(deviceIndex);
+                DetachVirtualGameControllers();
+
+                return Status::Fail;
+            }
+
+            m_virtualGameControllers.push_back(virtualGameController);
+        }
+
+        return Status::Success;
+    }
+
+    auto InputController::DetachVirtualGameControllers() -> void
+    {
+        for (const ObserverPointer<SDL_Joystick> virtualGameController : m_virtualGameControllers)
+        {
+            const SDL_JoystickID instanceID = SDL_JoystickInstanceID(virtualGameController);
+            SDL_JoystickClose(virtualGameController);
+
+            for (i32 deviceIndex = 0; deviceIndex < SDL_NumJoysticks(); ++deviceIndex)
+            {
+                if (SDL_JoystickGetDeviceInstanceID(deviceIndex) == instanceID)
+                {
+                    SDL_JoystickDetachVirtual(deviceIndex);
+
+                    break;
+                }
+            }
+        }
+
+        m_virtualGameControllers.clear();
     }
 }
@@ -14,11 +14,98 @@ namespace stardust
         m_inputController = &inputController;
     }
 
+    auto InputManager::Update() -> void
+    {
+        if (m_isActionMapDirty)
+        {
+            RebindActions();
+        }
+
+        m_connectedGameControllers.clear();
+        m_connectedJoysticks.clear();
+
+        for (const auto& [instanceID, gameController] : m_inputController->GetGameControllerLobby().GetGameControllers())
+        {
+            m_connectedGameControllers.push_back(&gameController);
+        }
+
+        for (const auto& [instanceID, joystick] : m_inputController->GetJoystickLobby().GetJoystickss())
+        {
+            m_connectedJoysticks.push_back(&joystick);
+        }
+
+        for (usize i = 0u; i < m_buttonActions.size(); ++i)
+        {
+            const ObserverPointer<const ButtonInput> buttonInput = m_buttonActions[i].input;
+
+            if (buttonInput == nullptr)
+            {
+                m_buttonDownStates[i] = false;
+                m_buttonPressedStates[i] = false;
+                m_buttonUpStates[i] = false;
+
+                continue;
+            }
+
+            m_buttonDownStates[i] = IsButtonInputDown(*buttonInput, m_connectedGameControllers, m_connectedJoysticks);
+            m_buttonPressedStates[i] = IsButtonInputPressed(*buttonInput, m_connectedGameControllers, m_connectedJoysticks);
+            m_buttonUpStates[i] = IsButtonInputUp(*buttonInput, m_connectedGameControllers, m_connectedJoysticks);
+        }
+
+        for (usize i = 0u; i < m_axisActions.size(); ++i)
+        {
+            const ObserverPointer<const AxisInput> axisInput = m_axisActions[i].input;
+
+            m_axisValues[i] = axisInput != nullptr ? GetAxisInputValue(*axisInput, m_connectedGameControllers, m_connectedJoysticks) : 0.0f;
+        }
+    }
+
+    [[nodiscard]] auto InputManager::GetButtonID(const String& buttonName) -> ActionID
+    {
+        const auto [buttonIDLocation, wasInserted] = m_buttonIDs.try_emplace(buttonName, static_cast<ActionID>(m_buttonActions.size()));
+
+        if (wasInserted)
+        {
+            const auto buttonLocation = m_buttons.find(buttonName);
+
+            m_buttonActions.push_back(Action<ButtonInput>{
+                .name = buttonName,
+                .input = buttonLocation != std::cend(m_buttons) ? &buttonLocation->second : nullptr,
+            });
+
+            m_buttonDownStates.push_back(false);
+            m_buttonPressedStates.push_back(false);
+            m_buttonUpStates.push_back(false);
+        }
+
+        return buttonIDLocation->second;
+    }
+
+    [[nodiscard]] auto InputManager::GetAxisID(const String& axisName) -> ActionID
+    {
+        const auto [axisIDLocation, wasInserted] = m_axisIDs.try_emplace(axisName, static_cast<ActionID>(m_axisActions.size()));
+
+        if (wasInserted)
+        {
+            const auto axisLocation = m_axes.find(axisName);
+
+            m_axisActions.push_back(Action<AxisInput>{
+                .name = axisName,
+                .input = axisLocation != std::cend(m_axes) ? &axisLocation->second : nullptr,
+            });
+
+            m_axisValues.push_back(0.0f);
+        }
+
+        return axisIDLocation->second;
+    }
+
     auto InputManager::AddKeyToButton(const String& buttonName, const KeyCode key) -> void
     {
         if (!m_buttons.contains(buttonName))
         {
             m_buttons[buttonName].keys = { };
+            m_isActionMapDirty = true;
         }
 
         m_buttons[buttonName].keys.insert(key);
@@ -29,6 +116,7 @@ namespace stardust
         if (!m_buttons.contains(buttonName))
         {
             m_buttons[buttonName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_buttons[buttonName].mouseButtons.insert(button);
@@ -39,6 +127,7 @@ namespace stardust
         if (!m_buttons.contains(buttonName))
         {
             m_buttons[buttonName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_buttons[buttonName].gameControllerButtons.insert(button);
@@ -49,6 +138,7 @@ namespace stardust
         if (!m_buttons.contains(buttonName))
         {
             m_buttons[buttonName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_buttons[buttonName].gameControllerTriggers.insert(trigger);
@@ -59,6 +149,7 @@ namespace stardust
         if (!m_buttons.contains(buttonName))
         {
             m_buttons[buttonName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_buttons[buttonName].joystickButtons.insert(button);
@@ -69,6 +160,7 @@ namespace stardust
         if (!m_buttons.contains(buttonName))
         {
             m_buttons[buttonName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_buttons[buttonName].joystickAxes.insert(axis);
@@ -79,6 +171,7 @@ namespace stardust
         if (!m_buttons.contains(buttonName))
         {
             m_buttons[buttonName] = { };
+            m_isActionMapDirty = true;
         }
 
         if (!m_buttons[buttonName].joystickHatSwitchDirections.contains(hatSwitch))
@@ -156,11 +249,13 @@ namespace stardust
     auto InputManager::RemoveButton(const String& buttonName) -> void
     {
         m_buttons.erase(buttonName);
+        m_isActionMapDirty = true;
     }
 
     auto InputManager::ClearAllButtons() -> void
     {
         m_buttons.clear();
+        m_isActionMapDirty = true;
     }
 
     [[nodiscard]] auto InputManager::HasButton(const String& buttonName) -> bool
@@ -170,272 +265,23 @@ namespace stardust
 
     [[nodiscard]] auto InputManager::IsButtonDown(const String& buttonName, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool
     {
-        if (m_buttons.contains(buttonName))
-        {
-            const auto& buttons = m_buttons.at(buttonName);
-
-            for (const auto key : buttons.keys)
-            {
-                if (m_inputController->GetKeyboardState().IsKeyDown(key))
-                {
-                    return true;
-                }
-            }
-
-            for (const auto mouseButton : buttons.mouseButtons)
-            {
-                if (m_inputController->GetMouseState().IsButtonDown(mouseButton))
-                {
-                    return true;
-                }
-            }
+        const auto buttonLocation = m_buttons.find(buttonName);
 
-            for (const auto& gameController : gameControllers)
-            {
-                if (gameController == nullptr) [[unlikely]]
-                {
-                    continue;
-                }
-
-                for (const auto gameControllerButton : buttons.gameControllerButtons)
-                {
-                    if (gameController->IsButtonDown(gameControllerButton))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto gameControllerTrigger : buttons.gameControllerTriggers)
-                {
-                    if (gameController->IsTriggerDown(gameControllerTrigger))
-                    {
-                        return true;
-                    }
-                }
-            }
-
-            for (const auto& joystick : joysticks)
-            {
-                if (joystick == nullptr) [[unlikely]]
-                {
-                    continue;
-                }
-
-                for (const auto joystickButton : buttons.joystickButtons)
-                {
-                    if (joystick->HasButton(joystickButton) && joystick->IsButtonDown(joystickButton))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto joystickAxis : buttons.joystickAxes)
-                {
-                    if (joystick->HasAxis(joystickAxis) && joystick->IsAxisDown(joystickAxis))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto& [joystickHatSwitch, hatSwitchDirections] : buttons.joystickHatSwitchDirections)
-                {
-                    if (!joystick->HasHatSwitch(joystickHatSwitch))
-                    {
-                        continue;
-                    }
-
-                    for (const auto hatSwitchDirection : hatSwitchDirections)
-                    {
-                        if (joystick->WasHatSwitchMoved(joystickHatSwitch, hatSwitchDirection))
-                        {
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
-
-        return false;
+        return buttonLocation != std::cend(m_buttons) && IsButtonInputDown(buttonLocation->second, gameControllers, joysticks);
     }
 
     [[nodiscard]] auto InputManager::IsButtonPressed(const String& buttonName, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool
     {
-        if (m_buttons.contains(buttonName))
-        {
-            const auto& buttons = m_buttons.at(buttonName);
-
-            for (const auto key : buttons.keys)
-            {
-                if (m_inputController->GetKeyboardState().IsKeyPressed(key))
-                {
-                    return true;
-                }
-            }
+        const auto buttonLocation = m_buttons.find(buttonName);
 
-            for (const auto mouseButton : buttons.mouseButtons)
-            {
-                if (m_inputController->GetMouseState().IsButtonPressed(mouseButton))
-                {
-                    return true;
-                }
-            }
-
-            for (const auto& gameController : gameControllers)
-            {
-                if (gameController == nullptr) [[unlikely]]
-                {
-                    continue;
-                }
-
-                for (const auto gameControllerButton : buttons.gameControllerButtons)
-                {
-                    if (gameController->IsButtonPressed(gameControllerButton))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto gameControllerTrigger : buttons.gameControllerTriggers)
-                {
-                    if (gameController->IsTriggerPressed(gameControllerTrigger))
-                    {
-                        return true;
-                    }
-                }
-            }
-
-            for (const auto& joystick : joysticks)
-            {
-                if (joystick == nullptr) [[unlikely]]
-                {
-                    continue;
-                }
-
-                for (const auto joystickButton : buttons.joystickButtons)
-                {
-                    if (joystick->HasButton(joystickButton) && joystick->IsButtonPressed(joystickButton))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto joystickAxis : buttons.joystickAxes)
-                {
-                    if (joystick->HasAxis(joystickAxis) && joystick->IsAxisPressed(joystickAxis))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto& [joystickHatSwitch, hatSwitchDirections] : buttons.joystickHatSwitchDirections)
-                {
-                    if (!joystick->HasHatSwitch(joystickHatSwitch))
-                    {
-                        continue;
-                    }
-
-                    for (const auto hatSwitchDirection : hatSwitchDirections)
-                    {
-                        if (joystick->IsHatSwitchMoved(joystickHatSwitch, hatSwitchDirection))
-                        {
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
-
-        return false;
+        return buttonLocation != std::cend(m_buttons) && IsButtonInputPressed(buttonLocation->second, gameControllers, joysticks);
     }
 
     [[nodiscard]] auto InputManager::IsButtonUp(const String& buttonName, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool
     {
-        if (m_buttons.contains(buttonName))
-        {
-            const auto& buttons = m_buttons.at(buttonName);
-
-            for (const auto key : buttons.keys)
-            {
-                if (m_inputController->GetKeyboardState().IsKeyUp(key))
-                {
-                    return true;
-                }
-            }
+        const auto buttonLocation = m_buttons.find(buttonName);
 
-            for (const auto mouseButton : buttons.mouseButtons)
-            {
-                if (m_inputController->GetMouseState().IsButtonUp(mouseButton))
-                {
-                    return true;
-                }
-            }
-
-            for (const auto& gameController : gameControllers)
-            {
-                if (gameController == nullptr) [[unlikely]]
-                {
-                    continue;
-                }
-
-                for (const auto gameControllerButton : buttons.gameControllerButtons)
-                {
-                    if (gameController->IsButtonUp(gameControllerButton))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto gameControllerTrigger : buttons.gameControllerTriggers)
-                {
-                    if (gameController->IsTriggerUp(gameControllerTrigger))
-                    {
-                        return true;
-                    }
-                }
-            }
-
-            for (const auto& joystick : joysticks)
-            {
-                if (joystick == nullptr) [[unlikely]]
-                {
-                    continue;
-                }
-
-                for (const auto joystickButton : buttons.joystickButtons)
-                {
-                    if (joystick->HasButton(joystickButton) && joystick->IsButtonUp(joystickButton))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto joystickAxis : buttons.joystickAxes)
-                {
-                    if (joystick->HasAxis(joystickAxis) && joystick->IsAxisUp(joystickAxis))
-                    {
-                        return true;
-                    }
-                }
-
-                for (const auto& [joystickHatSwitch, hatSwitchDirections] : buttons.joystickHatSwitchDirections)
-                {
-                    if (!joystick->HasHatSwitch(joystickHatSwitch))
-                    {
-                        continue;
-                    }
-
-                    for (const auto hatSwitchDirection : hatSwitchDirections)
-                    {
-                        if (joystick->WasHatSwitchReturned(joystickHatSwitch, hatSwitchDirection))
-                        {
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
-
-        return false;
+        return buttonLocation != std::cend(m_buttons) && IsButtonInputUp(buttonLocation->second, gameControllers, joysticks);
     }
 
     auto InputManager::AddKeyToPositiveAxis(const String& axisName, const KeyCode key) -> void
@@ -443,6 +289,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].positiveKeys.insert(key);
@@ -453,6 +300,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].negativeKeys.insert(key);
@@ -463,6 +311,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].positiveMouseButtons.insert(button);
@@ -473,6 +322,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].negativeMouseButtons.insert(button);
@@ -483,6 +333,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].mouseAxes.insert(axis);
@@ -493,6 +344,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].positiveGameControllerButtons.insert(button);
@@ -503,6 +355,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].negativeGameControllerButtons.insert(button);
@@ -513,6 +366,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].positiveGameControllerTriggers.insert(trigger);
@@ -523,6 +377,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].negativeGameControllerTriggers.insert(trigger);
@@ -533,6 +388,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].gameControllerAxes[axis] = isInverted;
@@ -543,6 +399,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].positiveJoystickButtons.insert(button);
@@ -553,6 +410,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].negativeJoystickButtons.insert(button);
@@ -563,6 +421,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].joystickAxes[axis] = JoystickAxisInfo{
@@ -576,6 +435,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].joystickAxes[axis] = JoystickAxisInfo{
@@ -589,6 +449,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].joystickAxes[axis] = JoystickAxisInfo{
@@ -602,6 +463,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].joystickXHatSwitches.insert(hatSwitch);
@@ -612,6 +474,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].joystickYHatSwitches.insert(hatSwitch);
@@ -622,6 +485,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].joystickXTrackballs.insert(trackball);
@@ -632,6 +496,7 @@ namespace stardust
         if (!m_axes.contains(axisName))
         {
             m_axes[axisName] = { };
+            m_isActionMapDirty = true;
         }
 
         m_axes[axisName].joystickYTrackballs.insert(trackball);
@@ -776,11 +641,13 @@ namespace stardust
     auto InputManager::RemoveAxis(const String& axisName) -> void
     {
         m_axes.erase(axisName);
+        m_isActionMapDirty = true;
     }
 
     auto InputManager::ClearAllAxes() -> void
     {
         m_axes.clear();
+        m_isActionMapDirty = true;
     }
 
     [[nodiscard]] auto InputManager::IsAxisInverted(const String& axisName, const GameControllerAxis gameControllerAxis) const -> bool
@@ -826,30 +693,19 @@ namespace stardust
 
     [[nodiscard]] auto InputManager::GetAxis(const String& axisName, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> i32
     {
-        if (!m_axes.contains(axisName))
-        {
-            return 0;
-        }
-
         return static_cast<i32>(glm::sign(GetAxisRaw(axisName, gameControllers, joysticks)));
     }
 
     [[nodiscard]] auto InputManager::GetAxisRaw(const String& axisName, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> f32
     {
-        if (!m_axes.contains(axisName))
+        const auto axisLocation = m_axes.find(axisName);
+
+        if (axisLocation == std::cend(m_axes))
         {
             return 0.0f;
         }
 
-        const auto& axisData = m_axes.at(axisName);
-        f32 axisResult = 0.0f;
-
-        axisResult += GetAxisValueFromKeyboard(axisData);
-        axisResult += GetAxisValueFromMouse(axisData);
-        axisResult += GetAxisValueFromGameControllers(axisData, gameControllers);
-        axisResult += GetAxisValueFromJoysticks(axisData, joysticks);
-
-        return axisResult;
+        return GetAxisInputValue(axisLocation->second, gameControllers, joysticks);
     }
 
     [[nodiscard]] auto InputManager::GetClampedAxisRaw(const String& axisName, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> f32
@@ -863,6 +719,290 @@ namespace stardust
         LoadButtonsFromControlPrefs(controlPrefs);
     }
 
+    auto InputManager::RebindActions() -> void
+    {
+        for (auto& buttonAction : m_buttonActions)
+        {
+            const auto buttonLocation = m_buttons.find(buttonAction.name);
+            buttonAction.input = buttonLocation != std::cend(m_buttons) ? &buttonLocation->second : nullptr;
+        }
+
+        for (auto& axisAction : m_axisActions)
+        {
+            const auto axisLocation = m_axes.find(axisAction.name);
+            axisAction.input = axisLocation != std::cend(m_axes) ? &axisLocation->second : nullptr;
+        }
+
+        m_isActionMapDirty = false;
+    }
+
+    [[nodiscard]] auto InputManager::IsButtonInputDown(const ButtonInput& buttons, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool
+    {
+        for (const auto key : buttons.keys)
+        {
+            if (m_inputController->GetKeyboardState().IsKeyDown(key))
+            {
+                return true;
+            }
+        }
+
+        for (const auto mouseButton : buttons.mouseButtons)
+        {
+            if (m_inputController->GetMouseState().IsButtonDown(mouseButton))
+            {
+                return true;
+            }
+        }
+
+        for (const auto& gameController : gameControllers)
+        {
+            if (gameController == nullptr) [[unlikely]]
+            {
+                continue;
+            }
+
+            for (const auto gameControllerButton : buttons.gameControllerButtons)
+            {
+                if (gameController->IsButtonDown(gameControllerButton))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto gameControllerTrigger : buttons.gameControllerTriggers)
+            {
+                if (gameController->IsTriggerDown(gameControllerTrigger))
+                {
+                    return true;
+                }
+            }
+        }
+
+        for (const auto& joystick : joysticks)
+        {
+            if (joystick == nullptr) [[unlikely]]
+            {
+                continue;
+            }
+
+            for (const auto joystickButton : buttons.joystickButtons)
+            {
+                if (joystick->HasButton(joystickButton) && joystick->IsButtonDown(joystickButton))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto joystickAxis : buttons.joystickAxes)
+            {
+                if (joystick->HasAxis(joystickAxis) && joystick->IsAxisDown(joystickAxis))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto& [joystickHatSwitch, hatSwitchDirections] : buttons.joystickHatSwitchDirections)
+            {
+                if (!joystick->HasHatSwitch(joystickHatSwitch))
+                {
+                    continue;
+                }
+
+                for (const auto hatSwitchDirection : hatSwitchDirections)
+                {
+                    if (joystick->WasHatSwitchMoved(joystickHatSwitch, hatSwitchDirection))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] auto InputManager::IsButtonInputPressed(const ButtonInput& buttons, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool
+    {
+        for (const auto key : buttons.keys)
+        {
+            if (m_inputController->GetKeyboardState().IsKeyPressed(key))
+            {
+                return true;
+            }
+        }
+
+        for (const auto mouseButton : buttons.mouseButtons)
+        {
+            if (m_inputController->GetMouseState().IsButtonPressed(mouseButton))
+            {
+                return true;
+            }
+        }
+
+        for (const auto& gameController : gameControllers)
+        {
+            if (gameController == nullptr) [[unlikely]]
+            {
+                continue;
+            }
+
+            for (const auto gameControllerButton : buttons.gameControllerButtons)
+            {
+                if (gameController->IsButtonPressed(gameControllerButton))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto gameControllerTrigger : buttons.gameControllerTriggers)
+            {
+                if (gameController->IsTriggerPressed(gameControllerTrigger))
+                {
+                    return true;
+                }
+            }
+        }
+
+        for (const auto& joystick : joysticks)
+        {
+            if (joystick == nullptr) [[unlikely]]
+            {
+                continue;
+            }
+
+            for (const auto joystickButton : buttons.joystickButtons)
+            {
+                if (joystick->HasButton(joystickButton) && joystick->IsButtonPressed(joystickButton))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto joystickAxis : buttons.joystickAxes)
+            {
+                if (joystick->HasAxis(joystickAxis) && joystick->IsAxisPressed(joystickAxis))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto& [joystickHatSwitch, hatSwitchDirections] : buttons.joystickHatSwitchDirections)
+            {
+                if (!joystick->HasHatSwitch(joystickHatSwitch))
+                {
+                    continue;
+                }
+
+                for (const auto hatSwitchDirection : hatSwitchDirections)
+                {
+                    if (joystick->IsHatSwitchMoved(joystickHatSwitch, hatSwitchDirection))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] auto InputManager::IsButtonInputUp(const ButtonInput& buttons, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> bool
+    {
+        for (const auto key : buttons.keys)
+        {
+            if (m_inputController->GetKeyboardState().IsKeyUp(key))
+            {
+                return true;
+            }
+        }
+
+        for (const auto mouseButton : buttons.mouseButtons)
+        {
+            if (m_inputController->GetMouseState().IsButtonUp(mouseButton))
+            {
+                return true;
+            }
+        }
+
+        for (const auto& gameController : gameControllers)
+        {
+            if (gameController == nullptr) [[unlikely]]
+            {
+                continue;
+            }
+
+            for (const auto gameControllerButton : buttons.gameControllerButtons)
+            {
+                if (gameController->IsButtonUp(gameControllerButton))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto gameControllerTrigger : buttons.gameControllerTriggers)
+            {
+                if (gameController->IsTriggerUp(gameControllerTrigger))
+                {
+                    return true;
+                }
+            }
+        }
+
+        for (const auto& joystick : joysticks)
+        {
+            if (joystick == nullptr) [[unlikely]]
+            {
+                continue;
+            }
+
+            for (const auto joystickButton : buttons.joystickButtons)
+            {
+                if (joystick->HasButton(joystickButton) && joystick->IsButtonUp(joystickButton))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto joystickAxis : buttons.joystickAxes)
+            {
+                if (joystick->HasAxis(joystickAxis) && joystick->IsAxisUp(joystickAxis))
+                {
+                    return true;
+                }
+            }
+
+            for (const auto& [joystickHatSwitch, hatSwitchDirections] : buttons.joystickHatSwitchDirections)
+            {
+                if (!joystick->HasHatSwitch(joystickHatSwitch))
+                {
+                    continue;
+                }
+
+                for (const auto hatSwitchDirection : hatSwitchDirections)
+                {
+                    if (joystick->WasHatSwitchReturned(joystickHatSwitch, hatSwitchDirection))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] auto InputManager::GetAxisInputValue(const AxisInput& axisData, const List<ObserverPointer<const GameController>>& gameControllers, const List<ObserverPointer<const Joystick>>& joysticks) const -> f32
+    {
+        f32 axisResult = 0.0f;
+
+        axisResult += GetAxisValueFromKeyboard(axisData);
+        axisResult += GetAxisValueFromMouse(axisData);
+        axisResult += GetAxisValueFromGameControllers(axisData, gameControllers);
+        axisResult += GetAxisValueFromJoysticks(axisData, joysticks);
+
+        return axisResult;
+    }
+
     [[nodiscard]] auto InputManager::GetAxisValueFromKeyboard(const AxisInput& axisData) const -> f32
     {
         f32 axisResult = 0.0f;
@@ -13,6 +13,12 @@ namespace stardust
         m_currentKeyStates = std::move(List<u8>(keyState, keyState + SDL_NUM_SCANCODES));
     }
 
+    auto KeyboardState::Update(const List<u8>& keyStates) -> void
+    {
+        std::swap(m_previousKeyStates, m_currentKeyStates);
+        m_currentKeyStates = keyStates;
+    }
+
     [[nodiscard]] auto KeyboardState::IsKeyDown(const KeyCode key) const -> bool
     {
         return m_currentKeyStates[static_cast<SDL_Scancode>(key)] && !m_previousKeyStates[static_cast<SDL_Scancode>(key)];
@@ -15,6 +15,15 @@ namespace stardust
         m_currentButtonState = SDL_GetMouseState(&m_currentScreenCoordinates.x, &m_currentScreenCoordinates.y);
     }
 
+    auto MouseState::Update(const u32 buttonState, const IVector2 coordinates) noexcept -> void
+    {
+        m_previousScreenCoordinates = m_currentScreenCoordinates;
+        m_currentScreenCoordinates = coordinates;
+
+        m_previousButtonState = m_currentButtonState;
+        m_currentButtonState = buttonState;
+    }
+
     auto MouseState::ResetScrollState() noexcept -> void
     {
         m_yScrollAmount = 0;
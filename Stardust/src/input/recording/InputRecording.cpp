@@ -0,0 +1,304 @@
+#include "stardust/input/recording/InputRecording.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "stardust/filesystem/Filesystem.h"
+
+namespace stardust
+{
+    namespace
+    {
+        struct RecordingHeader final
+        {
+            u32 magic;
+            u32 version;
+            u32 frameCount;
+            u32 gameControllerCount;
+        };
+
+        enum class FrameFlag
+            : u8
+        {
+            None = 0b0000'0000u,
+            MouseChanged = 0b0000'0001u,
+        };
+
+        constexpr u32 RecordingMagic = 0x52'49'44'53u;
+        constexpr u32 RecordingVersion = 2u;
+
+        constexpr usize MinimumFrameSize = sizeof(u8) + sizeof(f64) + sizeof(u16) + sizeof(u8) + sizeof(u16);
+
+        [[nodiscard]] auto GetEventPayloadSize(const u32 eventType) noexcept -> usize
+        {
+            switch (eventType)
+            {
+            case SDL_KEYDOWN:
+            case SDL_KEYUP:
+                return sizeof(SDL_KeyboardEvent);
+
+            case SDL_TEXTEDITING:
+                return sizeof(SDL_TextEditingEvent);
+
+            case SDL_TEXTINPUT:
+                return sizeof(SDL_TextInputEvent);
+
+            case SDL_MOUSEMOTION:
+                return sizeof(SDL_MouseMotionEvent);
+
+            case SDL_MOUSEBUTTONDOWN:
+            case SDL_MOUSEBUTTONUP:
+                return sizeof(SDL_MouseButtonEvent);
+
+            case SDL_MOUSEWHEEL:
+                return sizeof(SDL_MouseWheelEvent);
+
+            default:
+                return 0u;
+            }
+        }
+
+        template <typename T>
+        auto WriteValue(List<ubyte>& bytes, const T& value) -> void
+        {
+            const usize offset = bytes.size();
+
+            bytes.resize(offset + sizeof(T));
+            std::memcpy(bytes.data() + offset, &value, sizeof(T));
+        }
+
+        template <typename T>
+        [[nodiscard]] auto ReadValue(const List<ubyte>& bytes, usize& offset, T& value) -> bool
+        {
+            if (bytes.size() - offset < sizeof(T))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, bytes.data() + offset, sizeof(T));
+            offset += sizeof(T);
+
+            return true;
+        }
+    }
+
+    [[nodiscard]] auto InputRecording::IsRecordableEvent(const SDL_Event& event) noexcept -> bool
+    {
+        return GetEventPayloadSize(event.type) != 0u;
+    }
+
+    [[nodiscard]] auto InputRecording::Save(const StringView filepath) const -> Status
+    {
+        if (m_frames.size() > std::numeric_limits<u32>::max())
+        {
+            return Status::Fail;
+        }
+
+        List<ubyte> fileBytes{ };
+
+        WriteValue(fileBytes, RecordingHeader{
+            .magic = RecordingMagic,
+            .version = RecordingVersion,
+            .frameCount = static_cast<u32>(m_frames.size()),
+            .gameControllerCount = m_gameControllerCount,
+        });
+
+        u32 previousMouseButtonState = 0u;
+        IVector2 previousMouseCoordinates{ 0, 0 };
+
+        for (const Frame& frame : m_frames)
+        {
+            if (frame.toggledKeys.size() > std::numeric_limits<u16>::max() ||
+                frame.gameControllers.size() > std::numeric_limits<u8>::max() ||
+                frame.events.size() > std::numeric_limits<u16>::max())
+            {
+                return Status::Fail;
+            }
+
+            const bool hasMouseChanged = frame.mouseButtonState != previousMouseButtonState || frame.mouseCoordinates != previousMouseCoordinates;
+
+            WriteValue(fileBytes, static_cast<u8>(hasMouseChanged ? FrameFlag::MouseChanged : FrameFlag::None));
+            WriteValue(fileBytes, frame.deltaTime);
+
+            if (hasMouseChanged)
+            {
+                WriteValue(fileBytes, frame.mouseButtonState);
+                WriteValue(fileBytes, frame.mouseCoordinates.x);
+                WriteValue(fileBytes, frame.mouseCoordinates.y);
+
+                previousMouseButtonState = frame.mouseButtonState;
+                previousMouseCoordinates = frame.mouseCoordinates;
+            }
+
+            WriteValue(fileBytes, static_cast<u16>(frame.toggledKeys.size()));
+
+            for (const u16 toggledKey : frame.toggledKeys)
+            {
+                WriteValue(fileBytes, toggledKey);
+            }
+
+            WriteValue(fileBytes, static_cast<u8>(frame.gameControllers.size()));
+
+            for (const GameControllerFrame& gameControllerFrame : frame.gameControllers)
+            {
+                WriteValue(fileBytes, gameControllerFrame.controllerIndex);
+                WriteValue(fileBytes, gameControllerFrame.buttonState);
+                WriteValue(fileBytes, gameControllerFrame.axisValues);
+            }
+
+            WriteValue(fileBytes, static_cast<u16>(frame.events.size()));
+
+            for (const SDL_Event& event : frame.events)
+            {
+                const usize payloadSize = GetEventPayloadSize(event.type);
+                const usize offset = fileBytes.size();
+
+                fileBytes.resize(offset + payloadSize);
+                std::memcpy(fileBytes.data() + offset, &event, payloadSize);
+            }
+        }
+
+        return filesystem::WriteBytesToFile(filepath, fileBytes);
+    }
+
+    [[nodiscard]] auto InputRecording::Load(const StringView filepath) -> Status
+    {
+        auto fileBytesResult = filesystem::ReadFileBytes(filepath);
+
+        if (fileBytesResult.is_err())
+        {
+            return Status::Fail;
+        }
+
+        const List<ubyte> fileBytes = std::move(fileBytesResult).unwrap();
+        usize offset = 0u;
+
+        RecordingHeader header{ };
+
+        if (!ReadValue(fileBytes, offset, header) || header.magic != RecordingMagic || header.version != RecordingVersion)
+        {
+            return Status::Fail;
+        }
+
+        List<Frame> frames{ };
+        frames.reserve(std::min(static_cast<usize>(header.frameCount), (fileBytes.size() - offset) / MinimumFrameSize));
+
+        u32 mouseButtonState = 0u;
+        IVector2 mouseCoordinates{ 0, 0 };
+
+        for (u32 i = 0u; i < header.frameCount; ++i)
+        {
+            Frame frame{ };
+            u8 frameFlags = 0u;
+
+            if (!ReadValue(fileBytes, offset, frameFlags) || !ReadValue(fileBytes, offset, frame.deltaTime) || !std::isfinite(frame.deltaTime) || frame.deltaTime < 0.0)
+            {
+                return Status::Fail;
+            }
+
+            if ((frameFlags & static_cast<u8>(FrameFlag::MouseChanged)) != 0u)
+            {
+                if (!ReadValue(fileBytes, offset, mouseButtonState) || !ReadValue(fileBytes, offset, mouseCoordinates.x) || !ReadValue(fileBytes, offset, mouseCoordinates.y))
+                {
+                    return Status::Fail;
+                }
+            }
+
+            frame.mouseButtonState = mouseButtonState;
+            frame.mouseCoordinates = mouseCoordinates;
+
+            u16 toggledKeyCount = 0u;
+
+            if (!ReadValue(fileBytes, offset, toggledKeyCount))
+            {
+                return Status::Fail;
+            }
+
+            frame.toggledKeys.resize(toggledKeyCount);
+
+            for (u16& toggledKey : frame.toggledKeys)
+            {
+                if (!ReadValue(fileBytes, offset, toggledKey) || toggledKey >= SDL_NUM_SCANCODES)
+                {
+                    return Status::Fail;
+                }
+            }
+
+            u8 gameControllerCount = 0u;
+
+            if (!ReadValue(fileBytes, offset, gameControllerCount))
+            {
+                return Status::Fail;
+            }
+
+            frame.gameControllers.resize(gameControllerCount);
+
+            for (GameControllerFrame& gameControllerFrame : frame.gameControllers)
+            {
+                if (!ReadValue(fileBytes, offset, gameControllerFrame.controllerIndex) ||
+                    !ReadValue(fileBytes, offset, gameControllerFrame.buttonState) ||
+                    !ReadValue(fileBytes, offset, gameControllerFrame.axisValues) ||
+                    gameControllerFrame.controllerIndex >= header.gameControllerCount)
+                {
+                    return Status::Fail;
+                }
+            }
+
+            u16 eventCount = 0u;
+
+            if (!ReadValue(fileBytes, offset, eventCount))
+            {
+                return Status::Fail;
+            }
+
+            frame.events.resize(eventCount);
+
+            for (SDL_Event& event : frame.events)
+            {
+                u32 eventType = 0u;
+
+                if (fileBytes.size() - offset < sizeof(u32))
+                {
+                    return Status::Fail;
+                }
+
+                std::memcpy(&eventType, fileBytes.data() + offset, sizeof(u32));
+                const usize payloadSize = GetEventPayloadSize(eventType);
+
+                if (payloadSize == 0u || fileBytes.size() - offset < payloadSize)
+                {
+                    return Status::Fail;
+                }
+
+                std::memcpy(&event, fileBytes.data() + offset, payloadSize);
+                offset += payloadSize;
+            }
+
+            frames.push_back(std::move(frame));
+        }
+
+        m_frames = std::move(frames);
+        m_gameControllerCount = header.gameControllerCount;
+
+        return Status::Success;
+    }
+
+    auto InputRecording::AddFrame(Frame&& frame) -> void
+    {
+        for (const GameControllerFrame& gameControllerFrame : frame.gameControllers)
+        {
+            m_gameControllerCount = std::max(m_gameControllerCount, static_cast<u32>(gameControllerFrame.controllerIndex) + 1u);
+        }
+
+        m_frames.push_back(std::move(frame));
+    }
+
+    auto InputRecording::Clear() -> void
+    {
+        m_frames.clear();
+        m_gameControllerCount = 0u;
+    }
+}
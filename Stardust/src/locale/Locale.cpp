@@ -1,20 +1,52 @@
 #include "stardust/locale/Locale.h"
 
+#include <algorithm>
+#include <string>
 #include <utility>
 
 #include <SDL2/SDL.h>
 
 #include "stardust/filesystem/vfs/VirtualFilesystem.h"
 #include "stardust/filesystem/Filesystem.h"
-#include "stardust/utility/string/String.h"
 
 namespace stardust
 {
+    Locale::Path::Path(const Locale& locale, const Key key) noexcept
+        : m_locale(&locale), m_key(key)
+    { }
+
+    [[nodiscard]] auto Locale::Path::operator [](const StringView localeEntryName) const noexcept -> Path
+    {
+        return Path(*m_locale, AppendToKey(m_key, localeEntryName));
+    }
+
+    [[nodiscard]] auto Locale::Path::Get() const noexcept -> const String&
+    {
+        return m_locale->Get(m_key);
+    }
+
+    [[nodiscard]] auto Locale::Path::Get(const HashMap<String, String>& replacementMap) const -> String
+    {
+        return m_locale->Get(m_key, replacementMap);
+    }
+
     auto Locale::SetLocaleChangeEventID(const u32 eventID) noexcept -> void
     {
         s_localeChangeEventID = eventID;
     }
 
+    [[nodiscard]] auto Locale::MakeKey(const List<String>& localeEntryNames) noexcept -> Key
+    {
+        Key key = EmptyKey;
+
+        for (const auto& entryName : localeEntryNames)
+        {
+            key = AppendToKey(key, entryName);
+        }
+
+        return key;
+    }
+
     auto Locale::Initialise(const StringView baseLocaleDirectory) -> void
     {
         m_baseLocaleDirectory = baseLocaleDirectory;
@@ -58,7 +90,12 @@ namespace stardust
             }
         }
 
-        m_currentLocaleEntries = std::move(localeAccumulator);
+        HashMap<Key, u32> entryIndices{ };
+        List<Entry> entries{ };
+        FlattenEntries(localeAccumulator, EmptyKey, entryIndices, entries);
+
+        m_entryIndices = std::move(entryIndices);
+        m_entries = std::move(entries);
         m_currentLocaleName = localeName;
 
         if (triggerEvent)
@@ -69,59 +106,183 @@ namespace stardust
         return Status::Success;
     }
 
-    [[nodiscard]] auto Locale::Get(const StringView localeEntryName, const HashMap<String, String>& replacementMap) const -> String
+    [[nodiscard]] auto Locale::Get(const Key key) const noexcept -> const String&
+    {
+        const ObserverPointer<const Entry> entry = FindEntry(key);
+
+        return entry != nullptr
+            ? entry->text
+            : s_missingEntry;
+    }
+
+    [[nodiscard]] auto Locale::Get(const Key key, const HashMap<String, String>& replacementMap) const -> String
     {
-        String localeString = Get(localeEntryName);
-        
-        for (const auto& [oldValue, newValue] : replacementMap)
+        const ObserverPointer<const Entry> entry = FindEntry(key);
+
+        if (entry == nullptr)
+        {
+            return s_missingEntry;
+        }
+
+        if (!entry->hasPlaceholders || replacementMap.empty())
         {
-            localeString = string::ReplaceAll(localeString, "${" + oldValue + "}", newValue);
+            return entry->text;
+        }
+
+        const StringView entryText = entry->text;
+
+        String localeString{ };
+        localeString.reserve(entryText.length() * 2u);
+
+        for (const Segment& segment : entry->segments)
+        {
+            const StringView segmentText = entryText.substr(segment.offset, segment.length);
+
+            if (!segment.isPlaceholder)
+            {
+                localeString.append(segmentText);
+
+                continue;
+            }
+
+            const StringView placeholderName = segmentText.substr(2u, segmentText.length() - 3u);
+            bool wasReplaced = false;
+
+            for (const auto& [oldValue, newValue] : replacementMap)
+            {
+                if (oldValue == placeholderName)
+                {
+                    localeString.append(newValue);
+                    wasReplaced = true;
+
+                    break;
+                }
+            }
+
+            if (!wasReplaced)
+            {
+                localeString.append(segmentText);
+            }
         }
 
         return localeString;
     }
 
-    [[nodiscard]] auto Locale::Get(const List<String>& localeEntryNames) const -> String
+    [[nodiscard]] auto Locale::LoadLocaleFile(const String& filepath) const -> Optional<JSON>
     {
-        JSON currentEntry = m_currentLocaleEntries;
+        auto localeReadResult = vfs::ReadJSON(filepath);
 
-        for (const auto& entryName : localeEntryNames)
+        if (localeReadResult.is_err())
         {
-            currentEntry = currentEntry[entryName];
+            return None;
         }
 
-        return currentEntry;
+        return std::move(localeReadResult).unwrap();
     }
 
-    [[nodiscard]] auto Locale::Get(const List<String>& localeEntryNames, const HashMap<String, String>& replacementMap) const -> String
+    auto Locale::FlattenEntries(const JSON& localeNode, const Key key, HashMap<Key, u32>& entryIndices, List<Entry>& entries) const -> void
     {
-        JSON currentEntry = m_currentLocaleEntries;
+        if (localeNode.is_object())
+        {
+            for (const auto& [entryName, childNode] : localeNode.items())
+            {
+                FlattenEntries(childNode, AppendToKey(key, entryName), entryIndices, entries);
+            }
 
-        for (const auto& entryName : localeEntryNames)
+            return;
+        }
+
+        if (localeNode.is_array())
         {
-            currentEntry = currentEntry[entryName];
+            for (usize i = 0u; i < localeNode.size(); ++i)
+            {
+                FlattenEntries(localeNode[i], AppendToKey(key, std::to_string(i)), entryIndices, entries);
+            }
+
+            return;
         }
 
-        String localeString = currentEntry;
+        if (localeNode.is_null() || key == EmptyKey)
+        {
+            return;
+        }
 
-        for (const auto& [oldValue, newValue] : replacementMap)
+        String text = localeNode.is_string()
+            ? localeNode.get<String>()
+            : localeNode.dump();
+
+        List<Segment> segments = ParseSegments(text);
+        const bool hasPlaceholders = std::ranges::any_of(segments, [](const Segment& segment) { return segment.isPlaceholder; });
+
+        entryIndices[key] = static_cast<u32>(entries.size());
+        entries.push_back(Entry{
+            .text = std::move(text),
+            .segments = std::move(segments),
+            .hasPlaceholders = hasPlaceholders,
+        });
+    }
+
+    [[nodiscard]] auto Locale::ParseSegments(const String& text) -> List<Segment>
+    {
+        List<Segment> segments{ };
+        usize literalOffset = 0u;
+
+        while (literalOffset < text.length())
+        {
+            const usize placeholderOffset = text.find("${", literalOffset);
+
+            if (placeholderOffset == String::npos)
+            {
+                break;
+            }
+
+            const usize placeholderEnd = text.find('}', placeholderOffset + 2u);
+
+            if (placeholderEnd == String::npos)
+            {
+                break;
+            }
+
+            if (placeholderOffset > literalOffset)
+            {
+                segments.push_back(Segment{
+                    .offset = static_cast<u32>(literalOffset),
+                    .length = static_cast<u32>(placeholderOffset - literalOffset),
+                    .isPlaceholder = false,
+                });
+            }
+
+            segments.push_back(Segment{
+                .offset = static_cast<u32>(placeholderOffset),
+                .length = static_cast<u32>(placeholderEnd + 1u - placeholderOffset),
+                .isPlaceholder = true,
+            });
+
+            literalOffset = placeholderEnd + 1u;
+        }
+
+        if (literalOffset < text.length())
         {
-            localeString = string::ReplaceAll(localeString, "${" + oldValue + "}", newValue);
+            segments.push_back(Segment{
+                .offset = static_cast<u32>(literalOffset),
+                .length = static_cast<u32>(text.length() - literalOffset),
+                .isPlaceholder = false,
+            });
         }
 
-        return localeString;
+        return segments;
     }
 
-    [[nodiscard]] auto Locale::LoadLocaleFile(const String& filepath) const -> Optional<JSON>
+    [[nodiscard]] auto Locale::FindEntry(const Key key) const noexcept -> ObserverPointer<const Entry>
     {
-        auto localeReadResult = vfs::ReadJSON(filepath);
+        const auto entryIndexLocation = m_entryIndices.find(key);
 
-        if (localeReadResult.is_err())
+        if (entryIndexLocation == std::cend(m_entryIndices))
         {
-            return None;
+            return nullptr;
         }
 
-        return std::move(localeReadResult).unwrap();
+        return &m_entries[entryIndexLocation->second];
     }
 
     auto Locale::PushLocaleChangeEvent() -> void
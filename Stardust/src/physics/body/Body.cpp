@@ -8,18 +8,19 @@ namespace stardust
 {
     namespace physics
     {
-        Body::Body(const World& world, const Body::CreateInfo& createInfo, const EntityHandle associatedEntityHandle)
+        Body::Body(World& world, const Body::CreateInfo& createInfo, const EntityHandle associatedEntityHandle)
         {
             Initialise(world, createInfo, associatedEntityHandle);
         }
 
         Body::Body(Body&& other) noexcept
-            : m_handle(nullptr), m_owningWorld(nullptr), m_colliders({ }), m_associatedEntityHandle(NullEntityHandle)
+            : m_handle(nullptr), m_owningWorld(nullptr), m_colliders({ }), m_associatedEntityHandle(NullEntityHandle), m_transformSnapshots({ })
         {
             std::swap(m_handle, other.m_handle);
             std::swap(m_owningWorld, other.m_owningWorld);
             std::swap(m_colliders, other.m_colliders);
             std::swap(m_associatedEntityHandle, other.m_associatedEntityHandle);
+            std::swap(m_transformSnapshots, other.m_transformSnapshots);
         }
 
         auto Body::operator =(Body&& other) noexcept -> Body&
@@ -28,38 +29,39 @@ namespace stardust
             m_owningWorld = std::exchange(other.m_owningWorld, nullptr);
             m_colliders = std::exchange(other.m_colliders, { });
             m_associatedEntityHandle = std::exchange(other.m_associatedEntityHandle, NullEntityHandle);
+            m_transformSnapshots = std::exchange(other.m_transformSnapshots, { });
 
             return *this;
         }
 
         auto Body::ApplyForce(const Vector2 force, const Vector2 point, const bool wakeUp) const -> void
         {
-            m_handle->ApplyForce(b2Vec2{ force.x, force.y }, b2Vec2{ point.x, point.y }, wakeUp);
+            GetSynchronisedHandle()->ApplyForce(b2Vec2{ force.x, force.y }, b2Vec2{ point.x, point.y }, wakeUp);
         }
 
         auto Body::ApplyForceToCentre(const Vector2 force, const bool wakeUp) const -> void
         {
-            m_handle->ApplyForceToCenter(b2Vec2{ force.x, force.y }, wakeUp);
+            GetSynchronisedHandle()->ApplyForceToCenter(b2Vec2{ force.x, force.y }, wakeUp);
         }
 
         auto Body::ApplyTorque(const f32 torque, const bool wakeUp) const -> void
         {
-            m_handle->ApplyTorque(torque, wakeUp);
+            GetSynchronisedHandle()->ApplyTorque(torque, wakeUp);
         }
 
         auto Body::ApplyLinearImpulse(const Vector2 impulse, const Vector2 point, const bool wakeUp) const -> void
         {
-            m_handle->ApplyLinearImpulse(b2Vec2{ impulse.x, impulse.y }, b2Vec2{ point.x, point.y }, wakeUp);
+            GetSynchronisedHandle()->ApplyLinearImpulse(b2Vec2{ impulse.x, impulse.y }, b2Vec2{ point.x, point.y }, wakeUp);
         }
 
         auto Body::ApplyLinearImpulseToCentre(const Vector2 impulse, const bool wakeUp) const -> void
         {
-            m_handle->ApplyLinearImpulseToCenter(b2Vec2{ impulse.x, impulse.y }, wakeUp);
+            GetSynchronisedHandle()->ApplyLinearImpulseToCenter(b2Vec2{ impulse.x, impulse.y }, wakeUp);
         }
 
         auto Body::ApplyAngularImpulse(const f32 impulse, const bool wakeUp) const -> void
         {
-            m_handle->ApplyAngularImpulse(impulse, wakeUp);
+            GetSynchronisedHandle()->ApplyAngularImpulse(impulse, wakeUp);
         }
 
         auto Body::Move(const Vector2 positionOffset) const -> void
@@ -74,214 +76,227 @@ namespace stardust
 
         auto Body::AddCollider(const Collider::CreateInfo& colliderInfo) -> Collider
         {
+            if (m_owningWorld != nullptr)
+            {
+                m_owningWorld->WaitForStep();
+            }
+
             return *m_colliders.emplace(*this, colliderInfo).first;
         }
 
         auto Body::RemoveCollider(const Collider& collider) -> void
         {
+            const ObserverPointer<b2Fixture> fixtureHandle = collider.GetRawHandle();
+
+            if (m_owningWorld != nullptr)
+            {
+                m_owningWorld->Synchronise();
+                m_owningWorld->DiscardContactEvents(fixtureHandle);
+            }
+
             m_colliders.erase(collider);
-            m_handle->DestroyFixture(collider.GetRawHandle());
+            m_handle->DestroyFixture(fixtureHandle);
         }
 
         [[nodiscard]] auto Body::GetWorldCentre() const -> Vector2
         {
-            const b2Vec2 worldCentre = m_handle->GetWorldCenter();
+            const b2Vec2 worldCentre = GetSynchronisedHandle()->GetWorldCenter();
 
             return Vector2{ worldCentre.x, worldCentre.y };
         }
 
         [[nodiscard]] auto Body::GetLocalCenter() const -> Vector2
         {
-            const b2Vec2 localCentre = m_handle->GetLocalCenter();
+            const b2Vec2 localCentre = GetSynchronisedHandle()->GetLocalCenter();
 
             return Vector2{ localCentre.x, localCentre.y };
         }
 
         [[nodiscard]] auto Body::GetWorldPoint(const Vector2 localPoint) const -> Vector2
         {
-            const b2Vec2 worldPoint = m_handle->GetWorldPoint(b2Vec2{ localPoint.x, localPoint.y });
+            const b2Vec2 worldPoint = GetSynchronisedHandle()->GetWorldPoint(b2Vec2{ localPoint.x, localPoint.y });
 
             return Vector2{ worldPoint.x, worldPoint.y };
         }
 
         [[nodiscard]] auto Body::GetWorldVector(const Vector2 localVector) const -> Vector2
         {
-            const b2Vec2 worldVector = m_handle->GetWorldVector(b2Vec2{ localVector.x, localVector.y });
+            const b2Vec2 worldVector = GetSynchronisedHandle()->GetWorldVector(b2Vec2{ localVector.x, localVector.y });
 
             return Vector2{ worldVector.x, worldVector.y };
         }
 
         [[nodiscard]] auto Body::GetLocalPoint(const Vector2 worldPoint) const -> Vector2
         {
-            const b2Vec2 localPoint = m_handle->GetLocalPoint(b2Vec2{ worldPoint.x, worldPoint.y });
+            const b2Vec2 localPoint = GetSynchronisedHandle()->GetLocalPoint(b2Vec2{ worldPoint.x, worldPoint.y });
 
             return Vector2{ localPoint.x, localPoint.y };
         }
 
         [[nodiscard]] auto Body::GetLocalVector(const Vector2 worldVector) const -> Vector2
         {
-            const b2Vec2 localVector = m_handle->GetLocalVector(b2Vec2{ worldVector.x, worldVector.y });
+            const b2Vec2 localVector = GetSynchronisedHandle()->GetLocalVector(b2Vec2{ worldVector.x, worldVector.y });
 
             return Vector2{ localVector.x, localVector.y };
         }
 
         [[nodiscard]] auto Body::GetLinearVelocityFromWorldPoint(const Vector2 worldPoint) const -> Vector2
         {
-            const b2Vec2 linearVelocity = m_handle->GetLinearVelocityFromWorldPoint(b2Vec2{ worldPoint.x, worldPoint.y });
+            const b2Vec2 linearVelocity = GetSynchronisedHandle()->GetLinearVelocityFromWorldPoint(b2Vec2{ worldPoint.x, worldPoint.y });
 
             return Vector2{ linearVelocity.x, linearVelocity.y };
         }
 
         [[nodiscard]] auto Body::GetLinearVelocityFromLocalPoint(const Vector2 localPoint) const -> Vector2
         {
-            const b2Vec2 linearVelocity = m_handle->GetLinearVelocityFromLocalPoint(b2Vec2{ localPoint.x, localPoint.y });
+            const b2Vec2 linearVelocity = GetSynchronisedHandle()->GetLinearVelocityFromLocalPoint(b2Vec2{ localPoint.x, localPoint.y });
 
             return Vector2{ linearVelocity.x, linearVelocity.y };
         }
 
         [[nodiscard]] auto Body::IsEnabled() const -> bool
         {
-            return m_handle->IsEnabled();
+            return GetSynchronisedHandle()->IsEnabled();
         }
 
         auto Body::SetEnabled(const bool isEnabled) const -> void
         {
-            m_handle->SetEnabled(isEnabled);
+            GetSynchronisedHandle()->SetEnabled(isEnabled);
         }
 
         [[nodiscard]] auto Body::IsAwake() const -> bool
         {
-            return m_handle->IsAwake();
+            return GetSynchronisedHandle()->IsAwake();
         }
 
         [[nodiscard]] auto Body::CanSleep() const -> bool
         {
-            return m_handle->IsSleepingAllowed();
+            return GetSynchronisedHandle()->IsSleepingAllowed();
         }
 
         auto Body::SetAllowSleeping(const bool canSleep) const -> void
         {
-            m_handle->SetSleepingAllowed(canSleep);
+            GetSynchronisedHandle()->SetSleepingAllowed(canSleep);
         }
 
         [[nodiscard]] auto Body::GetType() const -> Type
         {
-            return static_cast<Type>(m_handle->GetType());
+            return static_cast<Type>(GetSynchronisedHandle()->GetType());
         }
 
         auto Body::SetType(const Type type) const -> void
         {
-            m_handle->SetType(static_cast<b2BodyType>(type));
+            GetSynchronisedHandle()->SetType(static_cast<b2BodyType>(type));
         }
 
         [[nodiscard]] auto Body::IsBullet() const -> bool
         {
-            return m_handle->IsBullet();
+            return GetSynchronisedHandle()->IsBullet();
         }
 
         auto Body::SetBullet(const bool isBullet) const -> void
         {
-            m_handle->SetBullet(isBullet);
+            GetSynchronisedHandle()->SetBullet(isBullet);
         }
 
         [[nodiscard]] auto Body::GetPosition() const -> Vector2
         {
-            const b2Vec2 position = m_handle->GetPosition();
+            const b2Vec2 position = GetSynchronisedHandle()->GetPosition();
 
             return Vector2{ position.x, position.y };
         }
 
         auto Body::SetPosition(const Vector2 position) const -> void
         {
-            m_handle->SetTransform(b2Vec2{ position.x, position.y }, GetRotation());
+            GetSynchronisedHandle()->SetTransform(b2Vec2{ position.x, position.y }, GetRotation());
         }
 
         [[nodiscard]] auto Body::GetRotation() const -> f32
         {
-            return -glm::degrees(m_handle->GetAngle());
+            return -glm::degrees(GetSynchronisedHandle()->GetAngle());
         }
 
         auto Body::SetRotation(const f32 rotation) const -> void
         {
-            m_handle->SetTransform(m_handle->GetPosition(), -glm::radians(rotation));
+            GetSynchronisedHandle()->SetTransform(GetSynchronisedHandle()->GetPosition(), -glm::radians(rotation));
         }
 
         [[nodiscard]] auto Body::HasFixedRotation() const -> bool
         {
-            return m_handle->IsFixedRotation();
+            return GetSynchronisedHandle()->IsFixedRotation();
         }
 
         auto Body::SetFixedRotation(const bool hasFixedRotation) const -> void
         {
-            m_handle->SetFixedRotation(hasFixedRotation);
+            GetSynchronisedHandle()->SetFixedRotation(hasFixedRotation);
         }
 
         [[nodiscard]] auto Body::GetLinearVelocity() const -> Vector2
         {
-            const b2Vec2 linearVelocity = m_handle->GetLinearVelocity();
+            const b2Vec2 linearVelocity = GetSynchronisedHandle()->GetLinearVelocity();
 
             return Vector2{ linearVelocity.x, linearVelocity.y };
         }
 
         auto Body::SetLinearVelocity(const Vector2 linearVelocity) const -> void
         {
-            m_handle->SetLinearVelocity(b2Vec2{ linearVelocity.x, linearVelocity.y });
+            GetSynchronisedHandle()->SetLinearVelocity(b2Vec2{ linearVelocity.x, linearVelocity.y });
         }
 
         [[nodiscard]] auto Body::GetAngularVelocity() const -> f32
         {
-            return m_handle->GetAngularVelocity();
+            return GetSynchronisedHandle()->GetAngularVelocity();
         }
 
         auto Body::SetAngularVelocity(const f32 angularVelocity) const -> void
         {
-            m_handle->SetAngularVelocity(angularVelocity);
+            GetSynchronisedHandle()->SetAngularVelocity(angularVelocity);
         }
 
         [[nodiscard]] auto Body::GetLinearDamping() const -> f32
         {
-            return m_handle->GetLinearDamping();
+            return GetSynchronisedHandle()->GetLinearDamping();
         }
 
         auto Body::SetLinearDamping(const f32 linearDamping) const -> void
         {
-            m_handle->SetLinearDamping(linearDamping);
+            GetSynchronisedHandle()->SetLinearDamping(linearDamping);
         }
 
         [[nodiscard]] auto Body::GetAngularDamping() const -> f32
         {
-            return m_handle->GetAngularDamping();
+            return GetSynchronisedHandle()->GetAngularDamping();
         }
 
         auto Body::SetAngularDamping(const f32 angularDamping) const -> void
         {
-            m_handle->SetAngularDamping(angularDamping);
+            GetSynchronisedHandle()->SetAngularDamping(angularDamping);
         }
 
         [[nodiscard]] auto Body::GetGravityScale() const -> f32
         {
-            return m_handle->GetGravityScale();
+            return GetSynchronisedHandle()->GetGravityScale();
         }
 
         auto Body::SetGravityScale(const f32 gravityScale) const -> void
         {
-            m_handle->SetGravityScale(gravityScale);
+            GetSynchronisedHandle()->SetGravityScale(gravityScale);
         }
 
         [[nodiscard]] auto Body::GetMass() const -> f32
         {
-            return m_handle->GetMass();
+            return GetSynchronisedHandle()->GetMass();
         }
 
         [[nodiscard]] auto Body::GetInertia() const -> f32
         {
-            return m_handle->GetInertia();
+            return GetSynchronisedHandle()->GetInertia();
         }
 
         [[nodiscard]] auto Body::GetMassData() const -> MassData
         {
             b2MassData massData{ };
-            m_handle->GetMassData(&massData);
+            GetSynchronisedHandle()->GetMassData(&massData);
 
             return MassData{
                 .mass = massData.mass,
@@ -298,15 +313,25 @@ namespace stardust
                 .I = massData.momentOfInertia,
             };
 
-            m_handle->SetMassData(&convertedMassData);
+            GetSynchronisedHandle()->SetMassData(&convertedMassData);
         }
 
         auto Body::ResetMassData() const -> void
         {
-            m_handle->ResetMassData();
+            GetSynchronisedHandle()->ResetMassData();
         }
 
-        auto Body::Initialise(const World& world, const CreateInfo& createInfo, const EntityHandle associatedEntityHandle) -> void
+        [[nodiscard]] auto Body::GetSynchronisedHandle() const -> ObserverPointer<b2Body>
+        {
+            if (m_owningWorld != nullptr)
+            {
+                m_owningWorld->WaitForStep();
+            }
+
+            return m_handle;
+        }
+
+        auto Body::Initialise(World& world, const CreateInfo& createInfo, const EntityHandle associatedEntityHandle) -> void
         {
             b2BodyDef bodyDef{ };
             bodyDef.type = static_cast<b2BodyType>(createInfo.type);
@@ -334,6 +359,11 @@ namespace stardust
                 {
                     AddCollider(fixtureInfo);
                 }
+
+                m_transformSnapshots.fill(BodyTransform{
+                    .position = GetPosition(),
+                    .rotation = GetRotation(),
+                });
             }
         }
     }
@@ -1,11 +1,17 @@
 #include "stardust/physics/world/World.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <utility>
 
+#include "stardust/application/Application.h"
 #include "stardust/ecs/components/RigidBodyComponent.h"
+#include "stardust/ecs/components/TransformComponent.h"
 #include "stardust/ecs/entity/Entity.h"
 #include "stardust/math/Math.h"
+#include "stardust/task/AsyncTask.h"
 
 namespace stardust
 {
@@ -97,6 +103,35 @@ namespace stardust
                 }
             };
 
+            class RaycastAnyCallback final
+                : public b2RayCastCallback
+            {
+            private:
+                CollisionLayer m_layerMask;
+                bool& m_hasHitFixture;
+
+            public:
+                inline RaycastAnyCallback(const CollisionLayer layerMask, bool& hasHitFixture)
+                    : m_layerMask(layerMask), m_hasHitFixture(hasHitFixture)
+                { }
+
+                virtual ~RaycastAnyCallback() noexcept override = default;
+
+                [[nodiscard]] inline virtual auto ReportFixture(b2Fixture* const fixture, [[maybe_unused]] const b2Vec2& point, [[maybe_unused]] const b2Vec2& normal, [[maybe_unused]] const f32 fraction) -> f32 override
+                {
+                    if (fixture->GetFilterData().categoryBits & m_layerMask)
+                    {
+                        m_hasHitFixture = true;
+
+                        return 0.0f;
+                    }
+                    else
+                    {
+                        return -1.0f;
+                    }
+                }
+            };
+
             class OverlapBoxCallback final
                 : public b2QueryCallback
             {
@@ -154,100 +189,260 @@ namespace stardust
                     return true;
                 }
             };
+
+            template <std::invocable<usize> Func>
+            auto ForEachQuery(const usize queryCount, const u32 threadCount, const Func& func) -> void
+            {
+                const usize chunkCount = std::clamp(static_cast<usize>(threadCount), usize{ 1u }, std::max(queryCount, usize{ 1u }));
+                const usize chunkSize = (queryCount + chunkCount - 1u) / chunkCount;
+
+                List<AsyncTask<void>> chunkTasks{ };
+                chunkTasks.reserve(chunkCount - 1u);
+
+                for (usize chunk = 1u; chunk < chunkCount; ++chunk)
+                {
+                    const usize chunkBegin = chunk * chunkSize;
+                    const usize chunkEnd = std::min(chunkBegin + chunkSize, queryCount);
+
+                    if (chunkBegin >= chunkEnd)
+                    {
+                        break;
+                    }
+
+                    chunkTasks.push_back(RunAsync([&func, chunkBegin, chunkEnd]
+                    {
+                        for (usize i = chunkBegin; i < chunkEnd; ++i)
+                        {
+                            func(i);
+                        }
+                    }));
+                }
+
+                for (usize i = 0u; i < std::min(chunkSize, queryCount); ++i)
+                {
+                    func(i);
+                }
+
+                for (auto& chunkTask : chunkTasks)
+                {
+                    chunkTask.Await();
+                }
+            }
         }
 
-        World::CollisionListener::CollisionListener(const World& world)
+        World::CollisionListener::CollisionListener(World& world)
             : m_world(world)
         { }
 
         auto World::CollisionListener::BeginContact(b2Contact* const contact) -> void
         {
-            const ObserverPointer<b2Body> firstBody = contact->GetFixtureA()->GetBody();
-            const ObserverPointer<b2Body> secondBody = contact->GetFixtureB()->GetBody();
+            m_world.RecordContactEvent(contact, ContactEvent::Type::Begin);
+        }
+
+        auto World::CollisionListener::EndContact(b2Contact* const contact) -> void
+        {
+            m_world.RecordContactEvent(contact, ContactEvent::Type::End);
+        }
+
+        World::World(const Vector2 gravity)
+        {
+            Initialise(gravity);
+        }
+
+        World::World(Scene& scene, const Vector2 gravity)
+        {
+            Initialise(scene, gravity);
+        }
+
+        auto World::Initialise(const Vector2 gravity) -> void
+        {
+            m_handle = std::make_unique<b2World>(b2Vec2{ gravity.x, gravity.y });
+            m_handle->SetContactListener(&m_collisionListener);
+
+            m_scene = nullptr;
+        }
 
-            const bool isSensorContact = contact->GetFixtureA()->IsSensor() || contact->GetFixtureB()->IsSensor();
+        auto World::Initialise(Scene& scene, const Vector2 gravity) -> void
+        {
+            Initialise(gravity);
+
+            m_scene = &scene;
+        }
 
-            if (isSensorContact)
+        auto World::Step(const f64 timestep) -> void
+        {
+            if (m_isThreadedSteppingEnabled)
             {
-                if (m_world.m_sensorEnterCallbacks.contains(firstBody))
+                Synchronise();
+
                 {
-                    m_world.m_sensorEnterCallbacks.at(firstBody)(Collider(contact->GetFixtureB(), m_world));
+                    const std::scoped_lock lock(m_stepMutex);
+
+                    m_pendingTimestep = static_cast<f32>(timestep);
+                    m_isStepPending = true;
                 }
+
+                m_isStepInFlight = true;
+                m_stepCondition.notify_all();
             }
             else
             {
-                if (m_world.m_collisionEnterCallbacks.contains(firstBody))
-                {
-                    m_world.m_collisionEnterCallbacks.at(firstBody)(Collider(contact->GetFixtureB(), m_world));
-                }
+                m_handle->Step(static_cast<f32>(timestep), static_cast<i32>(s_velocityIterations), static_cast<i32>(s_positionIterations));
+
+                CaptureTransformSnapshots();
+                FlushContactEvents();
             }
         }
 
-        auto World::CollisionListener::EndContact(b2Contact* const contact) -> void
+        auto World::Synchronise() -> void
         {
-            const ObserverPointer<b2Body> firstBody = contact->GetFixtureA()->GetBody();
-            const ObserverPointer<b2Body> secondBody = contact->GetFixtureB()->GetBody();
+            if (!m_isStepInFlight)
+            {
+                return;
+            }
 
-            const bool isSensorContact = contact->GetFixtureA()->IsSensor() || contact->GetFixtureB()->IsSensor();
+            WaitForStep();
+            m_isStepInFlight = false;
 
-            if (isSensorContact)
+            CaptureTransformSnapshots();
+            FlushContactEvents();
+        }
+
+        auto World::WaitForStep() const -> void
+        {
+            if (!m_isStepInFlight)
             {
-                if (m_world.m_sensorExitCallbacks.contains(firstBody))
-                {
-                    m_world.m_sensorExitCallbacks.at(firstBody)(Collider(contact->GetFixtureB(), m_world));
-                }
+                return;
             }
-            else
+
+            std::unique_lock lock(m_stepMutex);
+            m_stepCondition.wait(lock, [this] { return !m_isStepPending; });
+        }
+
+        auto World::EnableThreadedStepping() -> void
+        {
+            if (m_isThreadedSteppingEnabled)
             {
-                if (m_world.m_collisionExitCallbacks.contains(firstBody))
-                {
-                    m_world.m_collisionExitCallbacks.at(firstBody)(Collider(contact->GetFixtureB(), m_world));
-                }
+                return;
             }
+
+            m_isThreadedSteppingEnabled = true;
+            m_stepThread = std::jthread([this](const std::stop_token stopToken) { RunStepThread(stopToken); });
         }
 
-        World::World(Scene& scene, const Vector2 gravity)
+        auto World::DisableThreadedStepping() -> void
         {
-            Initialise(scene, gravity);
+            if (!m_isThreadedSteppingEnabled)
+            {
+                return;
+            }
+
+            Synchronise();
+
+            m_stepThread.request_stop();
+            m_stepThread.join();
+
+            m_isThreadedSteppingEnabled = false;
         }
 
-        auto World::Initialise(Scene& scene, const Vector2 gravity) -> void
+        [[nodiscard]] auto World::GetInterpolatedTransform(const Body& body, const f32 interpolation) const -> BodyTransform
         {
-            m_handle = std::make_unique<b2World>(b2Vec2{ gravity.x, gravity.y });
-            m_handle->SetContactListener(&m_collisionListener);
+            const BodyTransform& previousTransform = body.m_transformSnapshots[1u - m_currentTransformSnapshotIndex];
+            const BodyTransform& currentTransform = body.m_transformSnapshots[m_currentTransformSnapshotIndex];
 
-            m_scene = &scene;
+            return BodyTransform{
+                .position = glm::mix(previousTransform.position, currentTransform.position, interpolation),
+                .rotation = glm::mix(previousTransform.rotation, currentTransform.rotation, interpolation),
+            };
+        }
+
+        auto World::SyncTransforms() -> void
+        {
+            if (m_scene == nullptr)
+            {
+                return;
+            }
+
+            SyncTransforms(m_scene->GetApplication().GetTimestepController().GetFixedTimeInterpolation());
         }
 
-        auto World::Step(const f64 timestep) const -> void
+        auto World::SyncTransforms(const f32 interpolation) -> void
         {
-            m_handle->Step(static_cast<f32>(timestep), static_cast<i32>(s_velocityIterations), static_cast<i32>(s_positionIterations));
+            if (m_scene == nullptr)
+            {
+                return;
+            }
+
+            entt::registry& registry = m_scene->GetEntityRegistry().GetHandle();
+
+            for (const auto& body : m_bodies)
+            {
+                if (!body.IsValid() || body.GetAssociatedEntityHandle() == NullEntityHandle)
+                {
+                    continue;
+                }
+
+                if (const ObserverPointer<components::Transform> transform = registry.try_get<components::Transform>(body.GetAssociatedEntityHandle());
+                    transform != nullptr)
+                {
+                    const BodyTransform interpolatedTransform = GetInterpolatedTransform(body, interpolation);
+
+                    transform->translation = interpolatedTransform.position;
+                    transform->rotation = interpolatedTransform.rotation;
+                }
+            }
         }
 
         auto World::CreateBody(const Body::CreateInfo& createInfo, const ObserverPointer<EntityBundle> entityBundle) -> ObserverPointer<Body>
         {
-            Entity entity = m_scene->CreateEntity(entityBundle);
-            Body body(*this, createInfo, entity.GetHandle());
+            Synchronise();
+
+            if (m_scene == nullptr)
+            {
+                return EmplaceBody(Body(*this, createInfo, NullEntityHandle));
+            }
 
-            const ObserverPointer<const b2Body> rawBodyHandle = body.GetRawHandle();
-            m_bodies[rawBodyHandle] = std::move(body);
+            Entity entity = m_scene->CreateEntity(entityBundle);
+            const ObserverPointer<Body> body = EmplaceBody(Body(*this, createInfo, entity.GetHandle()));
 
-            entity.AddComponent<components::RigidBody>(&m_bodies[rawBodyHandle]);
+            entity.AddComponent<components::RigidBody>(body);
 
-            return &m_bodies[rawBodyHandle];
+            return body;
         }
 
         auto World::DestroyBody(const ObserverPointer<const Body> body) noexcept -> void
         {
-            m_bodies.erase(body->GetRawHandle());
-            m_handle->DestroyBody(body->GetRawHandle());
+            Synchronise();
+
+            const ObserverPointer<b2Body> rawBodyHandle = body->GetRawHandle();
+            const uintptr_t bodySlot = rawBodyHandle->GetUserData().pointer;
+
+            for (ObserverPointer<const b2Fixture> fixture = rawBodyHandle->GetFixtureList(); fixture != nullptr; fixture = fixture->GetNext())
+            {
+                DiscardContactEvents(fixture);
+            }
+
+            m_handle->DestroyBody(rawBodyHandle);
+
+            m_collisionEnterCallbacks.erase(rawBodyHandle);
+            m_collisionExitCallbacks.erase(rawBodyHandle);
+            m_sensorEnterCallbacks.erase(rawBodyHandle);
+            m_sensorExitCallbacks.erase(rawBodyHandle);
+
+            if (bodySlot != 0u && bodySlot <= m_bodies.size())
+            {
+                m_bodies[bodySlot - 1u] = Body();
+                m_freeBodySlots.push_back(static_cast<usize>(bodySlot - 1u));
+            }
         }
 
         [[nodiscard]] auto World::LookupBody(const ObserverPointer<const b2Body> bodyHandle) -> ObserverPointer<Body>
         {
-            if (m_bodies.contains(bodyHandle))
+            const uintptr_t bodySlot = const_cast<ObserverPointer<b2Body>>(bodyHandle)->GetUserData().pointer;
+
+            if (bodySlot != 0u && bodySlot <= m_bodies.size() && m_bodies[bodySlot - 1u].GetRawHandle() == bodyHandle) [[likely]]
             {
-                return &m_bodies.at(bodyHandle);
+                return &m_bodies[bodySlot - 1u];
             }
             else
             {
@@ -257,9 +452,11 @@ namespace stardust
 
         [[nodiscard]] auto World::LookupBody(const ObserverPointer<const b2Body> bodyHandle) const -> ObserverPointer<const Body>
         {
-            if (m_bodies.contains(bodyHandle))
+            const uintptr_t bodySlot = const_cast<ObserverPointer<b2Body>>(bodyHandle)->GetUserData().pointer;
+
+            if (bodySlot != 0u && bodySlot <= m_bodies.size() && m_bodies[bodySlot - 1u].GetRawHandle() == bodyHandle) [[likely]]
             {
-                return &m_bodies.at(bodyHandle);
+                return &m_bodies[bodySlot - 1u];
             }
             else
             {
@@ -267,39 +464,63 @@ namespace stardust
             }
         }
 
-        [[nodiscard]] auto World::Raycast(const Vector2 origin, const Vector2 direction, const f32 distance, const CollisionLayer layerMask) const -> Optional<RaycastHit>
+        auto World::SetCollisionEnterCallback(const Body& body, const CollisionCallback& callback) -> void
         {
-            if (distance == 0.0f || direction == Vector2Zero) [[unlikely]]
-            {
-                return None;
-            }
-
-            const Vector2 normalisedDirection = glm::normalize(direction);
-            const Vector2 destinationPoint = origin + normalisedDirection * distance;
+            WaitForStep();
+            m_collisionEnterCallbacks[body.GetRawHandle()] = callback;
+        }
 
-            if (origin == destinationPoint)
-            {
-                return None;
-            }
+        auto World::SetCollisionExitCallback(const Body& body, const CollisionCallback& callback) -> void
+        {
+            WaitForStep();
+            m_collisionExitCallbacks[body.GetRawHandle()] = callback;
+        }
 
-            bool hasHitAnything = false;
-            RaycastHit raycastHitData{ };
+        auto World::SetSensorEnterCallback(const Body& body, const CollisionCallback& callback) -> void
+        {
+            WaitForStep();
+            m_sensorEnterCallbacks[body.GetRawHandle()] = callback;
+        }
 
-            RaycastCallback callback(origin, layerMask, hasHitAnything, raycastHitData, *this);
-            m_handle->RayCast(&callback, b2Vec2{ origin.x, origin.y }, b2Vec2{ destinationPoint.x, destinationPoint.y });
+        auto World::SetSensorExitCallback(const Body& body, const CollisionCallback& callback) -> void
+        {
+            WaitForStep();
+            m_sensorExitCallbacks[body.GetRawHandle()] = callback;
+        }
 
-            if (hasHitAnything)
+        [[nodiscard]] auto World::IterateContactEvents(const CollisionLayer layerMask) const -> Generator<const ContactEvent&>
+        {
+            for (const auto& contactEvent : m_contactEvents)
             {
-                return raycastHitData;
+                if (contactEvent.Involves(layerMask))
+                {
+                    co_yield contactEvent;
+                }
             }
-            else
+        }
+
+        [[nodiscard]] auto World::IterateContactEvents(const EntityHandle entityHandle) const -> Generator<const ContactEvent&>
+        {
+            for (const auto& contactEvent : m_contactEvents)
             {
-                return None;
+                if (contactEvent.Involves(entityHandle))
+                {
+                    co_yield contactEvent;
+                }
             }
         }
 
+        [[nodiscard]] auto World::Raycast(const Vector2 origin, const Vector2 direction, const f32 distance, const CollisionLayer layerMask) const -> Optional<RaycastHit>
+        {
+            WaitForStep();
+
+            return FindRaycastHit(origin, direction, distance, layerMask);
+        }
+
         [[nodiscard]] auto World::RaycastAll(const Vector2 origin, const Vector2 direction, const f32 distance, const CollisionLayer layerMask) const -> List<RaycastHit>
         {
+            WaitForStep();
+
             if (distance == 0.0f || direction == Vector2Zero) [[unlikely]]
             {
                 return { };
@@ -384,42 +605,22 @@ namespace stardust
 
         [[nodiscard]] auto World::QueryBox(const AABB& box, const CollisionLayer layerMask) const -> Optional<Collider>
         {
-            Collider hitFixture;
-            OverlapBoxCallback callback(hitFixture, layerMask, *this);
+            WaitForStep();
 
-            m_handle->QueryAABB(&callback, box);
-
-            if (hitFixture.IsValid())
-            {
-                return hitFixture;
-            }
-            else
-            {
-                return None;
-            }
+            return FindOverlappingCollider(box, layerMask);
         }
 
         [[nodiscard]] auto World::QueryBox(const Vector2 centre, const Vector2 halfSize, const CollisionLayer layerMask) const -> Optional<Collider>
         {
-            const AABB box(centre, halfSize);
-
-            Collider hitFixture;
-            OverlapBoxCallback callback(hitFixture, layerMask, *this);
+            WaitForStep();
 
-            m_handle->QueryAABB(&callback, box);
-
-            if (hitFixture.IsValid())
-            {
-                return hitFixture;
-            }
-            else
-            {
-                return None;
-            }
+            return FindOverlappingCollider(AABB(centre, halfSize), layerMask);
         }
 
         [[nodiscard]] auto World::QueryBoxAll(const AABB& box, const CollisionLayer layerMask) const -> List<Collider>
         {
+            WaitForStep();
+
             List<Collider> hitFixtures{ };
             OverlapBoxAllCallback callback(hitFixtures, layerMask, *this);
 
@@ -430,6 +631,8 @@ namespace stardust
 
         [[nodiscard]] auto World::QueryBoxAll(const Vector2 centre, const Vector2 halfSize, const CollisionLayer layerMask) const -> List<Collider>
         {
+            WaitForStep();
+
             const AABB box(centre, halfSize);
 
             List<Collider> hitFixtures{ };
@@ -440,8 +643,72 @@ namespace stardust
             return hitFixtures;
         }
 
+        auto World::RaycastBatch(const Slice<const RaycastQuery> queries, const Slice<Optional<RaycastHit>> results, const u32 threadCount) const -> usize
+        {
+            WaitForStep();
+
+            const usize queryCount = std::min(queries.size(), results.size());
+
+            ForEachQuery(queryCount, threadCount, [this, queries, results](const usize index)
+            {
+                const RaycastQuery& query = queries[index];
+
+                results[index] = FindRaycastHit(query.origin, query.direction, query.distance, query.layerMask);
+            });
+
+            return static_cast<usize>(std::count_if(std::cbegin(results), std::cbegin(results) + queryCount, [](const Optional<RaycastHit>& result) { return result.has_value(); }));
+        }
+
+        auto World::RaycastAnyBatch(const Slice<const RaycastQuery> queries, const Slice<bool> results, const u32 threadCount) const -> usize
+        {
+            WaitForStep();
+
+            const usize queryCount = std::min(queries.size(), results.size());
+
+            ForEachQuery(queryCount, threadCount, [this, queries, results](const usize index)
+            {
+                const RaycastQuery& query = queries[index];
+                results[index] = false;
+
+                if (query.distance == 0.0f || query.direction == Vector2Zero) [[unlikely]]
+                {
+                    return;
+                }
+
+                const Vector2 destinationPoint = query.origin + glm::normalize(query.direction) * query.distance;
+
+                if (query.origin == destinationPoint)
+                {
+                    return;
+                }
+
+                RaycastAnyCallback callback(query.layerMask, results[index]);
+                m_handle->RayCast(&callback, b2Vec2{ query.origin.x, query.origin.y }, b2Vec2{ destinationPoint.x, destinationPoint.y });
+            });
+
+            return static_cast<usize>(std::count(std::cbegin(results), std::cbegin(results) + queryCount, true));
+        }
+
+        auto World::QueryBoxBatch(const Slice<const BoxQuery> queries, const Slice<Optional<Collider>> results, const u32 threadCount) const -> usize
+        {
+            WaitForStep();
+
+            const usize queryCount = std::min(queries.size(), results.size());
+
+            ForEachQuery(queryCount, threadCount, [this, queries, results](const usize index)
+            {
+                const BoxQuery& query = queries[index];
+
+                results[index] = FindOverlappingCollider(query.box, query.layerMask);
+            });
+
+            return static_cast<usize>(std::count_if(std::cbegin(results), std::cbegin(results) + queryCount, [](const Optional<Collider>& result) { return result.has_value(); }));
+        }
+
         [[nodiscard]] auto World::GetGravity() const -> Vector2
         {
+            WaitForStep();
+
             const b2Vec2 gravity = m_handle->GetGravity();
 
             return Vector2{ gravity.x, gravity.y };
@@ -449,17 +716,269 @@ namespace stardust
 
         auto World::SetGravity(const Vector2 gravity) const -> void
         {
+            WaitForStep();
             m_handle->SetGravity(b2Vec2{ gravity.x, gravity.y });
         }
 
         [[nodiscard]] auto World::IsSleepingAllowed() const -> bool
         {
+            WaitForStep();
+
             return m_handle->GetAllowSleeping();
         }
 
         auto World::AllowSleeping(const bool allowSleeping) const -> void
         {
-            return m_handle->SetAllowSleeping(allowSleeping);
+            WaitForStep();
+            m_handle->SetAllowSleeping(allowSleeping);
+        }
+
+        [[nodiscard]] auto World::FindRaycastHit(const Vector2 origin, const Vector2 direction, const f32 distance, const CollisionLayer layerMask) const -> Optional<RaycastHit>
+        {
+            if (distance == 0.0f || direction == Vector2Zero) [[unlikely]]
+            {
+                return None;
+            }
+
+            const Vector2 normalisedDirection = glm::normalize(direction);
+            const Vector2 destinationPoint = origin + normalisedDirection * distance;
+
+            if (origin == destinationPoint)
+            {
+                return None;
+            }
+
+            bool hasHitAnything = false;
+            RaycastHit raycastHitData{ };
+
+            RaycastCallback callback(origin, layerMask, hasHitAnything, raycastHitData, *this);
+            m_handle->RayCast(&callback, b2Vec2{ origin.x, origin.y }, b2Vec2{ destinationPoint.x, destinationPoint.y });
+
+            if (hasHitAnything)
+            {
+                return raycastHitData;
+            }
+            else
+            {
+                return None;
+            }
+        }
+
+        [[nodiscard]] auto World::FindOverlappingCollider(const AABB& box, const CollisionLayer layerMask) const -> Optional<Collider>
+        {
+            Collider hitFixture;
+            OverlapBoxCallback callback(hitFixture, layerMask, *this);
+
+            m_handle->QueryAABB(&callback, box);
+
+            if (hitFixture.IsValid())
+            {
+                return hitFixture;
+            }
+            else
+            {
+                return None;
+            }
+        }
+
+        auto World::EmplaceBody(Body&& body) -> ObserverPointer<Body>
+        {
+            usize bodySlot = m_bodies.size();
+
+            if (m_freeBodySlots.empty())
+            {
+                m_bodies.push_back(std::move(body));
+            }
+            else
+            {
+                bodySlot = m_freeBodySlots.back();
+                m_freeBodySlots.pop_back();
+
+                m_bodies[bodySlot] = std::move(body);
+            }
+
+            Body& emplacedBody = m_bodies[bodySlot];
+
+            if (emplacedBody.IsValid())
+            {
+                emplacedBody.GetRawHandle()->GetUserData().pointer = static_cast<uintptr_t>(bodySlot + 1u);
+            }
+
+            return &emplacedBody;
+        }
+
+        auto World::RunStepThread(const std::stop_token stopToken) -> void
+        {
+            while (!stopToken.stop_requested())
+            {
+                std::unique_lock lock(m_stepMutex);
+
+                if (!m_stepCondition.wait(lock, stopToken, [this] { return m_isStepPending; }))
+                {
+                    break;
+                }
+
+                const f32 timestep = m_pendingTimestep;
+                lock.unlock();
+
+                m_handle->Step(timestep, static_cast<i32>(s_velocityIterations), static_cast<i32>(s_positionIterations));
+
+                lock.lock();
+                m_isStepPending = false;
+                lock.unlock();
+
+                m_stepCondition.notify_all();
+            }
+        }
+
+        auto World::CaptureTransformSnapshots() -> void
+        {
+            m_currentTransformSnapshotIndex = 1u - m_currentTransformSnapshotIndex;
+
+            for (auto& body : m_bodies)
+            {
+                if (!body.IsValid())
+                {
+                    continue;
+                }
+
+                body.m_transformSnapshots[m_currentTransformSnapshotIndex] = BodyTransform{
+                    .position = body.GetPosition(),
+                    .rotation = body.GetRotation(),
+                };
+            }
+        }
+
+        auto World::RecordContactEvent(const ObserverPointer<b2Contact> contact, const ContactEvent::Type type) -> void
+        {
+            const ObserverPointer<b2Fixture> firstFixture = contact->GetFixtureA();
+            const ObserverPointer<b2Fixture> secondFixture = contact->GetFixtureB();
+
+            ContactEvent contactEvent{
+                .type = type,
+                .isSensorContact = firstFixture->IsSensor() || secondFixture->IsSensor(),
+                .firstFixture = firstFixture,
+                .secondFixture = secondFixture,
+                .firstLayers = firstFixture->GetFilterData().categoryBits,
+                .secondLayers = secondFixture->GetFilterData().categoryBits,
+                .firstEntityHandle = NullEntityHandle,
+                .secondEntityHandle = NullEntityHandle,
+            };
+
+            if (m_handle->IsLocked())
+            {
+                m_pendingContactEvents.push_back(contactEvent);
+
+                return;
+            }
+
+            ResolveEntityHandles(contactEvent);
+            InvokeContactCallback(contactEvent);
+
+            contactEvent.firstFixture = nullptr;
+            contactEvent.secondFixture = nullptr;
+
+            m_pendingContactEvents.push_back(contactEvent);
+        }
+
+        auto World::FlushContactEvents() -> void
+        {
+            std::swap(m_contactEvents, m_pendingContactEvents);
+            m_pendingContactEvents.clear();
+
+            for (auto& contactEvent : m_contactEvents)
+            {
+                if (contactEvent.firstFixture != nullptr)
+                {
+                    ResolveEntityHandles(contactEvent);
+                }
+            }
+
+            const bool hasCallbacks = !m_collisionEnterCallbacks.empty() || !m_collisionExitCallbacks.empty()
+                || !m_sensorEnterCallbacks.empty() || !m_sensorExitCallbacks.empty();
+
+            if (!hasCallbacks)
+            {
+                return;
+            }
+
+            List<ContactEvent> contactEvents = std::exchange(m_contactEvents, { });
+            m_isDispatchingContactEvents = true;
+
+            for (const auto& contactEvent : contactEvents)
+            {
+                if (contactEvent.firstFixture == nullptr || WasDestroyedDuringDispatch(contactEvent))
+                {
+                    continue;
+                }
+
+                InvokeContactCallback(contactEvent);
+            }
+
+            m_isDispatchingContactEvents = false;
+
+            if (!m_destroyedFixtures.empty())
+            {
+                std::erase_if(contactEvents, [this](const ContactEvent& contactEvent) { return WasDestroyedDuringDispatch(contactEvent); });
+                m_destroyedFixtures.clear();
+            }
+
+            m_contactEvents = std::move(contactEvents);
+        }
+
+        auto World::ResolveEntityHandles(ContactEvent& contactEvent) const -> void
+        {
+            if (const ObserverPointer<const Body> firstBody = LookupBody(contactEvent.firstFixture->GetBody());
+                firstBody != nullptr)
+            {
+                contactEvent.firstEntityHandle = firstBody->GetAssociatedEntityHandle();
+            }
+
+            if (const ObserverPointer<const Body> secondBody = LookupBody(contactEvent.secondFixture->GetBody());
+                secondBody != nullptr)
+            {
+                contactEvent.secondEntityHandle = secondBody->GetAssociatedEntityHandle();
+            }
+        }
+
+        auto World::InvokeContactCallback(const ContactEvent& contactEvent) -> void
+        {
+            const HashMap<const b2Body*, CollisionCallback>& callbacks = contactEvent.isSensorContact
+                ? (contactEvent.type == ContactEvent::Type::Begin ? m_sensorEnterCallbacks : m_sensorExitCallbacks)
+                : (contactEvent.type == ContactEvent::Type::Begin ? m_collisionEnterCallbacks : m_collisionExitCallbacks);
+
+            if (callbacks.empty())
+            {
+                return;
+            }
+
+            if (const auto callbackLocation = callbacks.find(contactEvent.firstFixture->GetBody());
+                callbackLocation != std::cend(callbacks))
+            {
+                const CollisionCallback callback = callbackLocation->second;
+                callback(Collider(contactEvent.secondFixture, *this));
+            }
+        }
+
+        auto World::DiscardContactEvents(const ObserverPointer<const b2Fixture> fixture) -> void
+        {
+            std::erase_if(m_contactEvents, [fixture](const ContactEvent& contactEvent)
+            {
+                return contactEvent.firstFixture == fixture || contactEvent.secondFixture == fixture;
+            });
+
+            if (m_isDispatchingContactEvents)
+            {
+                m_destroyedFixtures.push_back(fixture);
+            }
+        }
+
+        [[nodiscard]] auto World::WasDestroyedDuringDispatch(const ContactEvent& contactEvent) const -> bool
+        {
+            return std::ranges::any_of(m_destroyedFixtures, [&contactEvent](const ObserverPointer<const b2Fixture> fixture)
+            {
+                return contactEvent.firstFixture == fixture || contactEvent.secondFixture == fixture;
+            });
         }
     }
 }
@@ -4,16 +4,43 @@ namespace stardust
 {
     [[nodiscard]] auto GlobalResources::HasKey(const StringView key) -> bool
     {
-        return m_data.contains(key.data());
+        const auto keyIndexLocation = m_keyIndices.find(String(key));
+
+        return keyIndexLocation != std::cend(m_keyIndices) && m_slots[keyIndexLocation->second].data != nullptr;
     }
 
     auto GlobalResources::Remove(const StringView key) -> void
     {
-        m_data.erase(key.data());
+        if (const auto keyIndexLocation = m_keyIndices.find(String(key));
+            keyIndexLocation != std::cend(m_keyIndices))
+        {
+            ResetSlot(m_slots[keyIndexLocation->second]);
+        }
     }
 
     auto GlobalResources::Clear() -> void
     {
-        m_data.clear();
+        for (ResourceSlot& slot : m_slots)
+        {
+            ResetSlot(slot);
+        }
+    }
+
+    [[nodiscard]] auto GlobalResources::InternKey(const StringView name) -> u32
+    {
+        const auto [keyIndexLocation, wasInserted] = m_keyIndices.try_emplace(String(name), static_cast<u32>(m_slots.size()));
+
+        if (wasInserted)
+        {
+            m_slots.emplace_back();
+        }
+
+        return keyIndexLocation->second;
+    }
+
+    auto GlobalResources::ResetSlot(ResourceSlot& slot) noexcept -> void
+    {
+        slot.data = nullptr;
+        slot.typeTag = nullptr;
     }
 }
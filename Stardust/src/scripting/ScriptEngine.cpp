@@ -1,14 +1,96 @@
 #include "stardust/scripting/ScriptEngine.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <utility>
+
 #include <lua/lua.h>
 
 #include "stardust/application/Application.h"
 #include "stardust/filesystem/vfs/VirtualFilesystem.h"
-#include "stardust/types/Primitives.h"
+#include "stardust/filesystem/Filesystem.h"
+#include "stardust/utility/hash/Hash.h"
 
 namespace stardust
 {
+    namespace
+    {
+        [[nodiscard]] auto GetBytecodeCacheFilePrefix(const StringView scriptFilepath) -> String
+        {
+            return std::format("{:016x}-", hash::FNV1a(scriptFilepath));
+        }
+
+        [[nodiscard]] auto GetBytecodeCacheFilename(const StringView scriptFilepath, const List<ubyte>& scriptData) -> String
+        {
+            return std::format("{}{:016x}.luac", GetBytecodeCacheFilePrefix(scriptFilepath), hash::FNV1a(scriptData, hash::FNV1a(scriptFilepath)));
+        }
+
+        auto RemoveStaleBytecode(const StringView directory, const StringView scriptFilepath, const StringView currentFilename) -> void
+        {
+            const String filePrefix = GetBytecodeCacheFilePrefix(scriptFilepath);
+
+            for (const String& filename : filesystem::GetAllFiles(directory))
+            {
+                if (filename.starts_with(filePrefix) && filename != currentFilename)
+                {
+                    [[maybe_unused]] const Status removeStatus = filesystem::RemoveFile(std::format("{}{}{}", directory, filesystem::GetDirectorySeparator(), filename));
+                }
+            }
+        }
+
+        [[nodiscard]] auto AsScriptView(const List<ubyte>& scriptData) noexcept -> StringView
+        {
+            return StringView(reinterpret_cast<const char*>(scriptData.data()), scriptData.size());
+        }
+
+        auto WriteBytecode(lua_State* const, const void* const data, const usize size, void* const userData) -> i32
+        {
+            List<ubyte>& bytecode = *static_cast<List<ubyte>*>(userData);
+            const ubyte* const bytes = static_cast<const ubyte*>(data);
+
+            bytecode.insert(std::end(bytecode), bytes, bytes + size);
+
+            return 0;
+        }
+
+        [[nodiscard]] auto OnScriptError(lua_State* const luaState, sol::protected_function_result result) -> sol::protected_function_result
+        {
+        #ifdef NDEBUG
+            return sol::script_pass_on_error(luaState, std::move(result));
+        #else
+            return sol::script_throw_on_error(luaState, std::move(result));
+        #endif
+        }
+    }
+
+    [[nodiscard]] auto ScriptEngine::IsPrecompiledChunk(const Slice<const ubyte> scriptData) noexcept -> bool
+    {
+        constexpr usize SignatureLength = sizeof(LUA_SIGNATURE) - 1u;
+
+        return scriptData.size() >= SignatureLength && std::memcmp(scriptData.data(), LUA_SIGNATURE, SignatureLength) == 0;
+    }
+
     auto ScriptEngine::Initialise(Application& application) -> void
+    {
+        LoadCoreFunctions();
+
+        LoadApplicationFunctions(application);
+        LoadGraphicsFunctions(application);
+        LoadAnimationFunctions();
+        LoadUIFunctions();
+        LoadECSFunctions(application);
+    }
+
+    auto ScriptEngine::InitialiseWorker() -> void
+    {
+        LoadCoreFunctions();
+    }
+
+    auto ScriptEngine::LoadCoreFunctions() -> void
     {
         m_luaState.open_libraries(
             sol::lib::base,
@@ -21,11 +103,8 @@ namespace stardust
             sol::lib::utf8
         );
 
-        LoadApplicationFunctions(application);
+        LoadLoggingFunctions();
         LoadMathFunctions();
-        LoadGraphicsFunctions(application);
-        LoadAnimationFunctions();
-        LoadUIFunctions();
 
         LoadScript(R"LUA(
             function create_set(values)
@@ -42,30 +121,229 @@ namespace stardust
 
     auto ScriptEngine::LoadScript(const StringView script) -> Status
     {
-        const sol::protected_function_result scriptResult = m_luaState.safe_script(
-            script,
-    #ifdef NDEBUG
-            sol::script_pass_on_error
-    #else
-            sol::script_throw_on_error
-    #endif
-        );
+        const sol::protected_function_result scriptResult = m_luaState.safe_script(script, &OnScriptError);
 
         return scriptResult.valid() ? Status::Success : Status::Fail;
     }
 
     [[nodiscard]] auto ScriptEngine::LoadScriptFile(const StringView scriptFilepath) -> Status
     {
-        auto scriptReadResult = vfs::ReadFileString(scriptFilepath);
+        auto scriptReadResult = vfs::ReadFileBytes(scriptFilepath);
 
         if (scriptReadResult.is_err())
         {
             return Status::Fail;
         }
 
-        const String script = std::move(scriptReadResult).unwrap();
-        
-        return LoadScript(script);
+        const List<ubyte> scriptData = std::move(scriptReadResult).unwrap();
+        const String chunkName = std::format("@{}", scriptFilepath);
+
+        if (IsPrecompiledChunk(scriptData))
+        {
+            const sol::load_mode loadMode = m_isPrecompiledScriptLoadingEnabled || vfs::IsInPackArchive(scriptFilepath)
+                ? sol::load_mode::binary
+                : sol::load_mode::text;
+
+            return RunScript(AsScriptView(scriptData), chunkName, loadMode);
+        }
+
+        if (m_bytecodeCacheDirectory.empty())
+        {
+            return RunScript(AsScriptView(scriptData), chunkName, sol::load_mode::text);
+        }
+
+        const String bytecodeCacheFilename = GetBytecodeCacheFilename(scriptFilepath, scriptData);
+        const String bytecodeCacheFilepath = std::format("{}{}{}", m_bytecodeCacheDirectory, filesystem::GetDirectorySeparator(), bytecodeCacheFilename);
+
+        if (filesystem::DoesPathExist(bytecodeCacheFilepath))
+        {
+            if (auto bytecodeReadResult = filesystem::ReadFileBytes(bytecodeCacheFilepath);
+                bytecodeReadResult.is_ok())
+            {
+                const List<ubyte> cachedBytecode = std::move(bytecodeReadResult).unwrap();
+
+                if (IsPrecompiledChunk(cachedBytecode))
+                {
+                    if (const sol::load_result chunk = m_luaState.load(AsScriptView(cachedBytecode), chunkName, sol::load_mode::binary);
+                        chunk.valid())
+                    {
+                        return RunChunk(chunk);
+                    }
+                }
+            }
+        }
+
+        List<ubyte> bytecode{ };
+
+        if (CompileScript(AsScriptView(scriptData), chunkName, bytecode) != Status::Success)
+        {
+            return RunScript(AsScriptView(scriptData), chunkName, sol::load_mode::text);
+        }
+
+        if (m_isBytecodeCacheReadOnly)
+        {
+            return RunScript(AsScriptView(bytecode), chunkName, sol::load_mode::binary);
+        }
+
+        if (filesystem::DoesPathExist(m_bytecodeCacheDirectory))
+        {
+            RemoveStaleBytecode(m_bytecodeCacheDirectory, scriptFilepath, bytecodeCacheFilename);
+        }
+
+        if (filesystem::DoesPathExist(m_bytecodeCacheDirectory) || filesystem::CreateDirectory(m_bytecodeCacheDirectory) == Status::Success)
+        {
+            [[maybe_unused]] const Status writeStatus = filesystem::WriteBytesToFile(bytecodeCacheFilepath, bytecode);
+        }
+
+        return RunScript(AsScriptView(bytecode), chunkName, sol::load_mode::binary);
+    }
+
+    [[nodiscard]] auto ScriptEngine::CompileScript(const StringView script, const StringView chunkName, List<ubyte>& bytecode) -> Status
+    {
+        const sol::load_result chunk = m_luaState.load(script, String(chunkName), sol::load_mode::text);
+
+        if (!chunk.valid())
+        {
+            return Status::Fail;
+        }
+
+        const sol::protected_function chunkFunction = chunk;
+        lua_State* const luaState = m_luaState.lua_state();
+
+        bytecode.clear();
+
+        chunkFunction.push();
+        const i32 dumpStatus = lua_dump(luaState, WriteBytecode, &bytecode, 0);
+        lua_pop(luaState, 1);
+
+        return dumpStatus == 0 && !bytecode.empty() ? Status::Success : Status::Fail;
+    }
+
+    auto ScriptEngine::SetGarbageCollectionMode(const GarbageCollectionMode garbageCollectionMode) -> void
+    {
+        lua_State* const luaState = m_luaState.lua_state();
+
+        switch (garbageCollectionMode)
+        {
+        case GarbageCollectionMode::Automatic:
+            lua_gc(luaState, LUA_GCINC, 0, 0, 0);
+            lua_gc(luaState, LUA_GCRESTART);
+
+            break;
+
+        case GarbageCollectionMode::Incremental:
+            lua_gc(luaState, LUA_GCINC, 0, 0, 0);
+            lua_gc(luaState, LUA_GCSTOP);
+
+            break;
+
+        case GarbageCollectionMode::Generational:
+            lua_gc(luaState, LUA_GCGEN, 0, 0);
+            lua_gc(luaState, LUA_GCSTOP);
+
+            break;
+        }
+
+        m_garbageCollectionMode = garbageCollectionMode;
+
+        m_previousHeapSize = GetHeapSize();
+        m_heapSizeAfterCollection = m_previousHeapSize;
+        m_isCollectionCycleActive = false;
+    }
+
+    auto ScriptEngine::CollectGarbage(const f64 timeBudget) -> void
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const Clock::time_point startTime = Clock::now();
+        const auto budgetDuration = std::chrono::duration<f64>(timeBudget);
+
+        m_garbageCollectionStats.stepCount = 0u;
+
+        if (m_garbageCollectionMode == GarbageCollectionMode::Automatic)
+        {
+            m_garbageCollectionStats.collectionTime = 0.0;
+            m_garbageCollectionStats.heapSize = GetHeapSize();
+
+            return;
+        }
+
+        lua_State* const luaState = m_luaState.lua_state();
+        const bool isIncremental = m_garbageCollectionMode == GarbageCollectionMode::Incremental;
+
+        const usize heapSize = GetHeapSize();
+        const usize allocatedKilobytes = heapSize > m_previousHeapSize
+            ? (heapSize - m_previousHeapSize) / 1'024u
+            : 0u;
+
+        const f64 collectionThreshold = static_cast<f64>(m_heapSizeAfterCollection) * (isIncremental ? IncrementalCollectionPause : GenerationalCollectionPause);
+        const bool isOverCollectionDebt = static_cast<f64>(heapSize) >= collectionThreshold * MaxCollectionDebt;
+        const bool hasCollectionBudget = isIncremental || timeBudget > 0.0 || isOverCollectionDebt;
+        const bool isCollectionDue = hasCollectionBudget && (m_isCollectionCycleActive || static_cast<f64>(heapSize) >= collectionThreshold);
+
+        bool hasCompletedCycle = false;
+
+        if (isCollectionDue)
+        {
+            hasCompletedCycle = lua_gc(luaState, LUA_GCSTEP, 0) != 0;
+            ++m_garbageCollectionStats.stepCount;
+
+            if (isIncremental)
+            {
+                m_isCollectionCycleActive = !hasCompletedCycle;
+
+                if (!hasCompletedCycle && allocatedKilobytes > 0u && isOverCollectionDebt)
+                {
+                    hasCompletedCycle = lua_gc(luaState, LUA_GCSTEP, static_cast<i32>(std::min<usize>(allocatedKilobytes, std::numeric_limits<i32>::max()))) != 0;
+                    ++m_garbageCollectionStats.stepCount;
+                }
+
+                while (!hasCompletedCycle && Clock::now() - startTime < budgetDuration)
+                {
+                    hasCompletedCycle = lua_gc(luaState, LUA_GCSTEP, 0) != 0;
+                    ++m_garbageCollectionStats.stepCount;
+                }
+            }
+        }
+
+        m_previousHeapSize = GetHeapSize();
+
+        if (hasCompletedCycle || (!isIncremental && isCollectionDue))
+        {
+            ++m_garbageCollectionStats.completedCycleCount;
+
+            m_heapSizeAfterCollection = m_previousHeapSize;
+            m_isCollectionCycleActive = false;
+        }
+
+        m_garbageCollectionStats.collectionTime = std::chrono::duration<f64>(Clock::now() - startTime).count();
+        m_garbageCollectionStats.heapSize = m_previousHeapSize;
+    }
+
+    [[nodiscard]] auto ScriptEngine::GetHeapSize() const -> usize
+    {
+        lua_State* const luaState = m_luaState.lua_state();
+
+        return static_cast<usize>(lua_gc(luaState, LUA_GCCOUNT)) * 1'024u + static_cast<usize>(lua_gc(luaState, LUA_GCCOUNTB));
+    }
+
+    [[nodiscard]] auto ScriptEngine::RunScript(const StringView script, const String& chunkName, const sol::load_mode loadMode) -> Status
+    {
+        const sol::protected_function_result scriptResult = m_luaState.safe_script(script, &OnScriptError, chunkName, loadMode);
+
+        return scriptResult.valid() ? Status::Success : Status::Fail;
+    }
+
+    [[nodiscard]] auto ScriptEngine::RunChunk(const sol::protected_function& chunk) -> Status
+    {
+        sol::protected_function_result chunkResult = chunk();
+
+        if (!chunkResult.valid())
+        {
+            chunkResult = OnScriptError(m_luaState.lua_state(), std::move(chunkResult));
+        }
+
+        return chunkResult.valid() ? Status::Success : Status::Fail;
     }
 }
 
@@ -0,0 +1,114 @@
+#include "stardust/scripting/ScriptFloatArray.h"
+
+#include <algorithm>
+
+namespace stardust
+{
+    namespace
+    {
+        [[nodiscard]] auto GetArrayHeader(lua_State* const luaState) noexcept -> ScriptFloatArray::Header*
+        {
+            return static_cast<ScriptFloatArray::Header*>(lua_touserdata(luaState, 1));
+        }
+
+        [[nodiscard]] auto GetArrayData(ScriptFloatArray::Header* const header) noexcept -> f32*
+        {
+            return reinterpret_cast<f32*>(header + 1);
+        }
+
+        auto IndexArray(lua_State* const luaState) -> i32
+        {
+            ScriptFloatArray::Header* const header = GetArrayHeader(luaState);
+
+            i32 isInteger = 0;
+            const lua_Integer index = lua_tointegerx(luaState, 2, &isInteger);
+
+            if (isInteger == 0 || index < 1 || index > static_cast<lua_Integer>(header->size))
+            {
+                lua_pushnil(luaState);
+            }
+            else
+            {
+                lua_pushnumber(luaState, static_cast<lua_Number>(GetArrayData(header)[index - 1]));
+            }
+
+            return 1;
+        }
+
+        auto NewIndexArray(lua_State* const luaState) -> i32
+        {
+            ScriptFloatArray::Header* const header = GetArrayHeader(luaState);
+
+            const lua_Integer index = luaL_checkinteger(luaState, 2);
+            const lua_Number value = luaL_checknumber(luaState, 3);
+
+            if (index < 1 || index > static_cast<lua_Integer>(header->size))
+            {
+                return luaL_error(luaState, "float array index %d out of range [1, %d]", static_cast<i32>(index), static_cast<i32>(header->size));
+            }
+
+            GetArrayData(header)[index - 1] = static_cast<f32>(value);
+
+            return 0;
+        }
+
+        auto GetArrayLength(lua_State* const luaState) -> i32
+        {
+            lua_pushinteger(luaState, static_cast<lua_Integer>(GetArrayHeader(luaState)->size));
+
+            return 1;
+        }
+    }
+
+    ScriptFloatArray::ScriptFloatArray(lua_State* const luaState, const u32 capacity)
+    {
+        Initialise(luaState, capacity);
+    }
+
+    auto ScriptFloatArray::Initialise(lua_State* const luaState, const u32 capacity) -> void
+    {
+        void* const arrayMemory = lua_newuserdatauv(luaState, sizeof(Header) + sizeof(f32) * capacity, 0);
+
+        if (luaL_newmetatable(luaState, MetatableName) != 0)
+        {
+            lua_pushcfunction(luaState, &IndexArray);
+            lua_setfield(luaState, -2, "__index");
+
+            lua_pushcfunction(luaState, &NewIndexArray);
+            lua_setfield(luaState, -2, "__newindex");
+
+            lua_pushcfunction(luaState, &GetArrayLength);
+            lua_setfield(luaState, -2, "__len");
+        }
+
+        lua_setmetatable(luaState, -2);
+
+        m_header = static_cast<Header*>(arrayMemory);
+        m_header->size = 0u;
+        m_header->capacity = capacity;
+        m_data = GetArrayData(m_header);
+
+        m_userdata = sol::userdata(luaState, -1);
+        lua_pop(luaState, 1);
+    }
+
+    auto ScriptFloatArray::Reserve(lua_State* const luaState, const u32 capacity) -> void
+    {
+        if (IsValid() && capacity <= GetCapacity())
+        {
+            return;
+        }
+
+        const u32 previousSize = GetSize();
+        const f32* const previousData = m_data;
+        const sol::userdata previousUserdata = m_userdata;
+
+        Initialise(luaState, capacity);
+
+        if (previousData != nullptr)
+        {
+            std::copy_n(previousData, previousSize, m_data);
+            m_header->size = previousSize;
+        }
+    }
+}
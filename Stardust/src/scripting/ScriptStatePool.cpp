@@ -0,0 +1,267 @@
+#include "stardust/scripting/ScriptStatePool.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include <variant>
+
+#include "stardust/application/Application.h"
+#include "stardust/debug/logging/Logging.h"
+
+namespace stardust
+{
+    [[nodiscard]] auto ScriptStatePool::GetDefaultStateCount() noexcept -> u32
+    {
+        const u32 hardwareThreadCount = static_cast<u32>(std::thread::hardware_concurrency());
+
+        return std::max(hardwareThreadCount, 2u) - 1u;
+    }
+
+    ScriptStatePool::ScriptStatePool(Application& application, const u32 stateCount)
+    {
+        Initialise(application, stateCount);
+    }
+
+    ScriptStatePool::~ScriptStatePool() noexcept
+    {
+        Shutdown();
+    }
+
+    auto ScriptStatePool::Initialise(Application& application, const u32 stateCount) -> void
+    {
+        Shutdown();
+
+        m_workers.reserve(stateCount);
+
+        for (u32 i = 0u; i < stateCount; ++i)
+        {
+            UniquePointer<Worker> worker = std::make_unique<Worker>();
+
+            worker->scriptEngine.InitialiseWorker();
+            worker->scriptEngine.SetBytecodeCacheDirectory(application.GetScriptEngine().GetBytecodeCacheDirectory());
+            worker->scriptEngine.SetBytecodeCacheReadOnly(true);
+            worker->scriptEngine.SetPrecompiledScriptLoadingEnabled(application.GetScriptEngine().IsPrecompiledScriptLoadingEnabled());
+            LoadPoolFunctions(worker->scriptEngine, i);
+
+            m_workers.push_back(std::move(worker));
+        }
+
+        for (UniquePointer<Worker>& worker : m_workers)
+        {
+            worker->thread = std::jthread([this, worker = worker.get()](const std::stop_token stopToken) { RunWorkerThread(*worker, stopToken); });
+        }
+    }
+
+    auto ScriptStatePool::Shutdown() -> void
+    {
+        for (UniquePointer<Worker>& worker : m_workers)
+        {
+            worker->thread.request_stop();
+            worker->taskCondition.notify_all();
+        }
+
+        m_workers.clear();
+
+        m_pendingTaskCount.store(0u, std::memory_order::release);
+        m_pendingTaskCount.notify_all();
+
+        {
+            const std::scoped_lock<std::mutex> lock(m_messageMutex);
+            m_messages.clear();
+        }
+    }
+
+    auto ScriptStatePool::LoadScript(const StringView script) -> void
+    {
+        for (u32 i = 0u; i < GetStateCount(); ++i)
+        {
+            Submit(i, [script = String(script)](ScriptEngine& scriptEngine) { scriptEngine.LoadScript(script); });
+        }
+    }
+
+    auto ScriptStatePool::LoadScriptFile(const StringView scriptFilepath) -> void
+    {
+        for (u32 i = 0u; i < GetStateCount(); ++i)
+        {
+            Submit(
+                i,
+                [scriptFilepath = String(scriptFilepath)](ScriptEngine& scriptEngine)
+                {
+                    if (scriptEngine.LoadScriptFile(scriptFilepath) != Status::Success)
+                    {
+                        Log::EngineError("Failed to load script file {} into script state pool.", scriptFilepath);
+                    }
+                }
+            );
+        }
+    }
+
+    auto ScriptStatePool::Submit(const u32 stateIndex, Task&& task) -> void
+    {
+        if (m_workers.empty())
+        {
+            return;
+        }
+
+        Worker& worker = *m_workers[stateIndex % GetStateCount()];
+        m_pendingTaskCount.fetch_add(1u, std::memory_order::acq_rel);
+
+        {
+            const std::scoped_lock<std::mutex> lock(worker.taskMutex);
+            worker.tasks.push(std::move(task));
+        }
+
+        worker.taskCondition.notify_one();
+    }
+
+    auto ScriptStatePool::Send(const u32 stateIndex, Message message) -> void
+    {
+        Submit(
+            stateIndex,
+            [message = std::move(message)](ScriptEngine& scriptEngine)
+            {
+                sol::state& luaState = scriptEngine.GetState();
+                const sol::protected_function messageHandler = luaState[message.channel];
+
+                if (!messageHandler.valid())
+                {
+                    Log::EngineWarn("No script function found for message channel \"{}\".", message.channel);
+
+                    return;
+                }
+
+                List<sol::object> arguments{ };
+                arguments.reserve(message.values.size());
+
+                for (const Value& value : message.values)
+                {
+                    arguments.push_back(std::visit([&luaState](const auto& argument) { return sol::make_object(luaState, argument); }, value));
+                }
+
+                if (const sol::protected_function_result messageResult = messageHandler(sol::as_args(arguments));
+                    !messageResult.valid())
+                {
+                    const sol::error messageError = messageResult;
+                    Log::EngineError("Failed to handle script message \"{}\": {}", message.channel, messageError.what());
+                }
+            }
+        );
+    }
+
+    auto ScriptStatePool::Broadcast(const Message& message) -> void
+    {
+        for (u32 i = 0u; i < GetStateCount(); ++i)
+        {
+            Send(i, message);
+        }
+    }
+
+    auto ScriptStatePool::PushMessage(Message&& message) -> void
+    {
+        const std::scoped_lock<std::mutex> lock(m_messageMutex);
+        m_messages.push_back(std::move(message));
+    }
+
+    [[nodiscard]] auto ScriptStatePool::ReceiveMessages() -> List<Message>
+    {
+        List<Message> messages{ };
+
+        {
+            const std::scoped_lock<std::mutex> lock(m_messageMutex);
+            std::swap(messages, m_messages);
+        }
+
+        return messages;
+    }
+
+    auto ScriptStatePool::Flush() -> void
+    {
+        for (u32 pendingTaskCount = GetPendingTaskCount(); pendingTaskCount != 0u; pendingTaskCount = GetPendingTaskCount())
+        {
+            m_pendingTaskCount.wait(pendingTaskCount, std::memory_order::acquire);
+        }
+    }
+
+    auto ScriptStatePool::LoadPoolFunctions(ScriptEngine& scriptEngine, const u32 stateIndex) -> void
+    {
+        auto poolNamespace = scriptEngine.GetState()["script_pool"].get_or_create<Table>();
+
+        poolNamespace["state_index"] = stateIndex;
+        poolNamespace.set_function("state_count", [this]() -> u32 { return GetStateCount(); });
+
+        poolNamespace.set_function(
+            "post",
+            [this, stateIndex](const String& channel, const sol::variadic_args values)
+            {
+                Message message{
+                    .channel = channel,
+                    .values = { },
+                    .stateIndex = stateIndex,
+                };
+
+                message.values.reserve(values.size());
+
+                for (const auto& value : values)
+                {
+                    switch (value.get_type())
+                    {
+                    case sol::type::boolean:
+                        message.values.emplace_back(value.as<bool>());
+                        break;
+
+                    case sol::type::number:
+                        message.values.emplace_back(value.as<f64>());
+                        break;
+
+                    case sol::type::string:
+                        message.values.emplace_back(value.as<String>());
+                        break;
+
+                    default:
+                        throw sol::error("script_pool.post only accepts booleans, numbers and strings");
+                    }
+                }
+
+                PushMessage(std::move(message));
+            }
+        );
+    }
+
+    auto ScriptStatePool::RunWorkerThread(Worker& worker, const std::stop_token stopToken) -> void
+    {
+        while (!stopToken.stop_requested())
+        {
+            Task task;
+
+            {
+                std::unique_lock<std::mutex> lock(worker.taskMutex);
+
+                if (!worker.taskCondition.wait(lock, stopToken, [&worker] { return !worker.tasks.empty(); }))
+                {
+                    return;
+                }
+
+                task = std::move(worker.tasks.front());
+                worker.tasks.pop();
+            }
+
+            try
+            {
+                task(worker.scriptEngine);
+            }
+            catch (const std::exception& error)
+            {
+                Log::EngineError("Script state pool task failed: {}", error.what());
+            }
+            catch (...)
+            {
+                Log::EngineError("Script state pool task failed with an unknown error.");
+            }
+
+            if (m_pendingTaskCount.fetch_sub(1u, std::memory_order::acq_rel) == 1u)
+            {
+                m_pendingTaskCount.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,192 @@
+#include "stardust/scripting/ScriptTransformView.h"
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+
+#include "stardust/debug/logging/Logging.h"
+#include "stardust/ecs/components/TransformComponent.h"
+#include "stardust/types/MathTypes.h"
+
+namespace stardust
+{
+    ScriptTransformView::ScriptTransformView(lua_State* const luaState)
+    {
+        Initialise(luaState);
+    }
+
+    auto ScriptTransformView::Initialise(lua_State* const luaState) -> void
+    {
+        m_luaState = luaState;
+
+        for (ScriptFloatArray& fieldArray : m_fieldArrays)
+        {
+            fieldArray.Initialise(m_luaState, DefaultChunkSize);
+        }
+
+        m_entities.clear();
+    }
+
+    auto ScriptTransformView::Gather(const EntityRegistry& registry) -> u32
+    {
+        const auto transformView = registry.GetHandle().view<const components::Transform>();
+
+        m_entities.assign(std::cbegin(transformView), std::cend(transformView));
+
+        const u32 entityCount = GetEntityCount();
+        ReserveArrays(entityCount);
+        ReadTransforms(registry, 0u, entityCount);
+        ResizeArrays(entityCount);
+
+        return entityCount;
+    }
+
+    auto ScriptTransformView::Scatter(EntityRegistry& registry) const -> void
+    {
+        const u32 entityCount = std::min(GetEntityCount(), GetFieldArray(Field::TranslationX).GetSize());
+
+        WriteTransforms(registry, 0u, entityCount);
+    }
+
+    [[nodiscard]] auto ScriptTransformView::ForEach(EntityRegistry& registry, const sol::protected_function& function, const u32 chunkSize) -> Status
+    {
+        if (m_isIterating)
+        {
+            Log::EngineError("Cannot iterate transforms from inside another transform iteration.");
+
+            return Status::Fail;
+        }
+
+        m_isIterating = true;
+        const Status iterationStatus = IterateChunks(registry, function, chunkSize);
+        m_isIterating = false;
+
+        return iterationStatus;
+    }
+
+    [[nodiscard]] auto ScriptTransformView::GetScriptArrays() const -> ScriptArrays
+    {
+        return ScriptArrays{
+            GetFieldArray(Field::TranslationX).GetSize(),
+            GetFieldArray(Field::TranslationX).GetUserdata(),
+            GetFieldArray(Field::TranslationY).GetUserdata(),
+            GetFieldArray(Field::ScaleX).GetUserdata(),
+            GetFieldArray(Field::ScaleY).GetUserdata(),
+            GetFieldArray(Field::Rotation).GetUserdata(),
+        };
+    }
+
+    auto ScriptTransformView::ReserveArrays(const u32 capacity) -> void
+    {
+        for (ScriptFloatArray& fieldArray : m_fieldArrays)
+        {
+            fieldArray.Reserve(m_luaState, capacity);
+        }
+    }
+
+    auto ScriptTransformView::ResizeArrays(const u32 size) -> void
+    {
+        for (ScriptFloatArray& fieldArray : m_fieldArrays)
+        {
+            fieldArray.Resize(size);
+        }
+    }
+
+    [[nodiscard]] auto ScriptTransformView::IterateChunks(EntityRegistry& registry, const sol::protected_function& function, const u32 chunkSize) -> Status
+    {
+        const auto transformView = registry.GetHandle().view<const components::Transform>();
+
+        m_entities.assign(std::cbegin(transformView), std::cend(transformView));
+
+        if (m_entities.empty())
+        {
+            return Status::Success;
+        }
+
+        const u32 clampedChunkSize = std::clamp(chunkSize, 1u, GetEntityCount());
+        ReserveArrays(clampedChunkSize);
+
+        for (usize firstEntityIndex = 0u; firstEntityIndex < m_entities.size(); firstEntityIndex += clampedChunkSize)
+        {
+            const u32 entityCount = static_cast<u32>(std::min<usize>(clampedChunkSize, m_entities.size() - firstEntityIndex));
+
+            ReadTransforms(registry, firstEntityIndex, entityCount);
+            ResizeArrays(entityCount);
+
+            const sol::protected_function_result chunkResult = std::apply(function, GetScriptArrays());
+
+            if (!chunkResult.valid())
+            {
+                const sol::error chunkError = chunkResult;
+                Log::EngineError("Failed to run script over transform chunk: {}", chunkError.what());
+
+                return Status::Fail;
+            }
+
+            WriteTransforms(registry, firstEntityIndex, entityCount);
+        }
+
+        return Status::Success;
+    }
+
+    auto ScriptTransformView::ReadTransforms(const EntityRegistry& registry, const usize firstEntityIndex, const u32 entityCount) -> void
+    {
+        const entt::registry& registryHandle = registry.GetHandle();
+
+        f32* const translationsX = GetFieldArray(Field::TranslationX).GetData().data();
+        f32* const translationsY = GetFieldArray(Field::TranslationY).GetData().data();
+        f32* const scalesX = GetFieldArray(Field::ScaleX).GetData().data();
+        f32* const scalesY = GetFieldArray(Field::ScaleY).GetData().data();
+        f32* const rotations = GetFieldArray(Field::Rotation).GetData().data();
+
+        const components::Transform defaultTransform{ };
+
+        for (u32 i = 0u; i < entityCount; ++i)
+        {
+            const EntityHandle entityHandle = m_entities[firstEntityIndex + i];
+            const components::Transform* transform = registryHandle.valid(entityHandle)
+                ? registryHandle.try_get<const components::Transform>(entityHandle)
+                : nullptr;
+
+            if (transform == nullptr)
+            {
+                transform = &defaultTransform;
+            }
+
+            translationsX[i] = transform->translation.x;
+            translationsY[i] = transform->translation.y;
+            scalesX[i] = transform->scale.x;
+            scalesY[i] = transform->scale.y;
+            rotations[i] = transform->rotation;
+        }
+    }
+
+    auto ScriptTransformView::WriteTransforms(EntityRegistry& registry, const usize firstEntityIndex, const u32 entityCount) const -> void
+    {
+        entt::registry& registryHandle = registry.GetHandle();
+
+        const f32* const translationsX = GetFieldArray(Field::TranslationX).GetData().data();
+        const f32* const translationsY = GetFieldArray(Field::TranslationY).GetData().data();
+        const f32* const scalesX = GetFieldArray(Field::ScaleX).GetData().data();
+        const f32* const scalesY = GetFieldArray(Field::ScaleY).GetData().data();
+        const f32* const rotations = GetFieldArray(Field::Rotation).GetData().data();
+
+        for (u32 i = 0u; i < entityCount; ++i)
+        {
+            const EntityHandle entityHandle = m_entities[firstEntityIndex + i];
+
+            if (!registryHandle.valid(entityHandle))
+            {
+                continue;
+            }
+
+            if (components::Transform* const transform = registryHandle.try_get<components::Transform>(entityHandle);
+                transform != nullptr)
+            {
+                transform->translation = Vector2{ translationsX[i], translationsY[i] };
+                transform->scale = Vector2{ scalesX[i], scalesY[i] };
+                transform->rotation = rotations[i];
+            }
+        }
+    }
+}
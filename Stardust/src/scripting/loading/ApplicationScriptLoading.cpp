@@ -8,17 +8,6 @@ namespace stardust
 {
     namespace
     {
-        auto LoadLoggingFunctions(sol::state& luaState, Application& application) -> void
-        {
-            auto logNamespace = luaState["log"].get_or_create<Table>();
-            logNamespace.set_function("info", &Log::Info<>);
-            logNamespace.set_function("debug", &Log::Debug<>);
-            logNamespace.set_function("trace", &Log::Trace<>);
-            logNamespace.set_function("warn", &Log::Warn<>);
-            logNamespace.set_function("error", &Log::Error<>);
-            logNamespace.set_function("critical", &Log::Critical<>);
-        }
-
         auto LoadTimeFunctions(sol::state& luaState, Application& application) -> void
         {
             auto timeNamespace = luaState["time"].get_or_create<Table>();
@@ -44,8 +33,18 @@ namespace stardust
         applicationNamespace.set_function("force_quit", [application = &application]() { application->ForceQuit(); });
         applicationNamespace.set_function("is_running", [application = &application]() -> bool { return application->IsRunning(); });
 
-        LoadLoggingFunctions(m_luaState, application);
         LoadTimeFunctions(m_luaState, application);
         LoadSceneFunctions(m_luaState, application);
     }
+
+    auto ScriptEngine::LoadLoggingFunctions() -> void
+    {
+        auto logNamespace = m_luaState["log"].get_or_create<Table>();
+        logNamespace.set_function("info", &Log::Info<>);
+        logNamespace.set_function("debug", &Log::Debug<>);
+        logNamespace.set_function("trace", &Log::Trace<>);
+        logNamespace.set_function("warn", &Log::Warn<>);
+        logNamespace.set_function("error", &Log::Error<>);
+        logNamespace.set_function("critical", &Log::Critical<>);
+    }
 }
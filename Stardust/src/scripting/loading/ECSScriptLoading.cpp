@@ -0,0 +1,60 @@
+#include "stardust/scripting/ScriptEngine.h"
+
+#include "stardust/application/Application.h"
+#include "stardust/ecs/registry/EntityRegistry.h"
+#include "stardust/scene/Scene.h"
+#include "stardust/types/Primitives.h"
+
+namespace stardust
+{
+    namespace
+    {
+        [[nodiscard]] auto GetCurrentEntityRegistry(Application& application) -> EntityRegistry&
+        {
+            return application.GetSceneManager().CurrentScene()->GetEntityRegistry();
+        }
+    }
+
+    auto ScriptEngine::LoadECSFunctions(Application& application) -> void
+    {
+        m_transformView.Initialise(m_luaState);
+
+        auto ecsNamespace = m_luaState["ecs"].get_or_create<Table>();
+
+        ecsNamespace.set_function(
+            "view_transforms",
+            [this, application = &application]() -> ScriptTransformView::ScriptArrays
+            {
+                if (m_transformView.IsIterating())
+                {
+                    throw sol::error("ecs.view_transforms cannot be called from inside ecs.foreach_transform");
+                }
+
+                m_transformView.Gather(GetCurrentEntityRegistry(*application));
+
+                return m_transformView.GetScriptArrays();
+            }
+        );
+
+        ecsNamespace.set_function(
+            "commit_transforms",
+            [this, application = &application]()
+            {
+                if (m_transformView.IsIterating())
+                {
+                    throw sol::error("ecs.commit_transforms cannot be called from inside ecs.foreach_transform");
+                }
+
+                m_transformView.Scatter(GetCurrentEntityRegistry(*application));
+            }
+        );
+
+        ecsNamespace.set_function(
+            "foreach_transform",
+            [this, application = &application](const sol::protected_function& function, const sol::optional<u32> chunkSize) -> bool
+            {
+                return m_transformView.ForEach(GetCurrentEntityRegistry(*application), function, chunkSize.value_or(ScriptTransformView::DefaultChunkSize)) == Status::Success;
+            }
+        );
+    }
+}
@@ -18,6 +18,15 @@ namespace stardust
         const auto frameTicks = newTickCount - m_tickCount;
         m_tickCount = newTickCount;
 
+        if (m_isFixedFrameStepEnabled)
+        {
+            m_deltaTime = m_fixedFrameStep;
+            elapsedTime += m_deltaTime;
+            m_fixedTimeAccumulator += m_deltaTime;
+
+            return;
+        }
+
         m_deltaTime = static_cast<f64>(frameTicks.count()) /
             static_cast<f64>(Clock::period::den);
 
@@ -79,6 +88,19 @@ namespace stardust
         m_isSynchronisingToTargetFrameRate = false;
     }
 
+    auto TimestepController::EnableFixedFrameStep(const f64 frameStep) noexcept -> void
+    {
+        m_isFixedFrameStepEnabled = true;
+        m_fixedFrameStep = frameStep;
+
+        m_isSynchronisingToTargetFrameRate = false;
+    }
+
+    auto TimestepController::DisableFixedFrameStep() noexcept -> void
+    {
+        m_isFixedFrameStepEnabled = false;
+    }
+
     auto TimestepController::SetTargetFrameRate(const f64 frameRate) noexcept -> void
     {
         m_targetFrameRate = frameRate;
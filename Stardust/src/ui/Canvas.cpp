@@ -1,5 +1,7 @@
 #include "stardust/ui/Canvas.h"
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -53,7 +55,7 @@ namespace stardust
             Entity entity = m_scene->CreateEntity(entityBundle);
 
             m_childComponents[key] = std::make_unique<Component>(
-                *this,
+                this,
                 key,
                 entity.GetHandle(),
                 1u,
@@ -61,7 +63,8 @@ namespace stardust
             );
 
             m_childComponents[key]->SetParent(nullptr);
-            m_childComponents[key]->m_canvas = this;
+            m_childComponents[key]->MarkLayoutDirty();
+            MarkLayoutStructureDirty();
 
             entity.AddComponent<components::UIComponent>(m_childComponents[key].get());
 
@@ -97,8 +100,9 @@ namespace stardust
         {
             m_childComponents[key] = std::move(child);
             m_childComponents[key]->SetParent(nullptr);
-            m_childComponents[key]->m_canvas = this;
-            m_childComponents[key]->SetDepth(1u);
+            m_childComponents[key]->AttachToCanvas(this, 1u);
+            m_childComponents[key]->MarkLayoutDirty();
+            MarkLayoutStructureDirty();
 
             return *m_childComponents[key];
         }
@@ -143,6 +147,145 @@ namespace stardust
             return nullptr;
         }
         
+        auto Canvas::UpdateLayout() -> void
+        {
+            if (m_scene == nullptr)
+            {
+                return;
+            }
+
+            if (const UVector2 screenSize = m_scene->GetCamera().GetVirtualScreenSize();
+                screenSize != m_layoutScreenSize)
+            {
+                m_layoutScreenSize = screenSize;
+
+                for (const auto& [childKey, child] : m_childComponents)
+                {
+                    child->MarkLayoutDirty();
+                }
+            }
+
+            if (m_isLayoutStructureDirty)
+            {
+                RebuildLayoutEntries();
+            }
+
+            if (!m_isLayoutDirty)
+            {
+                return;
+            }
+
+            for (const auto& [childKey, child] : m_childComponents)
+            {
+                UpdateComponentLayout(*child);
+            }
+
+            m_hitTestTree.Update();
+            m_isLayoutDirty = false;
+        }
+
+        [[nodiscard]] auto Canvas::GetComponentAtPoint(const geometry::ScreenPoint point) -> ObserverPointer<Component>
+        {
+            UpdateLayout();
+
+            if (const Optional<u32> layoutIndex = m_hitTestTree.FindTopmostItem(point);
+                layoutIndex.has_value())
+            {
+                return m_layout[layoutIndex.value()].component;
+            }
+
+            return nullptr;
+        }
+
+        [[nodiscard]] auto Canvas::GetComponentsAtPoint(const geometry::ScreenPoint point) -> List<ObserverPointer<Component>>
+        {
+            UpdateLayout();
+
+            List<u32> layoutIndices{ };
+            m_hitTestTree.FindItems(point, layoutIndices);
+
+            List<ObserverPointer<Component>> components{ };
+            components.reserve(layoutIndices.size());
+
+            for (const u32 layoutIndex : layoutIndices)
+            {
+                components.push_back(m_layout[layoutIndex].component);
+            }
+
+            return components;
+        }
+
+        auto Canvas::RebuildLayoutEntries() -> void
+        {
+            m_layout.clear();
+
+            Stack<ObserverPointer<Component>> components{ };
+
+            for (const auto& [childKey, child] : m_childComponents)
+            {
+                components.push(child.get());
+            }
+
+            while (!components.empty())
+            {
+                const ObserverPointer<Component> component = components.top();
+                components.pop();
+
+                m_layout.push_back(LayoutEntry{
+                    .component = component,
+                    .rectangle = component->m_absoluteRectangle,
+                    .depth = component->GetDepth(),
+                });
+
+                for (const auto& [childKey, child] : component->m_childComponents)
+                {
+                    components.push(child.get());
+                }
+            }
+
+            std::ranges::stable_sort(m_layout, std::less<u32>{ }, &LayoutEntry::depth);
+
+            m_hitTestTree.Reset(m_layout.size());
+
+            for (u32 i = 0u; i < static_cast<u32>(m_layout.size()); ++i)
+            {
+                m_layout[i].component->m_layoutIndex = i;
+                m_hitTestTree.SetRectangle(i, m_layout[i].rectangle);
+            }
+
+            m_isLayoutStructureDirty = false;
+        }
+
+        auto Canvas::UpdateComponentLayout(Component& component) -> void
+        {
+            if (component.m_isLayoutDirty)
+            {
+                const IVector2 position = component.HasParent()
+                    ? component.GetParent().m_absoluteRectangle.topLeft + GetRelativePositionFromAnchor(component.m_anchor, component.GetParent().GetSize(), component.m_size, component.m_anchorOffset)
+                    : GetVirtualScreenPositionFromAnchor(component.m_anchor, m_scene->GetCamera(), component.m_size, component.m_anchorOffset);
+
+                component.m_absoluteRectangle = geometry::ScreenRectangle{
+                    .topLeft = position,
+                    .size = component.m_size,
+                };
+
+                component.m_isLayoutDirty = false;
+                m_layout[component.m_layoutIndex].rectangle = component.m_absoluteRectangle;
+                m_hitTestTree.SetRectangle(component.m_layoutIndex, component.m_absoluteRectangle);
+            }
+            else if (!component.m_hasDirtyDescendant)
+            {
+                return;
+            }
+
+            component.m_hasDirtyDescendant = false;
+
+            for (const auto& [childKey, child] : component.m_childComponents)
+            {
+                UpdateComponentLayout(*child);
+            }
+        }
+
         auto Canvas::LoadComponentsFromXML(const XML& xml, const StringView xmlFilepath, const ObserverPointer<EntityBundle> entityBundle, const Optional<Any>& userData) -> void
         {
             const pugi::xml_node canvasNode = xml.child(CanvasNodeName);
@@ -164,6 +307,7 @@ namespace stardust
             }
 
             const Table globalStyleTable = m_scene->GetScriptEngine().Get<Table>(styleTableAttribute.value());
+            HashMap<String, Style> loadedStyles{ };
 
             struct ComponentElement final
             {
@@ -211,7 +355,15 @@ namespace stardust
                     continue;
                 }
 
-                Table stylesTable = globalStyleTable[stylesAttribute.value()];
+                auto stylesLocation = loadedStyles.find(stylesAttribute.value());
+
+                if (stylesLocation == std::cend(loadedStyles))
+                {
+                    const Table stylesTable = globalStyleTable[stylesAttribute.value()];
+
+                    stylesLocation = loadedStyles.emplace(stylesAttribute.value(), Style::FromTable(stylesTable)).first;
+                }
+
                 HashMap<String, String> otherAttributes{ };
 
                 for (const auto& attribute : component.attributes())
@@ -235,8 +387,8 @@ namespace stardust
                 }
 
                 Entity entity = m_scene->CreateEntity(entityBundle);
-                UniquePointer<Component> createdComponent = std::make_unique<Component>(*this, componentKey, entity.GetHandle(), depth, *m_scene);
-                createdComponent->SetStyles(stylesTable);
+                UniquePointer<Component> createdComponent = std::make_unique<Component>(this, componentKey, entity.GetHandle(), depth, *m_scene);
+                createdComponent->SetStyles(stylesLocation->second);
 
                 const ObserverPointer<Component> createdComponentObserver = createdComponent.get();
 
@@ -274,6 +426,7 @@ namespace stardust
                 );
             }
 
+            MarkLayoutStructureDirty();
             m_didLoadSuccessfully = true;
         }
     }
@@ -0,0 +1,248 @@
+#include "stardust/ui/HitTestTree.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+namespace stardust
+{
+    namespace ui
+    {
+        namespace
+        {
+            constexpr usize MaxTraversalDepth = 64u;
+
+            [[nodiscard]] auto GetRectangleMaximum(const geometry::ScreenRectangle& rectangle) noexcept -> IVector2
+            {
+                return IVector2{
+                    rectangle.topLeft.x + static_cast<i32>(rectangle.size.x),
+                    rectangle.topLeft.y + static_cast<i32>(rectangle.size.y),
+                };
+            }
+
+            [[nodiscard]] auto DoesBoundsContainPoint(const IVector2 minimum, const IVector2 maximum, const geometry::ScreenPoint point) noexcept -> bool
+            {
+                return point.x >= minimum.x && point.x < maximum.x && point.y >= minimum.y && point.y < maximum.y;
+            }
+        }
+
+        auto HitTestTree::Reset(const usize itemCount) -> void
+        {
+            m_rectangles.assign(itemCount, geometry::ScreenRectangle{ });
+            m_needsRebuild = true;
+        }
+
+        auto HitTestTree::SetRectangle(const u32 itemIndex, const geometry::ScreenRectangle& rectangle) -> void
+        {
+            m_rectangles[itemIndex] = rectangle;
+            m_needsRefit = true;
+        }
+
+        auto HitTestTree::Update() -> void
+        {
+            if (m_needsRebuild)
+            {
+                Rebuild();
+            }
+            else if (m_needsRefit)
+            {
+                Refit();
+            }
+
+            m_needsRebuild = false;
+            m_needsRefit = false;
+        }
+
+        [[nodiscard]] auto HitTestTree::FindTopmostItem(const geometry::ScreenPoint point) const -> Optional<u32>
+        {
+            if (m_nodes.empty())
+            {
+                return None;
+            }
+
+            Optional<u32> topmostItemIndex = None;
+
+            Array<u32, MaxTraversalDepth> nodeStack{ };
+            usize nodeStackSize = 0u;
+            nodeStack[nodeStackSize++] = 0u;
+
+            while (nodeStackSize > 0u)
+            {
+                const Node& node = m_nodes[nodeStack[--nodeStackSize]];
+
+                if (topmostItemIndex.has_value() && node.highestItemIndex <= topmostItemIndex.value())
+                {
+                    continue;
+                }
+
+                if (!DoesBoundsContainPoint(node.minimum, node.maximum, point))
+                {
+                    continue;
+                }
+
+                if (node.itemCount == 0u)
+                {
+                    nodeStack[nodeStackSize++] = node.firstIndex;
+                    nodeStack[nodeStackSize++] = node.firstIndex + 1u;
+
+                    continue;
+                }
+
+                for (u32 i = node.firstIndex; i < node.firstIndex + node.itemCount; ++i)
+                {
+                    const u32 itemIndex = m_itemIndices[i];
+                    const geometry::ScreenRectangle& rectangle = m_rectangles[itemIndex];
+
+                    if ((!topmostItemIndex.has_value() || itemIndex > topmostItemIndex.value()) &&
+                        DoesBoundsContainPoint(rectangle.topLeft, GetRectangleMaximum(rectangle), point))
+                    {
+                        topmostItemIndex = itemIndex;
+                    }
+                }
+            }
+
+            return topmostItemIndex;
+        }
+
+        auto HitTestTree::FindItems(const geometry::ScreenPoint point, List<u32>& itemIndices) const -> void
+        {
+            itemIndices.clear();
+
+            if (m_nodes.empty())
+            {
+                return;
+            }
+
+            Array<u32, MaxTraversalDepth> nodeStack{ };
+            usize nodeStackSize = 0u;
+            nodeStack[nodeStackSize++] = 0u;
+
+            while (nodeStackSize > 0u)
+            {
+                const Node& node = m_nodes[nodeStack[--nodeStackSize]];
+
+                if (!DoesBoundsContainPoint(node.minimum, node.maximum, point))
+                {
+                    continue;
+                }
+
+                if (node.itemCount == 0u)
+                {
+                    nodeStack[nodeStackSize++] = node.firstIndex;
+                    nodeStack[nodeStackSize++] = node.firstIndex + 1u;
+
+                    continue;
+                }
+
+                for (u32 i = node.firstIndex; i < node.firstIndex + node.itemCount; ++i)
+                {
+                    const geometry::ScreenRectangle& rectangle = m_rectangles[m_itemIndices[i]];
+
+                    if (DoesBoundsContainPoint(rectangle.topLeft, GetRectangleMaximum(rectangle), point))
+                    {
+                        itemIndices.push_back(m_itemIndices[i]);
+                    }
+                }
+            }
+
+            std::ranges::sort(itemIndices, std::greater<u32>{ });
+        }
+
+        auto HitTestTree::Rebuild() -> void
+        {
+            m_itemIndices.resize(m_rectangles.size());
+            std::iota(std::begin(m_itemIndices), std::end(m_itemIndices), 0u);
+
+            m_nodes.clear();
+
+            if (m_rectangles.empty())
+            {
+                return;
+            }
+
+            m_nodes.reserve(m_rectangles.size() * 2u);
+            m_nodes.push_back(Node{ });
+
+            BuildNode(0u, 0u, static_cast<u32>(m_itemIndices.size()));
+        }
+
+        auto HitTestTree::Refit() -> void
+        {
+            for (usize i = m_nodes.size(); i > 0u; --i)
+            {
+                Node& node = m_nodes[i - 1u];
+
+                if (node.itemCount != 0u)
+                {
+                    FitLeafNode(node);
+
+                    continue;
+                }
+
+                const Node& leftChild = m_nodes[node.firstIndex];
+                const Node& rightChild = m_nodes[node.firstIndex + 1u];
+
+                node.minimum = glm::min(leftChild.minimum, rightChild.minimum);
+                node.maximum = glm::max(leftChild.maximum, rightChild.maximum);
+            }
+        }
+
+        auto HitTestTree::BuildNode(const u32 nodeIndex, const u32 firstIndex, const u32 itemCount) -> void
+        {
+            m_nodes[nodeIndex].firstIndex = firstIndex;
+            m_nodes[nodeIndex].itemCount = itemCount;
+            FitLeafNode(m_nodes[nodeIndex]);
+
+            if (itemCount <= MaxLeafItemCount)
+            {
+                return;
+            }
+
+            const IVector2 extent = m_nodes[nodeIndex].maximum - m_nodes[nodeIndex].minimum;
+            const i32 splitAxis = extent.x >= extent.y ? 0 : 1;
+
+            const auto firstItem = std::begin(m_itemIndices) + firstIndex;
+            const u32 leftItemCount = itemCount / 2u;
+
+            std::nth_element(
+                firstItem, firstItem + leftItemCount, firstItem + itemCount,
+                [this, splitAxis](const u32 lhs, const u32 rhs)
+                {
+                    const geometry::ScreenRectangle& lhsRectangle = m_rectangles[lhs];
+                    const geometry::ScreenRectangle& rhsRectangle = m_rectangles[rhs];
+
+                    return static_cast<i64>(lhsRectangle.topLeft[splitAxis]) * 2 + lhsRectangle.size[splitAxis] <
+                        static_cast<i64>(rhsRectangle.topLeft[splitAxis]) * 2 + rhsRectangle.size[splitAxis];
+                }
+            );
+
+            const u32 leftChildIndex = static_cast<u32>(m_nodes.size());
+            m_nodes.push_back(Node{ });
+            m_nodes.push_back(Node{ });
+
+            m_nodes[nodeIndex].firstIndex = leftChildIndex;
+            m_nodes[nodeIndex].itemCount = 0u;
+
+            BuildNode(leftChildIndex, firstIndex, leftItemCount);
+            BuildNode(leftChildIndex + 1u, firstIndex + leftItemCount, itemCount - leftItemCount);
+        }
+
+        auto HitTestTree::FitLeafNode(Node& node) const -> void
+        {
+            node.minimum = IVector2{ std::numeric_limits<i32>::max(), std::numeric_limits<i32>::max() };
+            node.maximum = IVector2{ std::numeric_limits<i32>::min(), std::numeric_limits<i32>::min() };
+            node.highestItemIndex = 0u;
+
+            for (u32 i = node.firstIndex; i < node.firstIndex + node.itemCount; ++i)
+            {
+                const geometry::ScreenRectangle& rectangle = m_rectangles[m_itemIndices[i]];
+
+                node.minimum = glm::min(node.minimum, rectangle.topLeft);
+                node.maximum = glm::max(node.maximum, GetRectangleMaximum(rectangle));
+                node.highestItemIndex = std::max(node.highestItemIndex, m_itemIndices[i]);
+            }
+        }
+    }
+}
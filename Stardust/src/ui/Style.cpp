@@ -0,0 +1,161 @@
+#include "stardust/ui/Style.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <sol/sol.hpp>
+
+namespace stardust
+{
+    namespace ui
+    {
+        namespace
+        {
+            [[nodiscard]] auto ConvertStyleValue(const sol::object& object) -> Optional<Style::Value>
+            {
+                switch (object.get_type())
+                {
+                case sol::type::boolean:
+                    return Style::Value(object.as<bool>());
+
+                case sol::type::number:
+                    return Style::Value(object.as<f64>());
+
+                case sol::type::string:
+                    return Style::Value(object.as<String>());
+
+                case sol::type::userdata:
+                    if (object.is<Colour>())
+                    {
+                        return Style::Value(object.as<Colour>());
+                    }
+
+                    return None;
+
+                default:
+                    return None;
+                }
+            }
+        }
+
+        [[nodiscard]] auto Style::FromTable(const Table& styleTable) -> Style
+        {
+            Style style{ };
+
+            if (!styleTable.valid())
+            {
+                return style;
+            }
+
+            Table currentTable = styleTable;
+
+            for (u32 depth = 0u; depth < MaxInheritanceDepth; ++depth)
+            {
+                for (const auto& [key, value] : currentTable)
+                {
+                    if (key.get_type() != sol::type::string)
+                    {
+                        continue;
+                    }
+
+                    if (Optional<Value> convertedValue = ConvertStyleValue(value);
+                        convertedValue.has_value())
+                    {
+                        style.m_properties.push_back(Property{
+                            .key = MakeKey(key.as<StringView>()),
+                            .value = std::move(convertedValue).value(),
+                        });
+                    }
+                }
+
+                const sol::optional<Table> metatable = currentTable[sol::metatable_key];
+
+                if (!metatable.has_value())
+                {
+                    break;
+                }
+
+                const sol::object baseTable = metatable.value()[sol::meta_function::index];
+
+                if (baseTable.get_type() != sol::type::table)
+                {
+                    break;
+                }
+
+                currentTable = baseTable.as<Table>();
+            }
+
+            std::ranges::stable_sort(style.m_properties, { }, &Property::key);
+
+            const auto duplicateProperties = std::ranges::unique(style.m_properties, { }, &Property::key);
+            style.m_properties.erase(duplicateProperties.begin(), duplicateProperties.end());
+
+            return style;
+        }
+
+        auto Style::Inherit(const Style& baseStyle) -> void
+        {
+            List<Property> properties{ };
+            properties.reserve(m_properties.size() + baseStyle.m_properties.size());
+
+            std::ranges::set_union(m_properties, baseStyle.m_properties, std::back_inserter(properties), { }, &Property::key, &Property::key);
+
+            m_properties = std::move(properties);
+        }
+
+        auto Style::Override(const Style& overrideStyle) -> void
+        {
+            List<Property> properties{ };
+            properties.reserve(m_properties.size() + overrideStyle.m_properties.size());
+
+            std::ranges::set_union(overrideStyle.m_properties, m_properties, std::back_inserter(properties), { }, &Property::key, &Property::key);
+
+            m_properties = std::move(properties);
+        }
+
+        [[nodiscard]] auto Style::Has(const Key key) const noexcept -> bool
+        {
+            return Find(key) != nullptr;
+        }
+
+        [[nodiscard]] auto Style::Find(const Key key) const noexcept -> ObserverPointer<const Value>
+        {
+            const auto propertyLocation = std::ranges::lower_bound(m_properties, key, { }, &Property::key);
+
+            if (propertyLocation == std::ranges::end(m_properties) || propertyLocation->key != key)
+            {
+                return nullptr;
+            }
+
+            return &propertyLocation->value;
+        }
+
+        auto Style::Remove(const Key key) -> void
+        {
+            const auto propertyLocation = std::ranges::lower_bound(m_properties, key, { }, &Property::key);
+
+            if (propertyLocation != std::ranges::end(m_properties) && propertyLocation->key == key)
+            {
+                m_properties.erase(propertyLocation);
+            }
+        }
+
+        auto Style::SetValue(const Key key, Value&& value) -> void
+        {
+            const auto propertyLocation = std::ranges::lower_bound(m_properties, key, { }, &Property::key);
+
+            if (propertyLocation != std::ranges::end(m_properties) && propertyLocation->key == key)
+            {
+                propertyLocation->value = std::move(value);
+            }
+            else
+            {
+                m_properties.insert(propertyLocation, Property{
+                    .key = key,
+                    .value = std::move(value),
+                });
+            }
+        }
+    }
+}
@@ -3,8 +3,6 @@
 #include <memory>
 #include <utility>
 
-#include <sol/sol.hpp>
-
 #include "stardust/ecs/components/UIComponentComponent.h"
 #include "stardust/ecs/entity/Entity.h"
 #include "stardust/ui/Canvas.h"
@@ -13,18 +11,31 @@ namespace stardust
 {
     namespace ui
     {
-        Component::Component(Canvas& canvas, const StringView key, const EntityHandle associatedEntityHandle, const u32 depth, Scene& scene)
-            : m_canvas(&canvas), m_key(key), m_associatedEntityHandle(associatedEntityHandle), m_styles(scene.GetScriptEngine().GetState(), sol::create), m_depth(depth), m_scene(&scene), m_camera(&scene.GetCamera())
+        Component::Component(const ObserverPointer<Canvas> canvas, const StringView key, const EntityHandle associatedEntityHandle, const u32 depth, Scene& scene)
+            : m_key(key), m_associatedEntityHandle(associatedEntityHandle), m_depth(depth), m_canvas(canvas), m_scene(&scene), m_camera(&scene.GetCamera())
         { }
 
         [[nodiscard]] auto Component::GetAbsolutePosition() const -> IVector2
         {
-            if (m_parent == nullptr)
+            if (IsCachedLayoutCurrent())
             {
-                return GetVirtualScreenPositionFromAnchor(m_anchor, *m_camera, m_size, m_anchorOffset);
+                return m_absoluteRectangle.topLeft;
             }
 
-            return m_parent->GetAbsolutePosition() + GetRelativePositionFromAnchor(m_anchor, m_parent->GetSize(), m_size, m_anchorOffset);
+            return ComputeAbsolutePosition();
+        }
+
+        [[nodiscard]] auto Component::GetAbsoluteRectangle() const -> geometry::ScreenRectangle
+        {
+            if (IsCachedLayoutCurrent())
+            {
+                return m_absoluteRectangle;
+            }
+
+            return geometry::ScreenRectangle{
+                .topLeft = ComputeAbsolutePosition(),
+                .size = m_size,
+            };
         }
 
         auto Component::SetRelativePosition(const Anchor anchor, const IVector2 anchorOffset) noexcept -> void
@@ -33,19 +44,39 @@ namespace stardust
             SetAnchorOffset(anchorOffset);
         }
 
+        auto Component::MarkLayoutDirty() noexcept -> void
+        {
+            MarkSubtreeLayoutDirty();
+
+            for (ObserverPointer<Component> ancestor = m_parent; ancestor != nullptr && !ancestor->m_hasDirtyDescendant; ancestor = ancestor->m_parent)
+            {
+                ancestor->m_hasDirtyDescendant = true;
+            }
+
+            if (m_canvas != nullptr)
+            {
+                m_canvas->MarkLayoutDirty();
+            }
+        }
+
         auto Component::CreateChild(const Key& key, const ObserverPointer<EntityBundle> entityBundle) -> Component&
         {
             Entity entity = m_scene->CreateEntity(entityBundle);
 
             m_childComponents[key] = std::make_unique<Component>(
-                *m_canvas,
+                m_canvas,
                 key,
                 entity.GetHandle(),
                 m_depth + 1u,
                 *m_scene
             );
             m_childComponents[key]->SetParent(this);
-            m_childComponents[key]->m_canvas = m_canvas;
+            m_childComponents[key]->MarkLayoutDirty();
+
+            if (m_canvas != nullptr)
+            {
+                m_canvas->MarkLayoutStructureDirty();
+            }
 
             entity.AddComponent<components::UIComponent>(m_childComponents[key].get());
 
@@ -81,12 +112,27 @@ namespace stardust
         {
             m_childComponents[key] = std::move(child);
             m_childComponents[key]->SetParent(this);
-            m_childComponents[key]->m_canvas = m_canvas;
-            m_childComponents[key]->SetDepth(m_depth + 1u);
+            m_childComponents[key]->AttachToCanvas(m_canvas, m_depth + 1u);
+            m_childComponents[key]->MarkLayoutDirty();
+
+            if (m_canvas != nullptr)
+            {
+                m_canvas->MarkLayoutStructureDirty();
+            }
 
             return *m_childComponents[key];
         }
 
+        auto Component::RemoveChild(const Key& key) -> void
+        {
+            m_childComponents.erase(key);
+
+            if (m_canvas != nullptr)
+            {
+                m_canvas->MarkLayoutStructureDirty();
+            }
+        }
+
         [[nodiscard]] auto Component::GetChildRecursive(const Key& key) -> ObserverPointer<Component>
         {
             if (HasChild(key))
@@ -126,5 +172,46 @@ namespace stardust
 
             return nullptr;
         }
+
+        [[nodiscard]] auto Component::IsCachedLayoutCurrent() const noexcept -> bool
+        {
+            return !m_isLayoutDirty && m_canvas != nullptr && m_canvas->GetLayoutScreenSize() == m_camera->GetVirtualScreenSize();
+        }
+
+        [[nodiscard]] auto Component::ComputeAbsolutePosition() const -> IVector2
+        {
+            if (m_parent == nullptr)
+            {
+                return GetVirtualScreenPositionFromAnchor(m_anchor, *m_camera, m_size, m_anchorOffset);
+            }
+
+            return m_parent->GetAbsolutePosition() + GetRelativePositionFromAnchor(m_anchor, m_parent->GetSize(), m_size, m_anchorOffset);
+        }
+
+        auto Component::MarkSubtreeLayoutDirty() noexcept -> void
+        {
+            if (m_isLayoutDirty)
+            {
+                return;
+            }
+
+            m_isLayoutDirty = true;
+
+            for (const auto& [childKey, child] : m_childComponents)
+            {
+                child->MarkSubtreeLayoutDirty();
+            }
+        }
+
+        auto Component::AttachToCanvas(const ObserverPointer<Canvas> canvas, const u32 depth) noexcept -> void
+        {
+            m_canvas = canvas;
+            m_depth = depth;
+
+            for (const auto& [childKey, child] : m_childComponents)
+            {
+                child->AttachToCanvas(canvas, depth + 1u);
+            }
+        }
     }
 }
@@ -13,6 +13,11 @@ group "Unit Tests"
     include "unit/colour"
     include "unit/filesystem"
     include "unit/global_resources"
+    include "unit/hit_test_tree"
+    include "unit/physics_queries"
+    include "unit/physics_world"
+    include "unit/script_entities"
+    include "unit/spatial_hash"
     include "unit/string"
     include "unit/virtual_filesystem"
 group ""
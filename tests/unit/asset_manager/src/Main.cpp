@@ -75,3 +75,150 @@ TEST_CASE("Assets can be managed and queried", "[asset_manager]")
         }
     }
 }
+
+TEST_CASE("Assets can be loaded asynchronously", "[asset_manager]")
+{
+    sd::AssetLoader assetLoader(2u);
+    sd::AssetManager<sd::i32> assets{ };
+
+    sd::List<sd::AssetRequest> requests{ };
+
+    for (const auto number : std::ranges::iota_view(1, 6))
+    {
+        requests.push_back(assets.LoadAsync(assetLoader, std::to_string(number), [number] { return sd::Optional<sd::i32>(number); }));
+    }
+
+    const sd::AssetRequest failedRequest = assets.LoadAsync(assetLoader, "failed", [] { return sd::Optional<sd::i32>(sd::None); });
+
+    SECTION("Loaded assets are added once the loader is flushed")
+    {
+        assetLoader.Flush();
+
+        REQUIRE(assetLoader.IsIdle());
+        REQUIRE(assetLoader.GetProgress() == 1.0f);
+        REQUIRE(assets.GetAssetCount() == 5u);
+
+        for (const auto& request : requests)
+        {
+            REQUIRE(request.IsLoaded());
+            REQUIRE(assets.Get(request.GetName()) == std::stoi(request.GetName()));
+        }
+    }
+
+    SECTION("Failed decodes are reported without adding an asset")
+    {
+        assetLoader.Flush();
+
+        REQUIRE(failedRequest.HasFailed());
+        REQUIRE(!assets.Has("failed"));
+    }
+
+    SECTION("Uploads are drained on the calling thread")
+    {
+        while (!assetLoader.IsIdle())
+        {
+            [[maybe_unused]] const sd::u32 uploadCount = assetLoader.Update(0.0f);
+            REQUIRE(uploadCount <= 1u);
+        }
+
+        REQUIRE(assets.GetAssetCount() == 5u);
+    }
+}
+
+TEST_CASE("Assets can be accessed and managed through handles", "[asset_manager]")
+{
+    sd::AssetManager<sd::i32> assets{ };
+    sd::List<sd::AssetManager<sd::i32>::Handle> handles{ };
+
+    for (const auto number : std::ranges::iota_view(1, 6))
+    {
+        handles.push_back(assets.Add(std::to_string(number), number));
+    }
+
+    SECTION("Handles resolve to the same assets as their names")
+    {
+        for (const auto number : std::ranges::iota_view(1, 6))
+        {
+            const auto handle = assets.GetHandle(std::to_string(number));
+
+            REQUIRE(handle.IsValid());
+            REQUIRE(handle == handles[static_cast<sd::usize>(number - 1)]);
+            REQUIRE(assets.Get(handle) == number);
+            REQUIRE(assets[handle] == number);
+            REQUIRE(assets.GetName(handle) == std::to_string(number));
+        }
+
+        REQUIRE(!assets.GetHandle("6").IsValid());
+        REQUIRE(assets.TryGet(assets.GetHandle("6")) == nullptr);
+    }
+
+    SECTION("Replacing an asset keeps its handle valid")
+    {
+        const auto handle = assets.GetHandle("2");
+        const auto replacedHandle = assets.Add("2", 20);
+
+        REQUIRE(replacedHandle == handle);
+        REQUIRE(assets.Get(handle) == 20);
+        REQUIRE(assets.GetAssetCount() == 5u);
+    }
+
+    SECTION("Removed assets invalidate their handles even when the slot is reused")
+    {
+        const auto handle = assets.GetHandle("3");
+        assets.Remove(handle);
+
+        REQUIRE(!assets.Has(handle));
+        REQUIRE(!assets.Has("3"));
+        REQUIRE(assets.GetAssetCount() == 4u);
+
+        const auto reusedHandle = assets.Add("6", 6);
+
+        REQUIRE(reusedHandle.GetIndex() == handle.GetIndex());
+        REQUIRE(reusedHandle != handle);
+        REQUIRE(assets.TryGet(handle) == nullptr);
+        REQUIRE(*assets.TryGet(reusedHandle) == 6);
+
+        assets.Clear();
+
+        REQUIRE(!assets.Has(reusedHandle));
+    }
+
+    SECTION("Assets can be reference counted")
+    {
+        const auto handle = assets.Acquire("1");
+        assets.AddReference(handle);
+
+        REQUIRE(assets.GetReferenceCount(handle) == 2u);
+
+        assets.Release(handle);
+        REQUIRE(assets.RemoveUnreferenced() == 4u);
+        REQUIRE(assets.GetAssetCount() == 1u);
+        REQUIRE(assets.Has(handle));
+
+        assets.Release(handle);
+        REQUIRE(assets.RemoveUnreferenced() == 1u);
+        REQUIRE(!assets.Has(handle));
+    }
+
+    SECTION("Watched assets can be reloaded in place")
+    {
+        sd::i32 reloadedValue = 100;
+        const auto handle = assets.GetHandle("4");
+        const sd::i32* const assetAddress = &assets.Get(handle);
+
+        REQUIRE(!assets.IsWatched(handle));
+        REQUIRE(assets.Reload(handle) == sd::Status::Fail);
+
+        assets.Watch(handle, "numbers/4.txt", [&reloadedValue] { return std::make_unique<sd::i32>(reloadedValue); });
+
+        REQUIRE(assets.IsWatched(handle));
+        REQUIRE(assets.Reload(handle) == sd::Status::Success);
+        REQUIRE(assets.Get(handle) == 100);
+        REQUIRE(&assets.Get(handle) == assetAddress);
+        REQUIRE(assets.Get("4") == 100);
+        REQUIRE(assets.GetAssetCount() == 5u);
+
+        assets.Unwatch(handle);
+        REQUIRE(!assets.IsWatched(handle));
+    }
+}
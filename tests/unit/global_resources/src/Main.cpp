@@ -2,6 +2,7 @@
 #include <catch2/catch.hpp>
 
 #include <ranges>
+#include <stdexcept>
 #include <string>
 
 #include <stardust/Stardust.h>
@@ -74,3 +75,68 @@ TEST_CASE("Global resources can be managed via keys", "[global_resources]")
         REQUIRE(!globalResources.HasKey("true"));
     }
 }
+
+TEST_CASE("Global resources can be managed via typed keys", "[global_resources]")
+{
+    sd::GlobalResources globalResources{ };
+
+    const sd::ResourceKey<sd::i32> scoreKey = globalResources.RegisterKey<sd::i32>("score");
+    const sd::ResourceKey<sd::String> nameKey = globalResources.RegisterKey<sd::String>("name");
+
+    SECTION("Registering a name twice yields the same key")
+    {
+        REQUIRE(scoreKey.IsValid());
+        REQUIRE(globalResources.RegisterKey<sd::i32>("score") == scoreKey);
+        REQUIRE(scoreKey != sd::ResourceKey<sd::i32>(nameKey.GetIndex()));
+    }
+
+    SECTION("Can set and retrieve values with a typed key")
+    {
+        REQUIRE(!globalResources.Has(scoreKey));
+        REQUIRE(globalResources.GetPointer(scoreKey) == nullptr);
+
+        globalResources.Set(scoreKey, 10);
+        globalResources.Emplace(nameKey, 3u, 'z');
+
+        REQUIRE(globalResources.Has(scoreKey));
+        REQUIRE(globalResources.Get(scoreKey) == 10);
+        REQUIRE(globalResources.Get(nameKey) == "zzz");
+
+        globalResources.Get(scoreKey) += 5;
+        REQUIRE(*globalResources.GetPointer(scoreKey) == 15);
+    }
+
+    SECTION("Typed keys and string keys share the same storage")
+    {
+        globalResources.Set(scoreKey, 42);
+        REQUIRE(globalResources.HasKey("score"));
+        REQUIRE(globalResources.Get<sd::i32>("score") == 42);
+
+        globalResources.Set("name", sd::String("stardust"));
+        REQUIRE(globalResources.Get(nameKey) == "stardust");
+
+        globalResources.Remove(scoreKey);
+        REQUIRE(!globalResources.Has(scoreKey));
+        REQUIRE(!globalResources.HasKey("score"));
+
+        globalResources.Clear();
+        REQUIRE(!globalResources.Has(nameKey));
+    }
+
+    SECTION("Missing or mistyped resources are rejected")
+    {
+        REQUIRE_THROWS_AS(globalResources.Get(scoreKey), std::out_of_range);
+        REQUIRE_THROWS_AS(globalResources.GetReference<sd::i32>("score"), std::out_of_range);
+        REQUIRE_THROWS_AS(globalResources.GetReference<sd::i32>("missing"), std::out_of_range);
+        REQUIRE(!globalResources.HasKey("missing"));
+
+        globalResources.Set(nameKey, sd::String("stardust"));
+        REQUIRE_THROWS_AS(globalResources.GetReference<sd::i32>("name"), std::out_of_range);
+        REQUIRE(globalResources.Get(nameKey) == "stardust");
+
+        const sd::ResourceKey<sd::i32> unregisteredKey(static_cast<sd::u32>(nameKey.GetIndex() + 100u));
+        REQUIRE_THROWS_AS(globalResources.Set(unregisteredKey, 1), std::out_of_range);
+        REQUIRE_THROWS_AS(globalResources.Emplace(unregisteredKey, 1), std::out_of_range);
+        REQUIRE(!globalResources.Has(unregisteredKey));
+    }
+}
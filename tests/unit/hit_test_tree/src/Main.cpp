@@ -0,0 +1,195 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+
+#include <stardust/Stardust.h>
+
+namespace
+{
+    constexpr sd::usize ItemCount = 500u;
+    constexpr sd::usize QueryCount = 2'000u;
+
+    [[nodiscard]] auto MakeRectangle(const sd::i32 x, const sd::i32 y, const sd::u32 width, const sd::u32 height) -> sd::geometry::ScreenRectangle
+    {
+        return sd::geometry::ScreenRectangle{
+            .topLeft = sd::IVector2{ x, y },
+            .size = sd::UVector2{ width, height },
+        };
+    }
+
+    [[nodiscard]] auto BuildTree(const sd::List<sd::geometry::ScreenRectangle>& rectangles) -> sd::ui::HitTestTree
+    {
+        sd::ui::HitTestTree hitTestTree{ };
+        hitTestTree.Reset(rectangles.size());
+
+        for (sd::u32 i = 0u; i < static_cast<sd::u32>(rectangles.size()); ++i)
+        {
+            hitTestTree.SetRectangle(i, rectangles[i]);
+        }
+
+        hitTestTree.Update();
+
+        return hitTestTree;
+    }
+
+    [[nodiscard]] auto FindItemsLinearly(const sd::List<sd::geometry::ScreenRectangle>& rectangles, const sd::geometry::ScreenPoint point) -> sd::List<sd::u32>
+    {
+        sd::List<sd::u32> itemIndices{ };
+
+        for (sd::u32 i = 0u; i < static_cast<sd::u32>(rectangles.size()); ++i)
+        {
+            const sd::geometry::ScreenRectangle& rectangle = rectangles[i];
+
+            if (point.x >= rectangle.topLeft.x && point.x < rectangle.topLeft.x + static_cast<sd::i32>(rectangle.size.x) &&
+                point.y >= rectangle.topLeft.y && point.y < rectangle.topLeft.y + static_cast<sd::i32>(rectangle.size.y))
+            {
+                itemIndices.push_back(i);
+            }
+        }
+
+        std::ranges::sort(itemIndices, std::greater<sd::u32>{ });
+
+        return itemIndices;
+    }
+
+    [[nodiscard]] auto FindTopmostItemLinearly(const sd::List<sd::geometry::ScreenRectangle>& rectangles, const sd::geometry::ScreenPoint point) -> sd::Optional<sd::u32>
+    {
+        const sd::List<sd::u32> itemIndices = FindItemsLinearly(rectangles, point);
+
+        if (itemIndices.empty())
+        {
+            return sd::None;
+        }
+
+        return itemIndices.front();
+    }
+}
+
+TEST_CASE("Hit test trees resolve overlapping rectangles by depth", "[hit_test_tree]")
+{
+    const sd::List<sd::geometry::ScreenRectangle> rectangles{
+        MakeRectangle(0, 0, 100u, 100u),
+        MakeRectangle(10, 10, 50u, 50u),
+        MakeRectangle(40, 40, 50u, 50u),
+        MakeRectangle(200, 200, 10u, 10u),
+        MakeRectangle(45, 45, 5u, 5u),
+        MakeRectangle(-20, -20, 30u, 30u),
+    };
+
+    sd::ui::HitTestTree hitTestTree = BuildTree(rectangles);
+    sd::List<sd::u32> itemIndices{ };
+
+    REQUIRE(hitTestTree.GetItemCount() == rectangles.size());
+
+    SECTION("Later items are on top of earlier ones")
+    {
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 5, 95 }) == 0u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 20, 20 }) == 1u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 50, 50 }) == 2u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 47, 47 }) == 4u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 5, 5 }) == 5u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 205, 205 }) == 3u);
+
+        hitTestTree.FindItems(sd::IVector2{ 47, 47 }, itemIndices);
+        REQUIRE(itemIndices == sd::List<sd::u32>{ 4u, 2u, 1u, 0u });
+    }
+
+    SECTION("Rectangle edges are inclusive at the top left and exclusive at the bottom right")
+    {
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 10, 10 }) == 1u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 99, 99 }) == 0u);
+        REQUIRE(!hitTestTree.FindTopmostItem(sd::IVector2{ 100, 100 }).has_value());
+        REQUIRE(!hitTestTree.FindTopmostItem(sd::IVector2{ 150, 150 }).has_value());
+
+        hitTestTree.FindItems(sd::IVector2{ 150, 150 }, itemIndices);
+        REQUIRE(itemIndices.empty());
+    }
+
+    SECTION("Moved rectangles are found at their new position")
+    {
+        hitTestTree.SetRectangle(3u, MakeRectangle(45, 45, 10u, 10u));
+        hitTestTree.Update();
+
+        REQUIRE(!hitTestTree.FindTopmostItem(sd::IVector2{ 205, 205 }).has_value());
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 52, 52 }) == 3u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 47, 47 }) == 4u);
+    }
+
+    SECTION("Removed rectangles are no longer hit")
+    {
+        hitTestTree.SetRectangle(4u, sd::geometry::ScreenRectangle{ });
+        hitTestTree.Update();
+
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 47, 47 }) == 2u);
+
+        const sd::List<sd::geometry::ScreenRectangle> remainingRectangles(std::cbegin(rectangles), std::cbegin(rectangles) + 3);
+        hitTestTree = BuildTree(remainingRectangles);
+
+        REQUIRE(hitTestTree.GetItemCount() == 3u);
+        REQUIRE(hitTestTree.FindTopmostItem(sd::IVector2{ 50, 50 }) == 2u);
+        REQUIRE(!hitTestTree.FindTopmostItem(sd::IVector2{ 205, 205 }).has_value());
+        REQUIRE(!hitTestTree.FindTopmostItem(sd::IVector2{ -10, -10 }).has_value());
+
+        hitTestTree.Reset(0u);
+        hitTestTree.Update();
+
+        REQUIRE(hitTestTree.GetNodeCount() == 0u);
+        REQUIRE(!hitTestTree.FindTopmostItem(sd::IVector2{ 50, 50 }).has_value());
+    }
+}
+
+TEST_CASE("Hit test trees match a linear scan", "[hit_test_tree]")
+{
+    std::mt19937 randomEngine(1234u);
+    std::uniform_int_distribution<sd::i32> positionDistribution(-500, 500);
+    std::uniform_int_distribution<sd::u32> sizeDistribution(0u, 200u);
+
+    sd::List<sd::geometry::ScreenRectangle> rectangles{ };
+    rectangles.reserve(ItemCount);
+
+    for (sd::usize i = 0u; i < ItemCount; ++i)
+    {
+        rectangles.push_back(MakeRectangle(positionDistribution(randomEngine), positionDistribution(randomEngine), sizeDistribution(randomEngine), sizeDistribution(randomEngine)));
+    }
+
+    sd::ui::HitTestTree hitTestTree = BuildTree(rectangles);
+    REQUIRE(hitTestTree.GetNodeCount() > 1u);
+
+    const auto requireMatchingQueries = [&]()
+    {
+        sd::List<sd::u32> itemIndices{ };
+
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            const sd::geometry::ScreenPoint point{ positionDistribution(randomEngine), positionDistribution(randomEngine) };
+
+            REQUIRE(hitTestTree.FindTopmostItem(point) == FindTopmostItemLinearly(rectangles, point));
+
+            hitTestTree.FindItems(point, itemIndices);
+            REQUIRE(itemIndices == FindItemsLinearly(rectangles, point));
+        }
+    };
+
+    SECTION("After a full rebuild")
+    {
+        requireMatchingQueries();
+    }
+
+    SECTION("After moving and removing rectangles")
+    {
+        for (sd::u32 i = 0u; i < static_cast<sd::u32>(ItemCount); i += 3u)
+        {
+            rectangles[i] = i % 2u == 0u
+                ? MakeRectangle(positionDistribution(randomEngine), positionDistribution(randomEngine), sizeDistribution(randomEngine), sizeDistribution(randomEngine))
+                : sd::geometry::ScreenRectangle{ };
+
+            hitTestTree.SetRectangle(i, rectangles[i]);
+        }
+
+        hitTestTree.Update();
+        requireMatchingQueries();
+    }
+}
@@ -0,0 +1,215 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <random>
+
+#include <stardust/Stardust.h>
+
+namespace
+{
+    constexpr sd::usize QueryCount = 10'000u;
+    constexpr sd::u32 WorkerThreadCount = 4u;
+
+    auto PopulateWorld(sd::phys::World& world, const sd::phys::Rectangle& boxShape) -> void
+    {
+        for (sd::i32 x = 0; x < 50; ++x)
+        {
+            for (sd::i32 y = 0; y < 40; ++y)
+            {
+                world.CreateBody(sd::phys::Body::CreateInfo{
+                    .type = sd::phys::Body::Type::Static,
+                    .position = sd::Vector2{ static_cast<sd::f32>(x) * 2.0f, static_cast<sd::f32>(y) * 2.0f },
+                    .colliderInfos = {
+                        sd::phys::Collider::CreateInfo{
+                            .shape = boxShape,
+                            .filter = sd::phys::Collider::Filter{
+                                .layers = static_cast<sd::phys::CollisionLayer>(1u << ((x + y) % 2)),
+                            },
+                        },
+                    },
+                });
+            }
+        }
+    }
+
+    [[nodiscard]] auto GenerateRaycastQueries() -> sd::List<sd::phys::RaycastQuery>
+    {
+        std::mt19937 randomEngine(1234u);
+        std::uniform_real_distribution<sd::f32> positionDistribution(-10.0f, 110.0f);
+        std::uniform_real_distribution<sd::f32> directionDistribution(-1.0f, 1.0f);
+        std::uniform_real_distribution<sd::f32> distanceDistribution(0.5f, 20.0f);
+
+        sd::List<sd::phys::RaycastQuery> queries(QueryCount);
+
+        for (auto& query : queries)
+        {
+            query.origin = sd::Vector2{ positionDistribution(randomEngine), positionDistribution(randomEngine) };
+            query.direction = sd::Vector2{ directionDistribution(randomEngine), directionDistribution(randomEngine) };
+            query.distance = distanceDistribution(randomEngine);
+            query.layerMask = query.distance < 10.0f ? sd::phys::AllLayers : sd::phys::CollisionLayer{ 0x0001 };
+        }
+
+        return queries;
+    }
+
+    [[nodiscard]] auto GenerateBoxQueries() -> sd::List<sd::phys::BoxQuery>
+    {
+        std::mt19937 randomEngine(5678u);
+        std::uniform_real_distribution<sd::f32> positionDistribution(-10.0f, 110.0f);
+        std::uniform_real_distribution<sd::f32> sizeDistribution(0.1f, 1.0f);
+
+        sd::List<sd::phys::BoxQuery> queries(QueryCount);
+
+        for (auto& query : queries)
+        {
+            query.box = sd::phys::AABB(
+                sd::Vector2{ positionDistribution(randomEngine), positionDistribution(randomEngine) },
+                sd::Vector2{ sizeDistribution(randomEngine), sizeDistribution(randomEngine) }
+            );
+        }
+
+        return queries;
+    }
+}
+
+TEST_CASE("Batched physics queries match individual queries", "[physics_queries]")
+{
+    sd::phys::World world(sd::Vector2Zero);
+    const sd::phys::Rectangle boxShape(1.0f);
+    PopulateWorld(world, boxShape);
+
+    const sd::List<sd::phys::RaycastQuery> raycastQueries = GenerateRaycastQueries();
+    const sd::List<sd::phys::BoxQuery> boxQueries = GenerateBoxQueries();
+
+    SECTION("Can batch closest-hit raycasts")
+    {
+        sd::List<sd::Optional<sd::phys::RaycastHit>> results(QueryCount);
+        const sd::usize hitCount = world.RaycastBatch(raycastQueries, results);
+
+        sd::usize expectedHitCount = 0u;
+
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            const sd::phys::RaycastQuery& query = raycastQueries[i];
+            const auto expectedHit = world.Raycast(query.origin, query.direction, query.distance, query.layerMask);
+
+            REQUIRE(results[i].has_value() == expectedHit.has_value());
+
+            if (expectedHit.has_value())
+            {
+                REQUIRE(results[i]->collider == expectedHit->collider);
+                ++expectedHitCount;
+            }
+        }
+
+        REQUIRE(hitCount == expectedHitCount);
+    }
+
+    SECTION("Can batch line of sight raycasts")
+    {
+        const sd::UniquePointer<bool[]> results = std::make_unique<bool[]>(QueryCount);
+        world.RaycastAnyBatch(raycastQueries, sd::Slice<bool>(results.get(), QueryCount));
+
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            const sd::phys::RaycastQuery& query = raycastQueries[i];
+
+            REQUIRE(results[i] == world.Raycast(query.origin, query.direction, query.distance, query.layerMask).has_value());
+        }
+    }
+
+    SECTION("Can batch box overlap queries")
+    {
+        sd::List<sd::Optional<sd::phys::Collider>> results(QueryCount);
+        world.QueryBoxBatch(boxQueries, results);
+
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            REQUIRE(results[i].has_value() == world.QueryBox(boxQueries[i].box, boxQueries[i].layerMask).has_value());
+        }
+    }
+
+    SECTION("Threaded batches produce the same results as single-threaded batches")
+    {
+        sd::List<sd::Optional<sd::phys::RaycastHit>> singleThreadedResults(QueryCount);
+        sd::List<sd::Optional<sd::phys::RaycastHit>> multiThreadedResults(QueryCount);
+
+        REQUIRE(world.RaycastBatch(raycastQueries, singleThreadedResults) == world.RaycastBatch(raycastQueries, multiThreadedResults, WorkerThreadCount));
+
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            REQUIRE(singleThreadedResults[i].has_value() == multiThreadedResults[i].has_value());
+        }
+    }
+}
+
+TEST_CASE("Batched physics query benchmarks", "[physics_queries][!benchmark]")
+{
+    sd::phys::World world(sd::Vector2Zero);
+    const sd::phys::Rectangle boxShape(1.0f);
+    PopulateWorld(world, boxShape);
+
+    const sd::List<sd::phys::RaycastQuery> raycastQueries = GenerateRaycastQueries();
+    const sd::List<sd::phys::BoxQuery> boxQueries = GenerateBoxQueries();
+
+    sd::List<sd::Optional<sd::phys::RaycastHit>> raycastResults(QueryCount);
+    const sd::UniquePointer<bool[]> lineOfSightResults = std::make_unique<bool[]>(QueryCount);
+    sd::List<sd::Optional<sd::phys::Collider>> boxResults(QueryCount);
+
+    BENCHMARK("10k individual raycasts")
+    {
+        sd::usize hitCount = 0u;
+
+        for (const auto& query : raycastQueries)
+        {
+            if (world.Raycast(query.origin, query.direction, query.distance, query.layerMask).has_value())
+            {
+                ++hitCount;
+            }
+        }
+
+        return hitCount;
+    };
+
+    BENCHMARK("10k batched raycasts")
+    {
+        return world.RaycastBatch(raycastQueries, raycastResults);
+    };
+
+    BENCHMARK("10k batched raycasts (4 threads)")
+    {
+        return world.RaycastBatch(raycastQueries, raycastResults, WorkerThreadCount);
+    };
+
+    BENCHMARK("10k batched line of sight raycasts")
+    {
+        return world.RaycastAnyBatch(raycastQueries, sd::Slice<bool>(lineOfSightResults.get(), QueryCount));
+    };
+
+    BENCHMARK("10k batched line of sight raycasts (4 threads)")
+    {
+        return world.RaycastAnyBatch(raycastQueries, sd::Slice<bool>(lineOfSightResults.get(), QueryCount), WorkerThreadCount);
+    };
+
+    BENCHMARK("10k individual box queries")
+    {
+        sd::usize hitCount = 0u;
+
+        for (const auto& query : boxQueries)
+        {
+            if (world.QueryBox(query.box, query.layerMask).has_value())
+            {
+                ++hitCount;
+            }
+        }
+
+        return hitCount;
+    };
+
+    BENCHMARK("10k batched box queries (4 threads)")
+    {
+        return world.QueryBoxBatch(boxQueries, boxResults, WorkerThreadCount);
+    };
+}
@@ -0,0 +1,290 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+
+#include <stardust/Stardust.h>
+
+namespace
+{
+    constexpr sd::f64 Timestep = 1.0 / 60.0;
+    constexpr sd::usize BoxCount = 20u;
+
+    [[nodiscard]] auto CreateBox(sd::phys::World& world, const sd::phys::Rectangle& shape, const sd::Vector2 position, const sd::phys::Body::Type type) -> sd::ObserverPointer<sd::phys::Body>
+    {
+        return world.CreateBody(sd::phys::Body::CreateInfo{
+            .type = type,
+            .position = position,
+            .colliderInfos = {
+                sd::phys::Collider::CreateInfo{
+                    .shape = shape,
+                    .density = 1.0f,
+                },
+            },
+        });
+    }
+
+    [[nodiscard]] auto CountEndEvents(const sd::phys::World& world) -> sd::usize
+    {
+        return static_cast<sd::usize>(std::ranges::count_if(world.GetContactEvents(), [](const sd::phys::ContactEvent& contactEvent)
+        {
+            return contactEvent.type == sd::phys::ContactEvent::Type::End;
+        }));
+    }
+}
+
+TEST_CASE("Contact events are delivered for bodies destroyed outside a step", "[physics_world]")
+{
+    const bool isThreaded = GENERATE(false, true);
+
+    sd::phys::World world(sd::Vector2Zero);
+
+    if (isThreaded)
+    {
+        world.EnableThreadedStepping();
+    }
+
+    const sd::phys::Rectangle groundShape(20.0f, 1.0f);
+    const sd::phys::Rectangle boxShape(1.0f);
+
+    const sd::ObserverPointer<sd::phys::Body> ground = CreateBox(world, groundShape, sd::Vector2Zero, sd::phys::Body::Type::Static);
+    const sd::ObserverPointer<sd::phys::Body> box = CreateBox(world, boxShape, sd::Vector2{ 0.0f, 0.75f }, sd::phys::Body::Type::Dynamic);
+
+    sd::usize enterCount = 0u;
+    sd::usize exitCount = 0u;
+
+    for (const sd::ObserverPointer<sd::phys::Body> body : { ground, box })
+    {
+        world.SetCollisionEnterCallback(*body, [&enterCount](const sd::phys::Collider&) { ++enterCount; });
+        world.SetCollisionExitCallback(*body, [&exitCount](const sd::phys::Collider& other) { REQUIRE(other.IsValid()); ++exitCount; });
+    }
+
+    world.Step(Timestep);
+    world.Synchronise();
+
+    REQUIRE(enterCount == 1u);
+    REQUIRE(exitCount == 0u);
+
+    SECTION("Destroying a body reports its contacts as ended")
+    {
+        world.DestroyBody(box);
+        REQUIRE(exitCount == 1u);
+
+        world.Step(Timestep);
+        world.Synchronise();
+
+        REQUIRE(CountEndEvents(world) == 1u);
+    }
+
+    SECTION("Removing a collider reports its contacts as ended")
+    {
+        box->RemoveCollider(box->GetFirstCollider());
+        REQUIRE(exitCount == 1u);
+
+        world.Step(Timestep);
+        world.Synchronise();
+
+        REQUIRE(CountEndEvents(world) == 1u);
+    }
+
+    SECTION("Disabling a body reports its contacts as ended")
+    {
+        box->SetEnabled(false);
+        REQUIRE(exitCount == 1u);
+
+        world.Step(Timestep);
+        world.Synchronise();
+
+        REQUIRE(CountEndEvents(world) == 1u);
+    }
+
+    world.DisableThreadedStepping();
+}
+
+TEST_CASE("Contact callbacks can destroy bodies and colliders", "[physics_world]")
+{
+    const bool isThreaded = GENERATE(false, true);
+
+    sd::phys::World world(sd::Vector2{ 0.0f, -10.0f });
+
+    if (isThreaded)
+    {
+        world.EnableThreadedStepping();
+    }
+
+    const sd::phys::Rectangle groundShape(100.0f, 2.0f);
+    const sd::phys::Rectangle boxShape(1.0f);
+
+    const sd::ObserverPointer<sd::phys::Body> ground = CreateBox(world, groundShape, sd::Vector2Zero, sd::phys::Body::Type::Static);
+    sd::List<sd::ObserverPointer<sd::phys::Body>> boxes{ };
+
+    for (sd::usize i = 0u; i < BoxCount; ++i)
+    {
+        boxes.push_back(CreateBox(world, boxShape, sd::Vector2{ static_cast<sd::f32>(i) * 0.99f - 10.0f, 1.6f }, sd::phys::Body::Type::Dynamic));
+    }
+
+    sd::usize enterCount = 0u;
+
+    for (sd::usize i = 0u; i < BoxCount / 2u; ++i)
+    {
+        const sd::ObserverPointer<sd::phys::Body> body = boxes[i];
+        const sd::ObserverPointer<sd::phys::Body> neighbour = boxes[i + BoxCount / 2u];
+
+        world.SetCollisionEnterCallback(*body, [&world, &enterCount, body, neighbour](const sd::phys::Collider&)
+        {
+            ++enterCount;
+
+            if (neighbour->IsValid())
+            {
+                world.DestroyBody(neighbour);
+            }
+
+            if (body->IsValid())
+            {
+                world.DestroyBody(body);
+            }
+        });
+    }
+
+    world.SetCollisionEnterCallback(*ground, [&world, &enterCount](const sd::phys::Collider& other)
+    {
+        ++enterCount;
+
+        if (other.GetOwningBody() != nullptr && enterCount % 2u == 0u)
+        {
+            world.DestroyBody(other.GetOwningBody());
+        }
+    });
+
+    for (sd::usize frame = 0u; frame < 120u; ++frame)
+    {
+        world.Step(Timestep);
+        [[maybe_unused]] const auto raycastHit = world.Raycast(sd::Vector2{ 0.0f, 10.0f }, sd::Vector2Down, 20.0f);
+
+        if (frame == 60u)
+        {
+            for (const sd::ObserverPointer<sd::phys::Body> box : boxes)
+            {
+                if (box->IsValid() && box->HasColliders())
+                {
+                    box->RemoveCollider(box->GetFirstCollider());
+                }
+            }
+        }
+    }
+
+    world.Synchronise();
+
+    REQUIRE(enterCount > 0u);
+    REQUIRE(std::ranges::none_of(world.GetContactEvents(), [](const sd::phys::ContactEvent& contactEvent)
+    {
+        return contactEvent.type == sd::phys::ContactEvent::Type::Begin && (contactEvent.firstFixture == nullptr || contactEvent.secondFixture == nullptr);
+    }));
+
+    world.DestroyBody(ground);
+    world.DisableThreadedStepping();
+}
+
+TEST_CASE("Threaded stepping matches inline stepping", "[physics_world]")
+{
+    sd::phys::World inlineWorld(sd::Vector2{ 0.0f, -10.0f });
+    sd::phys::World threadedWorld(sd::Vector2{ 0.0f, -10.0f });
+    threadedWorld.EnableThreadedStepping();
+
+    const sd::phys::Rectangle groundShape(100.0f, 2.0f);
+    const sd::phys::Rectangle boxShape(1.0f);
+
+    [[maybe_unused]] const sd::ObserverPointer<sd::phys::Body> inlineGround = CreateBox(inlineWorld, groundShape, sd::Vector2Zero, sd::phys::Body::Type::Static);
+    [[maybe_unused]] const sd::ObserverPointer<sd::phys::Body> threadedGround = CreateBox(threadedWorld, groundShape, sd::Vector2Zero, sd::phys::Body::Type::Static);
+
+    sd::List<sd::ObserverPointer<sd::phys::Body>> inlineBoxes{ };
+    sd::List<sd::ObserverPointer<sd::phys::Body>> threadedBoxes{ };
+
+    for (sd::usize i = 0u; i < BoxCount; ++i)
+    {
+        const sd::Vector2 position{ static_cast<sd::f32>(i % 5u) * 1.1f, 2.0f + static_cast<sd::f32>(i / 5u) * 1.1f };
+
+        inlineBoxes.push_back(CreateBox(inlineWorld, boxShape, position, sd::phys::Body::Type::Dynamic));
+        threadedBoxes.push_back(CreateBox(threadedWorld, boxShape, position, sd::phys::Body::Type::Dynamic));
+    }
+
+    SECTION("Steps are deferred until the world is synchronised")
+    {
+        threadedWorld.Step(Timestep);
+        REQUIRE(threadedWorld.IsStepInFlight());
+
+        threadedWorld.Synchronise();
+        REQUIRE(!threadedWorld.IsStepInFlight());
+    }
+
+    SECTION("Body transforms and contact events match after each step")
+    {
+        for (sd::usize frame = 0u; frame < 120u; ++frame)
+        {
+            inlineWorld.Step(Timestep);
+            threadedWorld.Step(Timestep);
+            threadedWorld.Synchronise();
+
+            REQUIRE(threadedWorld.GetContactEvents().size() == inlineWorld.GetContactEvents().size());
+
+            for (sd::usize i = 0u; i < BoxCount; ++i)
+            {
+                REQUIRE(threadedBoxes[i]->GetPosition() == inlineBoxes[i]->GetPosition());
+                REQUIRE(threadedBoxes[i]->GetRotation() == inlineBoxes[i]->GetRotation());
+            }
+        }
+    }
+
+    SECTION("Queries wait for the in-flight step")
+    {
+        for (sd::usize frame = 0u; frame < 60u; ++frame)
+        {
+            inlineWorld.Step(Timestep);
+            threadedWorld.Step(Timestep);
+
+            REQUIRE(threadedWorld.Raycast(sd::Vector2{ 0.0f, 20.0f }, sd::Vector2Down, 40.0f).has_value() == inlineWorld.Raycast(sd::Vector2{ 0.0f, 20.0f }, sd::Vector2Down, 40.0f).has_value());
+            REQUIRE(threadedBoxes.front()->GetPosition() == inlineBoxes.front()->GetPosition());
+        }
+    }
+
+    threadedWorld.DisableThreadedStepping();
+}
+
+TEST_CASE("Interpolated transforms blend the last two steps", "[physics_world]")
+{
+    const bool isThreaded = GENERATE(false, true);
+
+    sd::phys::World world(sd::Vector2Zero);
+
+    if (isThreaded)
+    {
+        world.EnableThreadedStepping();
+    }
+
+    const sd::phys::Rectangle boxShape(1.0f);
+    const sd::ObserverPointer<sd::phys::Body> box = CreateBox(world, boxShape, sd::Vector2Zero, sd::phys::Body::Type::Dynamic);
+    box->SetLinearVelocity(sd::Vector2{ 60.0f, 0.0f });
+
+    world.Step(Timestep);
+    world.Synchronise();
+
+    const sd::Vector2 previousPosition = box->GetPosition();
+
+    world.Step(Timestep);
+    world.Synchronise();
+
+    const sd::Vector2 currentPosition = box->GetPosition();
+    REQUIRE(currentPosition.x > previousPosition.x);
+
+    REQUIRE(world.GetInterpolatedTransform(*box, 0.0f).position == previousPosition);
+    REQUIRE(world.GetInterpolatedTransform(*box, 1.0f).position == currentPosition);
+    REQUIRE(world.GetInterpolatedTransform(*box, 0.5f).position.x == Approx((previousPosition.x + currentPosition.x) / 2.0f));
+
+    if (isThreaded)
+    {
+        world.Step(Timestep);
+        REQUIRE(world.GetInterpolatedTransform(*box, 1.0f).position == currentPosition);
+    }
+
+    world.DisableThreadedStepping();
+}
@@ -0,0 +1,152 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <functional>
+
+#include <stardust/Stardust.h>
+
+namespace
+{
+    constexpr sd::u32 EntityCount = 10'000u;
+
+    auto PopulateRegistry(sd::EntityRegistry& registry) -> void
+    {
+        for (sd::u32 i = 0u; i < EntityCount; ++i)
+        {
+            const sd::EntityHandle entityHandle = registry.GetHandle().create();
+
+            registry.GetHandle().emplace<sd::components::Transform>(
+                entityHandle,
+                sd::components::Transform{
+                    .translation = sd::Vector2{ static_cast<sd::f32>(i), static_cast<sd::f32>(i) * 0.5f },
+                    .rotation = 0.0f,
+                }
+            );
+        }
+    }
+
+    auto LoadPerEntityBindings(sol::state& luaState) -> void
+    {
+        luaState.new_usertype<sd::Vector2>(
+            "vector2",
+            "x", &sd::Vector2::x,
+            "y", &sd::Vector2::y
+        );
+
+        luaState.new_usertype<sd::components::Transform>(
+            "transform",
+            "translation", &sd::components::Transform::translation,
+            "rotation", &sd::components::Transform::rotation
+        );
+    }
+
+    constexpr const char* UpdateScript = R"LUA(
+        function update_transform(transform, delta_time)
+            local translation = transform.translation
+            translation.x = translation.x + 10.0 * delta_time
+            transform.translation = translation
+            transform.rotation = transform.rotation + 90.0 * delta_time
+        end
+
+        function update_transforms(count, translation_x, translation_y, scale_x, scale_y, rotation)
+            for i = 1, count do
+                translation_x[i] = translation_x[i] + 10.0 * delta_time
+                rotation[i] = rotation[i] + 90.0 * delta_time
+            end
+        end
+    )LUA";
+}
+
+TEST_CASE("Scripts can read and write transforms in bulk", "[script_entities]")
+{
+    sol::state luaState;
+    luaState.open_libraries(sol::lib::base);
+    luaState.script(UpdateScript);
+    luaState["delta_time"] = 0.5;
+
+    sd::EntityRegistry registry;
+    PopulateRegistry(registry);
+
+    sd::ScriptTransformView transformView(luaState);
+
+    SECTION("Can run a function over every transform in chunks")
+    {
+        REQUIRE(transformView.ForEach(registry, luaState["update_transforms"], 300u) == sd::Status::Success);
+
+        for (const auto [entityHandle, transform] : registry.GetHandle().view<const sd::components::Transform>().each())
+        {
+            REQUIRE(transform.translation.x == Approx(static_cast<sd::f32>(entt::to_integral(entityHandle)) + 5.0f));
+            REQUIRE(transform.translation.y == Approx(static_cast<sd::f32>(entt::to_integral(entityHandle)) * 0.5f));
+            REQUIRE(transform.rotation == Approx(45.0f));
+        }
+    }
+
+    SECTION("Can gather transforms into arrays and scatter them back")
+    {
+        REQUIRE(transformView.Gather(registry) == EntityCount);
+
+        const auto [count, translationX, translationY, scaleX, scaleY, rotation] = transformView.GetScriptArrays();
+        luaState["update_transforms"](count, translationX, translationY, scaleX, scaleY, rotation);
+
+        luaState["translation_x"] = translationX;
+        REQUIRE(luaState.script("return #translation_x").get<sd::u32>() == EntityCount);
+
+        transformView.Scatter(registry);
+
+        const sd::EntityHandle firstEntity = transformView.GetEntities().front();
+        REQUIRE(registry.GetHandle().get<sd::components::Transform>(firstEntity).rotation == Approx(45.0f));
+    }
+
+    SECTION("Out of range array writes raise errors")
+    {
+        transformView.Gather(registry);
+        luaState["rotation"] = std::get<5>(transformView.GetScriptArrays());
+
+        REQUIRE(!luaState.safe_script("rotation[0] = 1.0", sol::script_pass_on_error).valid());
+        REQUIRE(!luaState.safe_script("rotation[10001] = 1.0", sol::script_pass_on_error).valid());
+        REQUIRE(luaState.safe_script("return rotation[10001] == nil", sol::script_pass_on_error).get<bool>());
+    }
+
+    SECTION("Script errors stop the iteration")
+    {
+        luaState.script("function failing_update() error(\"failure\") end");
+
+        REQUIRE(transformView.ForEach(registry, luaState["failing_update"]) == sd::Status::Fail);
+    }
+}
+
+TEST_CASE("Bulk script entity access benchmarks", "[script_entities][!benchmark]")
+{
+    sol::state luaState;
+    luaState.open_libraries(sol::lib::base);
+    LoadPerEntityBindings(luaState);
+    luaState.script(UpdateScript);
+    luaState["delta_time"] = 1.0 / 60.0;
+
+    sd::EntityRegistry registry;
+    PopulateRegistry(registry);
+
+    sd::ScriptTransformView transformView(luaState);
+
+    const sol::protected_function updateTransform = luaState["update_transform"];
+    const sol::protected_function updateTransforms = luaState["update_transforms"];
+
+    BENCHMARK("10k per-entity sol2 calls")
+    {
+        for (const auto [entityHandle, transform] : registry.GetHandle().view<sd::components::Transform>().each())
+        {
+            updateTransform(std::ref(transform), 1.0 / 60.0);
+        }
+    };
+
+    BENCHMARK("10k entities in chunks of 256")
+    {
+        return transformView.ForEach(registry, updateTransforms);
+    };
+
+    BENCHMARK("10k entities in one chunk")
+    {
+        return transformView.ForEach(registry, updateTransforms, EntityCount);
+    };
+}
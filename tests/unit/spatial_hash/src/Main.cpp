@@ -0,0 +1,194 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+
+#include <stardust/Stardust.h>
+
+namespace
+{
+    constexpr sd::usize EntityCount = 2'000u;
+    constexpr sd::usize QueryCount = 200u;
+    constexpr sd::f32 CellSize = 4.0f;
+
+    auto PopulateRegistry(sd::EntityRegistry& registry) -> sd::List<sd::EntityHandle>
+    {
+        std::mt19937 randomEngine(1234u);
+        std::uniform_real_distribution<sd::f32> positionDistribution(-100.0f, 100.0f);
+
+        sd::List<sd::EntityHandle> entities{ };
+        entities.reserve(EntityCount);
+
+        for (sd::usize i = 0u; i < EntityCount; ++i)
+        {
+            const sd::EntityHandle entityHandle = registry.GetHandle().create();
+            registry.GetHandle().emplace<sd::comp::Transform>(entityHandle, sd::comp::Transform{
+                .translation = sd::Vector2{ positionDistribution(randomEngine), positionDistribution(randomEngine) },
+            });
+
+            entities.push_back(entityHandle);
+        }
+
+        return entities;
+    }
+
+    [[nodiscard]] auto GetPosition(const sd::EntityRegistry& registry, const sd::EntityHandle entityHandle) -> sd::Vector2
+    {
+        return registry.GetHandle().get<sd::comp::Transform>(entityHandle).translation;
+    }
+
+    [[nodiscard]] auto Sorted(sd::List<sd::EntityHandle> entities) -> sd::List<sd::EntityHandle>
+    {
+        std::ranges::sort(entities);
+
+        return entities;
+    }
+
+    [[nodiscard]] auto BruteForceRadius(const sd::EntityRegistry& registry, const sd::Vector2 centre, const sd::f32 radius) -> sd::List<sd::EntityHandle>
+    {
+        sd::List<sd::EntityHandle> results{ };
+
+        for (const auto [entityHandle, transform] : registry.GetHandle().view<const sd::comp::Transform>().each())
+        {
+            if (glm::distance(transform.translation, centre) <= radius)
+            {
+                results.push_back(entityHandle);
+            }
+        }
+
+        return Sorted(std::move(results));
+    }
+
+    [[nodiscard]] auto BruteForceAABB(const sd::EntityRegistry& registry, const sd::phys::AABB& box) -> sd::List<sd::EntityHandle>
+    {
+        sd::List<sd::EntityHandle> results{ };
+
+        for (const auto [entityHandle, transform] : registry.GetHandle().view<const sd::comp::Transform>().each())
+        {
+            if (box.Contains(transform.translation))
+            {
+                results.push_back(entityHandle);
+            }
+        }
+
+        return Sorted(std::move(results));
+    }
+}
+
+TEST_CASE("Spatial hash queries match brute force queries", "[spatial_hash]")
+{
+    sd::EntityRegistry registry;
+    const sd::List<sd::EntityHandle> entities = PopulateRegistry(registry);
+
+    sd::SpatialHash spatialHash(registry, CellSize);
+    REQUIRE(spatialHash.GetEntityCount() == EntityCount);
+
+    std::mt19937 randomEngine(5678u);
+    std::uniform_real_distribution<sd::f32> positionDistribution(-120.0f, 120.0f);
+    std::uniform_real_distribution<sd::f32> sizeDistribution(0.0f, 30.0f);
+
+    SECTION("Can query entities within a radius")
+    {
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            const sd::Vector2 centre{ positionDistribution(randomEngine), positionDistribution(randomEngine) };
+            const sd::f32 radius = sizeDistribution(randomEngine);
+
+            REQUIRE(Sorted(spatialHash.QueryRadius(centre, radius)) == BruteForceRadius(registry, centre, radius));
+        }
+    }
+
+    SECTION("Can query entities within an AABB")
+    {
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            const sd::phys::AABB box(
+                sd::Vector2{ positionDistribution(randomEngine), positionDistribution(randomEngine) },
+                sd::Vector2{ sizeDistribution(randomEngine), sizeDistribution(randomEngine) }
+            );
+
+            REQUIRE(Sorted(spatialHash.QueryAABB(box)) == BruteForceAABB(registry, box));
+        }
+    }
+
+    SECTION("Can query the k nearest entities")
+    {
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            const sd::Vector2 position{ positionDistribution(randomEngine), positionDistribution(randomEngine) };
+            const sd::usize count = 1u + i % 16u;
+
+            const sd::List<sd::EntityHandle> nearestEntities = spatialHash.QueryNearest(position, count);
+            REQUIRE(nearestEntities.size() == count);
+
+            sd::List<sd::f32> distances{ };
+
+            for (const sd::EntityHandle entityHandle : nearestEntities)
+            {
+                distances.push_back(glm::distance(GetPosition(registry, entityHandle), position));
+            }
+
+            REQUIRE(std::ranges::is_sorted(distances));
+
+            sd::List<sd::f32> expectedDistances{ };
+
+            for (const sd::EntityHandle entityHandle : entities)
+            {
+                expectedDistances.push_back(glm::distance(GetPosition(registry, entityHandle), position));
+            }
+
+            std::ranges::sort(expectedDistances);
+            expectedDistances.resize(count);
+
+            REQUIRE(distances == expectedDistances);
+        }
+    }
+
+    SECTION("Nearest queries respect the maximum distance")
+    {
+        const sd::Vector2 position{ 0.0f, 0.0f };
+        const sd::f32 maxDistance = 10.0f;
+
+        const sd::List<sd::EntityHandle> nearestEntities = spatialHash.QueryNearest(position, EntityCount, maxDistance);
+
+        REQUIRE(Sorted(nearestEntities) == BruteForceRadius(registry, position, maxDistance));
+    }
+
+    SECTION("Moved entities are rebucketed on update")
+    {
+        for (sd::usize i = 0u; i < entities.size(); i += 3u)
+        {
+            sd::comp::Transform& transform = registry.GetHandle().get<sd::comp::Transform>(entities[i]);
+            transform.translation = sd::Vector2{ -transform.translation.y, transform.translation.x + 7.5f };
+        }
+
+        spatialHash.Update();
+
+        for (sd::usize i = 0u; i < QueryCount; ++i)
+        {
+            const sd::Vector2 centre{ positionDistribution(randomEngine), positionDistribution(randomEngine) };
+            const sd::f32 radius = sizeDistribution(randomEngine);
+
+            REQUIRE(Sorted(spatialHash.QueryRadius(centre, radius)) == BruteForceRadius(registry, centre, radius));
+        }
+    }
+
+    SECTION("New and destroyed entities are tracked")
+    {
+        const sd::EntityHandle newEntity = registry.GetHandle().create();
+        registry.GetHandle().emplace<sd::comp::Transform>(newEntity, sd::comp::Transform{ .translation = sd::Vector2{ 500.0f, 500.0f } });
+
+        spatialHash.Update();
+        REQUIRE(spatialHash.QueryRadius(sd::Vector2{ 500.0f, 500.0f }, 1.0f) == sd::List<sd::EntityHandle>{ newEntity });
+
+        registry.GetHandle().destroy(newEntity);
+        registry.GetHandle().destroy(entities.front());
+
+        REQUIRE(!spatialHash.Contains(newEntity));
+        REQUIRE(!spatialHash.Contains(entities.front()));
+        REQUIRE(spatialHash.GetEntityCount() == EntityCount - 1u);
+        REQUIRE(spatialHash.QueryRadius(sd::Vector2{ 500.0f, 500.0f }, 1.0f).empty());
+    }
+}
@@ -1,59 +1,194 @@
-# Script based on https://tomeofpreach.wordpress.com/2013/06/22/makepak-py/ and modified/updated.
-# Credit goes to The Tome of Preach (no license given for the Python snippet).
+# Creates a Stardust pack archive (SDPK): a hashed directory of 64-bit offset entries, each aligned and optionally LZ4 compressed.
+# Layout: header | aligned entry data | entry table | bucket table | string table.
+# --compression lz4 requires the lz4 Python package: pip install lz4
 
+import argparse
 import os
 import struct
-import sys
- 
+import subprocess
+
+PACK_MAGIC = b"SDPK"
+PACK_VERSION = 1
+
+EMPTY_BUCKET = 0xFFFFFFFF
+
+COMPRESSION_NONE = 0
+COMPRESSION_LZ4 = 1
+
+HEADER_STRUCT = struct.Struct("<4s3I4Q")
+ENTRY_STRUCT = struct.Struct("<4Q4I")
+
+FNV_OFFSET_BASIS = 0xCBF29CE484222325
+FNV_PRIME = 0x00000100000001B3
+
 # Class for collecting the file headers and metadata.
 class FileEntry:
-    filename = ""
-
-    offset = 0
-    length = 0
- 
-# Arguments are source directory, then target filename (for example, "pak1.pak").
-source_directory = sys.argv[1]
-output_pak_filename = sys.argv[2]
-virtual_root_directory = sys.argv[3] # assets or locales.
- 
-output_pak_file = open(output_pak_filename, "wb")
- 
-# Write a dummy header wherewith to start.
-output_pak_file.write(struct.Struct("<4s2l").pack(b"PACK", 0, 0))
- 
-# Walk the directory recursively, add the files, and record the file entries.
-file_entries = []
-offset = 12
-
-for root_directory, sub_directories, files in os.walk(source_directory):
-    for file in files:
-        current_filepath = os.path.join(root_directory, file)
-
-        current_file_entry = FileEntry()
-        current_file_entry.filename = os.path.relpath(current_filepath, source_directory).replace("\\", "/")
-        current_file_entry.filename = virtual_root_directory + "/" + current_file_entry.filename
-
-        with open(current_filepath, "rb") as current_file:
-            output_pak_file.write(current_file.read())
-
-            current_file_entry.offset = offset
-            current_file_entry.length = current_file.tell()
-
-            offset += current_file_entry.length
-
-        file_entries.append(current_file_entry)
-
-table_size = 0
- 
-# After all the file data, write the list of entries.
-for entry in file_entries:
-    output_pak_file.write(struct.Struct("<56s").pack(entry.filename.encode("ascii")))
-    output_pak_file.write(struct.Struct("<l").pack(entry.offset))
-    output_pak_file.write(struct.Struct("<l").pack(entry.length))
-
-    table_size += 64
-
-# Return to the header and write the values correctly.
-output_pak_file.seek(0)
-output_pak_file.write(struct.Struct("<4s2l").pack(b"PACK", offset, table_size))
+    def __init__(self, path, source_filepath):
+        self.path = path
+        self.path_hash = hash_path(path)
+        self.source_filepath = source_filepath
+
+        self.offset = 0
+        self.stored_size = 0
+        self.size = 0
+
+        self.path_offset = 0
+        self.path_length = 0
+
+        self.compression = COMPRESSION_NONE
+
+def hash_path(path):
+    path_hash = FNV_OFFSET_BASIS
+
+    for byte in path.encode("utf-8"):
+        path_hash ^= byte
+        path_hash = (path_hash * FNV_PRIME) & 0xFFFFFFFFFFFFFFFF
+
+    return path_hash
+
+def align(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+def next_power_of_two(value):
+    power = 1
+
+    while power < value:
+        power *= 2
+
+    return power
+
+def compress_lz4(data):
+    try:
+        import lz4.block
+    except ImportError:
+        raise SystemExit("--compression lz4 requires the lz4 Python package; install it with: pip install lz4")
+
+    return lz4.block.compress(data, mode = "high_compression", store_size = False)
+
+def compile_lua(luac_filepath, source_filepath):
+    return subprocess.run([luac_filepath, "-o", "-", source_filepath], check = True, stdout = subprocess.PIPE).stdout
+
+def write_padding(output_file, alignment):
+    padding = align(output_file.tell(), alignment) - output_file.tell()
+    output_file.write(b"\0" * padding)
+
+def create_pak_archive(source_directory, output_pak_filename, virtual_root_directory, alignment, compression, luac_filepath):
+    file_entries = []
+
+    # Walk the directory recursively and record the file entries in a stable order.
+    for root_directory, sub_directories, files in os.walk(source_directory):
+        sub_directories.sort()
+
+        for file in sorted(files):
+            current_filepath = os.path.join(root_directory, file)
+
+            relative_path = os.path.relpath(current_filepath, source_directory).replace("\\", "/")
+            file_entries.append(FileEntry(virtual_root_directory + "/" + relative_path, current_filepath))
+
+    with open(output_pak_filename, "wb") as output_pak_file:
+        # Write a dummy header wherewith to start.
+        output_pak_file.write(HEADER_STRUCT.pack(PACK_MAGIC, PACK_VERSION, 0, 0, 0, 0, 0, 0))
+
+        for entry in file_entries:
+            # Lua scripts are stored as precompiled chunks if a compiler is given; the script engine detects them by their signature.
+            if luac_filepath is not None and entry.source_filepath.endswith(".lua"):
+                data = compile_lua(luac_filepath, entry.source_filepath)
+            else:
+                with open(entry.source_filepath, "rb") as current_file:
+                    data = current_file.read()
+
+            entry.size = len(data)
+
+            if compression == "lz4" and len(data) > 0:
+                compressed_data = compress_lz4(data)
+
+                if len(compressed_data) < len(data):
+                    data = compressed_data
+                    entry.compression = COMPRESSION_LZ4
+
+            write_padding(output_pak_file, alignment)
+
+            entry.offset = output_pak_file.tell()
+            entry.stored_size = len(data)
+
+            output_pak_file.write(data)
+
+        string_table = bytearray()
+
+        for entry in file_entries:
+            encoded_path = entry.path.encode("utf-8")
+
+            entry.path_offset = len(string_table)
+            entry.path_length = len(encoded_path)
+
+            string_table += encoded_path + b"\0"
+
+        bucket_count = next_power_of_two(max(len(file_entries) * 2, 1))
+        buckets = [EMPTY_BUCKET] * bucket_count
+
+        # Open addressing with linear probing, matching PackArchive::FindEntry.
+        for entry_index, entry in enumerate(file_entries):
+            bucket_index = entry.path_hash & (bucket_count - 1)
+
+            while buckets[bucket_index] != EMPTY_BUCKET:
+                bucket_index = (bucket_index + 1) & (bucket_count - 1)
+
+            buckets[bucket_index] = entry_index
+
+        write_padding(output_pak_file, 8)
+        entry_table_offset = output_pak_file.tell()
+
+        for entry in file_entries:
+            output_pak_file.write(ENTRY_STRUCT.pack(
+                entry.path_hash,
+                entry.offset,
+                entry.stored_size,
+                entry.size,
+                entry.path_offset,
+                entry.path_length,
+                entry.compression,
+                alignment
+            ))
+
+        bucket_table_offset = output_pak_file.tell()
+        output_pak_file.write(struct.pack("<{}I".format(bucket_count), *buckets))
+
+        string_table_offset = output_pak_file.tell()
+        output_pak_file.write(string_table)
+
+        # Return to the header and write the values correctly.
+        output_pak_file.seek(0)
+        output_pak_file.write(HEADER_STRUCT.pack(
+            PACK_MAGIC,
+            PACK_VERSION,
+            len(file_entries),
+            bucket_count,
+            entry_table_offset,
+            bucket_table_offset,
+            string_table_offset,
+            len(string_table)
+        ))
+
+if __name__ == "__main__":
+    argument_parser = argparse.ArgumentParser(description = "Creates a Stardust pack archive from a directory.")
+    argument_parser.add_argument("source_directory")
+    argument_parser.add_argument("output_pak_filename")
+    argument_parser.add_argument("virtual_root_directory", help = "assets, locales, or scripts.")
+    argument_parser.add_argument("--alignment", type = int, default = 16, help = "Byte alignment of each entry's data (power of two).")
+    argument_parser.add_argument("--compression", choices = ["none", "lz4"], default = "none", help = "Per-entry compression; entries that do not shrink are stored uncompressed. lz4 requires: pip install lz4")
+
+    argument_parser.add_argument("--luac", default = None, help = "Path to a luac matching the engine's Lua version; .lua files are stored as bytecode.")
+
+    arguments = argument_parser.parse_args()
+
+    if arguments.alignment <= 0 or (arguments.alignment & (arguments.alignment - 1)) != 0:
+        argument_parser.error("alignment must be a power of two")
+
+    create_pak_archive(
+        arguments.source_directory,
+        arguments.output_pak_filename,
+        arguments.virtual_root_directory,
+        arguments.alignment,
+        arguments.compression,
+        arguments.luac
+    )